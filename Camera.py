@@ -14,41 +14,73 @@
 #╱╱╱╱╭━╯┃
 #╱╱╱╱╰━━╯
 
+import os
+import sys
 import serial
 import cv2
 import struct
+import threading
 import time
 import numpy as np
-import requests
 from datetime import datetime
 
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), 'tools'))
+import codec
+import host_cache
+import proto
+import rgb565
+
 # ***************** CONFIGURATION *****************
 
-SERIAL_PORT = 'COM10'
-BAUD_RATE = 460800     # Fastest transmission with SPI Speed
+SERIAL_PORTS = os.environ.get('PHONE_SERIAL_PORT', 'COM10').split(',') # Comma separated, one per phone
+BAUD_RATE = proto.BAUD_BASE    # Rate at connect, the MCU negotiates up to the fastest one that holds
 IMG_WIDTH = 240        # Full Screen
 IMG_HEIGHT = 240
-LOCATION_BUF_SIZE = 128 
+LOCATION_BUF_SIZE = 128    # MCU text reply buffer, replies are cut to fit with its NUL
+CODEC_QUANT = 1        # Low bits dropped per channel for packed photos (0 = lossless)
+VIDEO_BLOCK = 16       # Video block size (must match VIDEO_BLOCK in video.h)
+VIDEO_THRESHOLD = 6    # Mean color difference for a block to count as changed
+VIDEO_SCALES = (2, 3)  # Low resolution video the MCU can upscale (120x120, 80x80)
+ZOOM_MAX = 4           # Largest tile zoom (must match PHOTO_ZOOM_MAX in photo.h)
+FRAME_SLOTS = 3        # Frames the capture ring keeps
+FRAME_WAIT_S = 1.0     # Longest wait for a camera frame
+SERIAL_POLL_S = 0.001  # Serial thread period while no request is waiting
+STATS_S = 10.0         # Latency report period
+RECONNECT_S = 1.0      # Retry period of a port that is missing or went away
+LOG_REQUESTS = True    # Print a line per request
+SHARE_ENCODINGS = True # Encode a camera frame once for every phone asking for it (False encodes per request)
+WEATHER_TTL_S = 600    # Web data is refreshed in the background before it gets this old
+LOCATION_TTL_S = 3600
+
+# Lock screen face detection, gated by motion and narrowed to the face once one is seen
+DETECT_WIDTH = 320     # The cascade runs on the first pyramid level at most this wide
+MOTION_SIZE = (80, 60) # Motion is the mean difference of frames shrunk to this
+MOTION_THRESHOLD = 2.0 # Mean absolute gray difference (0 to 255) that counts as motion
+ACTIVE_HOLD_S = 1.0    # After motion the cascade runs on every frame this long
+IDLE_DETECT_S = 2.0    # Cascade period without motion, for a face that holds still
+FACE_CONFIRM = 2       # Detections in a row that unlock
+ROI_MARGIN = 0.5       # Tracked region around the last face, in face sizes per side
 
 # ***************** STATES *****************
-STATE_LOCKED = 0
-STATE_UNLOCKED = 1
-current_state = STATE_LOCKED
-
-# US State Abbreviations Map
-# States abbreviated for conscise printing on screen
-STATE_MAP = {
-    "Alabama": "AL", "Alaska": "AK", "Arizona": "AZ", "Arkansas": "AR", "California": "CA",
-    "Colorado": "CO", "Connecticut": "CT", "Delaware": "DE", "Florida": "FL", "Georgia": "GA",
-    "Hawaii": "HI", "Idaho": "ID", "Illinois": "IL", "Indiana": "IN", "Iowa": "IA",
-    "Kansas": "KS", "Kentucky": "KY", "Louisiana": "LA", "Maine": "ME", "Maryland": "MD",
-    "Massachusetts": "MA", "Michigan": "MI", "Minnesota": "MN", "Mississippi": "MS", "Missouri": "MO",
-    "Montana": "MT", "Nebraska": "NE", "Nevada": "NV", "New Hampshire": "NH", "New Jersey": "NJ",
-    "New Mexico": "NM", "New York": "NY", "North Carolina": "NC", "North Dakota": "ND", "Ohio": "OH",
-    "Oklahoma": "OK", "Oregon": "OR", "Pennsylvania": "PA", "Rhode Island": "RI", "South Carolina": "SC",
-    "South Dakota": "SD", "Tennessee": "TN", "Texas": "TX", "Utah": "UT", "Vermont": "VT",
-    "Virginia": "VA", "Washington": "WA", "West Virginia": "WV", "Wisconsin": "WI", "Wyoming": "WY"
-}
+# Per phone, see Link
+STATE_OFFLINE = 0      # Port missing or gone, retried every RECONNECT_S
+STATE_LOCKED = 1
+STATE_UNLOCKED = 2
+
+# Faces confirmed by the detection worker so far, a locked link unlocks once this passes its mark
+unlock_count = 0
+
+# Newest frame with the detected faces drawn, shown by the main thread while locked
+preview = None
+
+# Pixel order of progressive photos, built on first use
+progressive_index = None
+
+# Resize, mirror and RGB565 pack into buffers kept between frames, one packer per thread
+packers = threading.local()
+
+# Weather and location, refreshed by a background thread and answered from memory
+cache = host_cache.ResponseCache()
 
 # ********************************** HELPER FUNCTIONS **********************************
 
@@ -57,247 +89,631 @@ def get_current_time():
     """Returns current time string (e.g., '12:45 PM')."""
     return datetime.now().strftime("%I:%M %p").lstrip('0')
 
-def get_device_location():
-    """Returns the location from online API, returns unavailable or unkown upon an error"""
-    try:
-        # Ping API for location with small timeout
-        response = requests.get('http://ip-api.com/json/', timeout=2)
-
-        # Read data
-        data = response.json()
-
-        # Check status and return
-        if data['status'] == 'success':
-            return f"Lat: {data['lat']}, Lon: {data['lon']}"
+def start_cache():
+    """Registers the web replies with their TTL and the text sent before the first fetch succeeds"""
+    cache.add('C', host_cache.fetch_location, LOCATION_TTL_S, "Loc: Unavailable")
+    cache.add('W', host_cache.fetch_weather, WEATHER_TTL_S, "Offline\n--\nNo Conn\n--")
+    cache.start()
+
+def local_packer():
+    """Packer of the calling thread, its buffers are overwritten by the thread's next frame"""
+    if not hasattr(packers, 'packer'):
+        packers.packer = rgb565.Packer()
+    return packers.packer
+
+def frame_size(scale=1, zoom=1):
+    """Width, height and resize filter of the screen at 1 / scale (area averaging keeps the low resolution
+    frames from aliasing) or zoom times it"""
+    return (IMG_WIDTH * zoom // scale, IMG_HEIGHT * zoom // scale,
+            cv2.INTER_AREA if scale > 1 else cv2.INTER_LINEAR)
+
+def frame_to_rgb565(frame, scale=1, zoom=1):
+    """Resizes a camera frame to the screen (1 / scale of it, or zoom times it), mirrors it and returns a new
+    array of RGB565 values (for callers that keep it)"""
+    w, h, interpolation = frame_size(scale, zoom)
+    return local_packer().pack(frame, w, h, interpolation, out=np.empty((h, w), dtype=np.uint16))
+
+def convert_to_rgb565(frame, scale=1, order=None):
+    """RGB565 bytes of a frame as the MCU reads them, a memoryview of a new array that no one writes again, so
+    every link asking for the frame writes the same encoding without a copy"""
+    w, h, interpolation = frame_size(scale)
+    return local_packer().wire(frame, w, h, interpolation, order, out=np.empty(w * h, dtype=np.uint16))
+
+def progressive_order():
+    """Flat pixel indices in the order of a progressive photo (must match photo_receive_progressive)"""
+    global progressive_index
+    if progressive_index is None:
+        rows = []
+        step = 8                                    # PHOTO_COARSE_STEP, one pixel per 8x8 block first
+        while step >= 1:
+            for y in range(0, IMG_HEIGHT, step):
+
+                # Rows drawn by an earlier pass only get the pixels between the ones already sent
+                if step < 8 and y % (step * 2) == 0:
+                    xs = np.arange(step, IMG_WIDTH, step * 2)
+                else:
+                    xs = np.arange(0, IMG_WIDTH, step)
+                rows.append(y * IMG_WIDTH + xs)
+            step //= 2
+        progressive_index = np.concatenate(rows)
+    return progressive_index
+
+def next_request(link):
+    """Next request frame from a phone as (command, seq, arguments), None if no whole frame is waiting.
+    Line rate negotiation frames are answered here and never returned."""
+    ser = link.ser
+    while True:
+        if not link.pending and ser.in_waiting > 0:
+            link.pending.extend(link.frames.feed(ser.read(ser.in_waiting)))
+            link.last_rx = time.monotonic()
+
+        # A partial frame the line went quiet on is a cut off one (or a length that was corrupted)
+        elif not link.pending and link.frames.buf and time.monotonic() - link.last_rx > proto.IDLE_S:
+            link.pending.extend(link.frames.idle())
+        link.line_rate.check(ser)
+
+        if not link.pending:
+            return None
+        request = link.pending.pop(0)
+        if not link.line_rate.handle(ser, *request):
+            return request
+
+def send_text(ser, command, seq, text, age=None):
+    """Text reply, a frame echoing the request with only the bytes of the text. A cached reply carries the
+    age of its data after proto.AGE_SEP, the text is cut so the age always fits."""
+    suffix = b'' if age is None else proto.AGE_SEP + str(age).encode('ascii')
+    body = text.encode('utf-8')[:LOCATION_BUF_SIZE - 1 - len(suffix)]
+    ser.write(proto.frame(command, seq, body + suffix))
+
+def log(link, text):
+    """Request log line, tagged with the phone it is for"""
+    if LOG_REQUESTS:
+        print(f"[{link.name}] {text}")
+
+def keep_photo(link, frame):
+    """Holds on to the frame of the photo just sent so the phone can zoom into it"""
+    link.photo_frame = frame
+    link.photo_views.clear()
+
+def photo_tile(link, zoom, x, y, w, h):
+    """Rectangle of the phone's last photo scaled by zoom, as RGB565 (black past the edges or without a photo)"""
+    if zoom not in link.photo_views:
+        if link.photo_frame is None:
+            link.photo_views[zoom] = np.zeros((IMG_HEIGHT * zoom, IMG_WIDTH * zoom), dtype=np.uint16)
         else:
-            return "Loc: Unknown Region"
-    except:
-        return "Loc: Unavailable"
-
-def get_weather():
-    """Returns the weather from the current location via an online API, returns unknown, error, or offline upon an error"""
-    try:
-
-        # Ping API for weather with small timeout
-        url = "http://wttr.in?format=%l|%C|%t|%h|%w"
-
-        # Read data
-        response = requests.get(url, timeout=2)
-        
-        # Wait until data is properly recieved
-        if response.status_code == 200:
-
-            # Read data
-            raw = response.text
-
-            # Remove degree symbol since it cannot be printed with the library
-            clean = raw.replace('°', '').replace('+', '')
-            clean = clean.encode('ascii', 'ignore').decode('ascii')
-            
-            # Split data into parts to be formatted in thread post-transmission
-            parts = clean.split('|')
-            if len(parts) >= 5:
-                city_raw = parts[0].strip()
-                cond = parts[1].strip()
-                temp = parts[2].strip()
-                hum  = parts[3].strip()
-                wind = parts[4].strip()
-                
-                # Abbreviate State
-                for state, abbr in STATE_MAP.items():
-                    if state in city_raw:
-                        city_raw = city_raw.replace(state, abbr)
-                        break
-                
-                # Return result
-                final_str = f"{city_raw}\n{temp}\n{cond}\nHum:{hum} Wind:{wind}"
-                return final_str
-            else:
-                return "Unknown\n--\nError\n--"
+            link.photo_views[zoom] = frame_to_rgb565(link.photo_frame, zoom=zoom)
+    view = link.photo_views[zoom]
+
+    tile = np.zeros((h, w), dtype=np.uint16)
+    part = view[y:y + h, x:x + w]
+    tile[:part.shape[0], :part.shape[1]] = part
+    return tile
+
+def encode_video_frame(link, rgb565, keyframe):
+    """Encodes the blocks of a packed frame that changed since the last frame sent to the phone (every block for
+    a key frame). The frame is shared by every phone and only read."""
+    n = IMG_WIDTH // VIDEO_BLOCK
+
+    # Difference per block, channels scaled to 5 bits so green does not count double
+    video_prev = link.video_prev
+    if keyframe or video_prev is None:
+        changed = np.ones((n, n), dtype=bool)
+        video_prev = link.video_prev = rgb565.copy()
+    else:
+        cur = rgb565.astype(np.int32)
+        old = video_prev.astype(np.int32)
+        diff = (np.abs((cur >> 11) - (old >> 11)) + (np.abs(((cur >> 5) & 0x3F) - ((old >> 5) & 0x3F)) >> 1) +
+                np.abs((cur & 0x1F) - (old & 0x1F)))
+        score = diff.reshape(n, VIDEO_BLOCK, n, VIDEO_BLOCK).mean(axis=(1, 3))
+        changed = score > VIDEO_THRESHOLD
+    by, bx = np.nonzero(changed)
+
+    # Blocks in (row, column, y, x) order, rows flipped so the lowest screen row goes first
+    blocks = rgb565.reshape(n, VIDEO_BLOCK, n, VIDEO_BLOCK).transpose(0, 2, 1, 3)[by, bx, ::-1, :]
+
+    # Only the blocks sent are what the MCU now shows
+    for row, col in zip(by, bx):
+        ys, xs = row * VIDEO_BLOCK, col * VIDEO_BLOCK
+        video_prev[ys:ys + VIDEO_BLOCK, xs:xs + VIDEO_BLOCK] = rgb565[ys:ys + VIDEO_BLOCK, xs:xs + VIDEO_BLOCK]
+
+    # Record: column, row, pixels big endian
+    records = np.empty((len(by), 2 + VIDEO_BLOCK * VIDEO_BLOCK * 2), dtype=np.uint8)
+    records[:, 0] = bx
+    records[:, 1] = by
+    records[:, 2:] = np.ascontiguousarray(blocks, dtype='>u2').view(np.uint8).reshape(len(by), VIDEO_BLOCK * VIDEO_BLOCK * 2)
+    return struct.pack('>H', len(by)) + records.tobytes()
+
+# ********************************** PIPELINE **********************************
+
+class FrameRing:
+    """Newest frames of the capture thread, numbered from 1. Requests take the newest one at once instead of
+    waiting for the camera, the detection worker waits for the next one."""
+
+    def __init__(self, slots=FRAME_SLOTS):
+        self.slots = [None] * slots
+        self.count = 0
+        self.cond = threading.Condition()
+
+    def put(self, frame):
+        with self.cond:
+            self.count += 1
+            self.slots[self.count % len(self.slots)] = (frame, time.monotonic(), self.count)
+            self.cond.notify_all()
+
+    def latest(self):
+        """(frame, capture time, number) of the newest frame, None before the first"""
+        with self.cond:
+            return self.slots[self.count % len(self.slots)] if self.count else None
+
+    def wait(self, after, timeout):
+        """Newest frame once there is one numbered past after, None on timeout"""
+        with self.cond:
+            if not self.cond.wait_for(lambda: self.count > after, timeout):
+                return None
+            return self.slots[self.count % len(self.slots)]
+
+class Latency:
+    """Time spent per stage in ms (capture, detect, frame age, serve per command), reported every STATS_S"""
+
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.stages = {}
+        self.since = time.monotonic()
+
+    def add(self, stage, ms):
+        with self.lock:
+            count, total, worst = self.stages.get(stage, (0, 0.0, 0.0))
+            self.stages[stage] = (count + 1, total + ms, max(worst, ms))
+
+    def report(self):
+        """Prints and resets the stages once STATS_S has passed"""
+        if time.monotonic() - self.since < STATS_S:
+            return
+        with self.lock:
+            stages, self.stages = self.stages, {}
+            self.since = time.monotonic()
+        for stage, (count, total, worst) in sorted(stages.items()):
+            print(f"[latency] {stage:<12} {count:5d} x  avg {total / count:7.1f} ms  max {worst:7.1f} ms")
+
+latency = Latency()
+
+class FrameEncoder:
+    """Photo encodings of the newest camera frame, shared by every phone. The first link to ask for an encoding
+    of a frame makes it while the others wait on it, so N phones asking for the same frame cost one encode.
+    Results are immutable (bytes, or arrays and memoryviews of arrays no one writes), they outlive the packer
+    buffers they came from."""
+
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.number = 0             # Frame the encodings are of
+        self.encodings = {}         # Kind to [done event, result]
+        self.counts = {}            # Kind to [encoded, shared]
+        self.since = time.monotonic()
+
+    def get(self, item, kind, encode):
+        """Encoding of a ring item (frame, capture time, number), encode(frame) makes it if no link has yet"""
+        frame, _, number = item
+        with self.lock:
+            if number > self.number:
+                self.number = number
+                self.encodings = {}
+            shared = SHARE_ENCODINGS and number == self.number
+            entry = self.encodings.get(kind) if shared else None
+            owner = entry is None
+            if owner:
+                entry = [threading.Event(), None]
+                if shared:
+                    self.encodings[kind] = entry
+            counts = self.counts.setdefault(kind, [0, 0])
+            counts[0 if owner else 1] += 1
+
+        if owner:
+            start = time.perf_counter()
+            try:
+                entry[1] = encode(frame)
+            finally:
+                entry[0].set()
+            latency.add('encode ' + kind, (time.perf_counter() - start) * 1000)
         else:
-            return "Error\n--\nAPI Fail\n--"
-    except:
-        return "Offline\n--\nNo Conn\n--"
-
-
-def convert_to_rgb565(frame):
-    """Converts a frame photo to RGB565 Hexadecimal encoding for proper screen display and faster transmission"""
-
-    # Resize photo
-    frame = cv2.resize(frame, (IMG_WIDTH, IMG_HEIGHT))
-    frame = cv2.flip(frame, 1)
-
-    # Split frame into red, green, blue
-    b, g, r = cv2.split(frame)
+            entry[0].wait()
+        if entry[1] is None:
+            raise RuntimeError(f"encoding {kind} failed")
+        return entry[1]
+
+    def report(self):
+        """Prints how many encodings were made and how many were handed out again once STATS_S has passed"""
+        if time.monotonic() - self.since < STATS_S:
+            return
+        with self.lock:
+            counts, self.counts = self.counts, {}
+            self.since = time.monotonic()
+        if counts:
+            print("[encode] " + "  ".join(f"{kind} {made} made {shared} shared" for kind, (made, shared)
+                                          in sorted(counts.items())))
+
+encoder = FrameEncoder()
+
+class Link:
+    """One phone: its port, request frames, line rate, lock state and what it was last sent. Only the link's
+    own serial thread touches it. The state goes offline -> locked when the port opens, locked -> unlocked on
+    a face confirmed after the link locked (or a 'U' from the phone), and back offline when the port fails,
+    so a phone that reboots has to see a face again."""
+
+    def __init__(self, port):
+        self.port = port
+        self.name = port[5:] if port.startswith('/dev/') else port
+        self.ser = None
+        self.state = STATE_OFFLINE
+        self.lock_mark = 0
+        self.warned = False
+
+    def open(self):
+        """Opens the port and starts the phone locked with fresh protocol state"""
+        self.ser = serial.Serial(self.port, BAUD_RATE, timeout=0.1)
+
+        # Request frames from the MCU, and the ones already received but not yet handled
+        self.frames = proto.Reader()
+        self.pending = []
+        self.last_rx = 0.0
+        self.line_rate = proto.LineRate(self.frames)
+
+        # Last video frame as the MCU shows it (RGB565), None until a key frame
+        self.video_prev = None
+
+        # Last photo at webcam resolution and its zoomed views (RGB565 by zoom), kept for tile requests
+        self.photo_frame = None
+        self.photo_views = {}
+
+        self.state = STATE_LOCKED
+        self.lock_mark = unlock_count
+        self.warned = False
+
+    def close(self):
+        try:
+            self.ser.close()
+        except Exception:
+            pass
+        self.ser = None
+        self.state = STATE_OFFLINE
+
+class FaceScheduler:
+    """Decides when and where the cascade runs. Every frame is shrunk for a frame difference; the cascade
+    only runs while there is motion (and for ACTIVE_HOLD_S after it), every IDLE_DETECT_S otherwise, and on
+    a pyramid level of the frame. Once a face is seen it runs inside the region around it until the face is
+    confirmed or lost."""
+
+    def __init__(self, cascade):
+        self.cascade = cascade
+        self.prev = None
+        self.active_until = 0.0
+        self.last_run = 0.0
+        self.onset = None           # Start of the activity that led to the face
+        self.roi = None             # Last face on the pyramid level, (x, y, w, h)
+        self.hits = 0
+        self.confirmed = False
+        self.counts = {'frames': 0, 'motion': 0, 'full': 0, 'roi': 0}
+        self.since = (time.monotonic(), time.thread_time(), time.process_time())
+
+    def rearm(self):
+        """Starts over after an unlock, a face still in view has to be confirmed again for the next one"""
+        self.confirmed = False
+        self.hits = 0
+        self.onset = None
+
+    def step(self, frame, stamp):
+        """Takes one frame, returns the faces found in frame coordinates, None if the cascade did not run"""
+        start = time.perf_counter()
+        self.counts['frames'] += 1
+        gray = cv2.cvtColor(frame, cv2.COLOR_BGR2GRAY)
+        while gray.shape[1] > DETECT_WIDTH:
+            gray = cv2.pyrDown(gray)
+        scale = frame.shape[1] / gray.shape[1]
+
+        # Motion, from frames shrunk well past their noise
+        tiny = cv2.resize(gray, MOTION_SIZE, interpolation=cv2.INTER_AREA)
+        moving = self.prev is None or cv2.absdiff(tiny, self.prev).mean() > MOTION_THRESHOLD
+        self.prev = tiny
+        if moving:
+            self.counts['motion'] += 1
+            if stamp >= self.active_until:
+                self.onset = stamp
+            self.active_until = stamp + ACTIVE_HOLD_S
+        latency.add('motion', (time.perf_counter() - start) * 1000)
+
+        # Rate follows activity: every frame while something moves or a face is tracked, rarely otherwise
+        if self.roi is None and stamp >= self.active_until and stamp - self.last_run < IDLE_DETECT_S:
+            return None
+        self.last_run = stamp
+
+        start = time.perf_counter()
+        x0 = y0 = 0
+        region = gray
+        if self.roi is not None:
+            x, y, w, h = self.roi
+            x0, y0 = max(0, int(x - w * ROI_MARGIN)), max(0, int(y - h * ROI_MARGIN))
+            region = gray[y0:int(y + h * (1 + ROI_MARGIN)), x0:int(x + w * (1 + ROI_MARGIN))]
+        stage = 'roi' if self.roi is not None else 'full'
+        faces = [(fx + x0, fy + y0, fw, fh) for (fx, fy, fw, fh) in self.cascade.detectMultiScale(region, 1.3, 5)]
+        self.counts[stage] += 1
+        latency.add('cascade ' + stage, (time.perf_counter() - start) * 1000)
+
+        # Track the largest face, a miss drops back to the whole frame
+        if faces:
+            if self.hits == 0 and self.onset is None:
+                self.onset = stamp
+            self.hits += 1
+            self.roi = max(faces, key=lambda f: f[2] * f[3])
+            if self.hits >= FACE_CONFIRM and not self.confirmed:
+                self.confirmed = True
+                latency.add('unlock', (time.monotonic() - self.onset) * 1000)
+        else:
+            self.hits = 0
+            self.roi = None
+            if stamp >= self.active_until:
+                self.onset = None
+        return [tuple(int(v * scale) for v in f) for f in faces]
+
+    def report(self):
+        """Prints the frame, motion and cascade counts and the CPU share of the detection thread and the whole
+        process once STATS_S has passed"""
+        wall, thread, process = self.since
+        now = (time.monotonic(), time.thread_time(), time.process_time())
+        if now[0] - wall < STATS_S:
+            return
+        self.since = now
+        c = self.counts
+        print(f"[detect] frames {c['frames']}  moving {c['motion']}  cascade {c['full']} full {c['roi']} roi  "
+              f"skipped {c['frames'] - c['full'] - c['roi']}  cpu {(now[1] - thread) * 100 / (now[0] - wall):.0f}% "
+              f"(process {(now[2] - process) * 100 / (now[0] - wall):.0f}%)")
+        self.counts = dict.fromkeys(c, 0)
+
+def fresh_frame(ring):
+    """Newest camera frame for a request as its ring item (frame, capture time, number), its age counts as the
+    frame age stage"""
+    item = ring.latest() or ring.wait(0, FRAME_WAIT_S)
+    if item is None:
+        raise RuntimeError("no camera frame")
+    latency.add('frame age', (time.monotonic() - item[1]) * 1000)
+    return item
+
+def serve_locked(link, ring, cmd, seq, args):
+    """Requests of the lock screen"""
+    ser = link.ser
+
+    # T represents MCU requesting Time
+    if cmd == 'T':
+
+        # Read the time and send to MCU
+        log(link, "Time Request Received.")
+        time_str = get_current_time()
+
+        # Send time
+        send_text(ser, cmd, seq, time_str)
+        log(link, f"Sent Time: {time_str}")
+
+    # Handle Unlock if MCU sends 'U' manually
+    elif cmd == 'U':
+        link.state = STATE_UNLOCKED
+
+def serve_unlocked(link, ring, command, seq, args):
+    """Requests of the apps, camera requests are served from the newest frame the capture thread has and its
+    encodings are shared with every other phone asking for the same frame"""
+    ser = link.ser
+
+    # Photo
+    if command == 'P':
+
+        # Newest photo from the camera, converted to RGB565
+        log(link, "Photo Request.")
+        item = fresh_frame(ring)
+        img_data = encoder.get(item, 'P', convert_to_rgb565)
+        keep_photo(link, item[0])
+
+        # Send photo to MCU
+        log(link, "Sending photo...")
+        ser.write(img_data)
+        log(link, "Done.")
+
+    # Progressive photo, a coarse 30x30 pass first and finer passes after it
+    elif command == 'R':
+        log(link, "Progressive Photo Request.")
+        item = fresh_frame(ring)
+        ser.write(encoder.get(item, 'R', lambda frame: convert_to_rgb565(frame, order=progressive_order())))
+        keep_photo(link, item[0])
+
+    # Packed photo, same frame as P through tools/codec.py
+    elif command == 'Z':
+        log(link, "Packed Photo Request.")
+        item = fresh_frame(ring)
+        img_data = encoder.get(item, 'Z', lambda frame: codec.encode(
+            local_packer().pack(frame, IMG_WIDTH, IMG_HEIGHT), CODEC_QUANT))
+        ser.write(img_data)
+        keep_photo(link, item[0])
+        log(link, f"Sent {len(img_data)} bytes ({IMG_WIDTH * IMG_HEIGHT * 2 / len(img_data):.1f}:1).")
+
+    # Tile of the last photo: zoom, then x, y, width and height in the zoomed view
+    elif command == 'G':
+        if len(args) == 9:
+            zoom, x, y, w, h = struct.unpack('>BHHHH', args)
+            if 1 <= zoom <= ZOOM_MAX and 0 < w <= IMG_WIDTH and 0 < h <= IMG_HEIGHT * zoom:
+                ser.write(codec.encode(photo_tile(link, zoom, x, y, w, h), CODEC_QUANT))
+
+    # Low resolution video, the MCU picks the scale from its frame times and upscales
+    elif command == 'L':
+        if len(args) == 1 and args[0] in VIDEO_SCALES:
+            scale = args[0]
+            ser.write(encoder.get(fresh_frame(ring), f'L{scale}',
+                                  lambda frame: convert_to_rgb565(frame, scale)))
+
+    # Video, K starts over with every block and V sends the blocks that changed since this phone's last frame
+    elif command == 'K' or command == 'V':
+        rgb565 = encoder.get(fresh_frame(ring), 'pixels', frame_to_rgb565)
+        ser.write(encode_video_frame(link, rgb565, command == 'K'))
+
+    # Compass Location
+    elif command == 'C':
+
+        # Read location from the cache
+        log(link, "Location Request.")
+        loc_str, age = cache.get('C')
+
+        # Send data to MCU
+        send_text(ser, command, seq, loc_str, age)
+        log(link, f"Sent: {loc_str} ({age} s old)")
+
+    # Weather
+    elif command == 'W':
+
+        # Read weather from the cache
+        log(link, "Weather Request.")
+        weath_str, age = cache.get('W')
+
+        # Send data to MCU
+        send_text(ser, command, seq, weath_str, age)
+        log(link, f"Sent ({age} s old):\n{weath_str}")
+
+# ********************************** THREADS **********************************
+
+def capture_loop(cap, ring):
+    """Capture thread, reads the camera as fast as it delivers into the frame ring"""
+    while True:
+        start = time.perf_counter()
+        ret, frame = cap.read()
+        if not ret:
+            time.sleep(FRAME_WAIT_S / 10)
+            continue
+        latency.add('capture', (time.perf_counter() - start) * 1000)
+        ring.put(frame)
+
+def detect_loop(ring, face_cascade, links):
+    """Detection worker, hands each new frame to the face scheduler while any phone is locked"""
+    global preview, unlock_count
+    scheduler = FaceScheduler(face_cascade)
+    faces = []
+    seen = 0
+    while True:
+        if not any(link.state == STATE_LOCKED for link in links):
+            time.sleep(SERIAL_POLL_S * 10)
+            continue
+        item = ring.wait(seen, FRAME_WAIT_S)
+        if item is None:
+            continue
+        frame, stamp, seen = item
+        found = scheduler.step(frame, stamp)
+        if found is not None:
+            faces = found
+        scheduler.report()
+
+        # Print a rectangle on each face, on a copy since requests may be sending this frame
+        shown = frame.copy() if faces else frame
+        for (x, y, w, h) in faces:
+            cv2.rectangle(shown, (x, y), (x+w, y+h), (255, 0, 0), 2)
+        preview = shown
+
+        # Face confirmed, the serial threads of the locked phones send the unlock
+        if scheduler.confirmed:
+            unlock_count += 1
+            scheduler.rearm()
+
+def serial_loop(link, ring):
+    """Serial thread of one phone, the only reader and writer of its port, answers each request as soon as it
+    arrives and reopens the port if it goes away"""
+    while True:
 
-    # Set the type for each variable (Python issue)
-    r = r.astype(np.uint16)
-    g = g.astype(np.uint16)
-    b = b.astype(np.uint16)
+        # Port missing or gone, retried until the phone is back
+        if link.state == STATE_OFFLINE:
+            try:
+                link.open()
+            except (serial.SerialException, OSError):
+                if not link.warned:
+                    print(f"Error: Could not open {link.port}, retrying")
+                    link.warned = True
+                time.sleep(RECONNECT_S)
+                continue
+            print(f"Connected to {link.port} at {BAUD_RATE}") # Output to termina connection state
+            print(f"--- {link.name} LOCKED: Show Face to Unlock ---")
+
+        try:
 
-    # Convert data to RGB565
-    rgb565 = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+            # Phone unlocked
+            if link.state == STATE_LOCKED and unlock_count > link.lock_mark:
 
-    # Return data
-    return rgb565.astype(np.dtype('>u2')).tobytes()
+                # Print output
+                print(f"[{link.name}] Face Detected! Unlocking...")
 
-def run_server():
-    """Function to run in tandem with Tiva board, recieving characters, pinging APIs and sending photos"""
-    global current_state
-    
-    # Connect to Tiva over serial
-    try:
-        ser = serial.Serial(SERIAL_PORT, BAUD_RATE, timeout=0.1)
-        print(f"Connected to {SERIAL_PORT} at {BAUD_RATE}") # Output to termina connection state
-    except:
-        print(f"Error: Could not open {SERIAL_PORT}")
-        return
+                # Send unlocked signal to MCU
+                link.ser.write(proto.frame('U', 0))
+                link.state = STATE_UNLOCKED
+                print(f"--- {link.name} UNLOCKED: Ready ---")
+
+            request = next_request(link)
+        except (serial.SerialException, OSError) as e:
+            print(f"[{link.name}] Port lost: {e}")
+            link.close()
+            continue
+        if not request:
+            time.sleep(SERIAL_POLL_S)
+            continue
+
+        # Request from serial
+        cmd, seq, args = request
+        start = time.perf_counter()
+        try:
+            if link.state == STATE_LOCKED:
+                serve_locked(link, ring, cmd, seq, args)
+            else:
+                serve_unlocked(link, ring, cmd, seq, args)
+
+        # Error handling
+        except Exception as e:
+            print(f"[{link.name}] Error: {e}")
+        latency.add('serve ' + cmd, (time.perf_counter() - start) * 1000)
+
+def start_server(ports, cap, face_cascade):
+    """Starts the shared capture, detection and web cache and a serial thread per port, returns the links and
+    the frame ring"""
+    links = [Link(port) for port in ports]
+    ring = FrameRing()
+
+    # Web data is fetched ahead of the requests for it
+    start_cache()
+
+    # Capture, detection and each phone's serial link run on their own, requests never wait behind the camera
+    # or another phone
+    threads = [(capture_loop, (cap, ring)), (detect_loop, (ring, face_cascade, links))]
+    threads += [(serial_loop, (link, ring)) for link in links]
+    for target, args in threads:
+        threading.Thread(target=target, args=args, daemon=True).start()
+    return links, ring
+
+def run_server(ports=None):
+    """Function to run in tandem with the Tiva boards, recieving characters, pinging APIs and sending photos.
+    Serves every port of SERIAL_PORTS (or ports) from one camera and one web cache."""
 
     # Run face detection software for unlocking phone
     face_cascade = cv2.CascadeClassifier(cv2.data.haarcascades + 'haarcascade_frontalface_default.xml')
     cap = cv2.VideoCapture(0)
+    links, _ = start_server(ports or SERIAL_PORTS, cap, face_cascade)
 
-    # Print to terminal for debugging and clarity
-    print("--- PHONE LOCKED: Show Face to Unlock ---")
-
-    # Main loop
+    # Main thread keeps the OpenCV window (it must stay on the main thread) and prints the latencies
+    shown = None
     while True:
-
-        # Read from serial
-        ret, frame = cap.read()
-        if not ret: continue
-
-        # Code to run for Lockscreen
-        if current_state == STATE_LOCKED:
-
-            # Default color
-            gray = cv2.cvtColor(frame, cv2.COLOR_BGR2GRAY)
-
-            # Detect each face
-            faces = face_cascade.detectMultiScale(gray, 1.3, 5)
-
-            # Print a rectangle on each face
-            for (x, y, w, h) in faces:
-                cv2.rectangle(frame, (x, y), (x+w, y+h), (255, 0, 0), 2)
+        if any(link.state == STATE_LOCKED for link in links):
 
             # Show scanner on Laptop
-            cv2.imshow("Face Scanner", frame)
-            
-            # Time Request Handler
-            if ser.in_waiting > 0:
-                try:
-
-                    # Read from serial
-                    cmd = ser.read().decode('utf-8', errors='ignore')
-
-                    # T represents MCU requesting Time
-                    if cmd == 'T': 
-
-                        # Read the time and send to MCU
-                        print("[MCU] Time Request Received.")
-                        time_str = get_current_time()
-                        t_bytes = time_str.encode('utf-8')
-                        
-                        # Pad with Nulls
-                        if len(t_bytes) < LOCATION_BUF_SIZE:
-                            t_bytes += b'\x00' * (LOCATION_BUF_SIZE - len(t_bytes))
-                        else:
-                            t_bytes = t_bytes[:LOCATION_BUF_SIZE]
-                            
-                        # Send time
-                        ser.write(t_bytes)
-                        print(f"Sent Time: {time_str}")
-                        
-                    # Handle Unlock if MCU sends 'U' manually
-                    elif cmd == 'U':
-                        current_state = STATE_UNLOCKED
-                        cv2.destroyAllWindows() # Delete Face scanner
-
-                # Error handling
-                except Exception as e:
-                    print(f"Error reading in Lock: {e}")
+            if preview is not None and preview is not shown:
+                shown = preview
+                cv2.imshow("Face Scanner", shown)
+        elif shown is not None:
+            shown = None
+            cv2.destroyAllWindows() # Delete Face scanner
+        latency.report()
+        encoder.report()
 
-            # Phone unlocked
-            if len(faces) > 0:
-
-                # Print output
-                print("Face Detected! Unlocking...")
-
-                # Send unlocked signal to MCU
-                ser.write(b'U')
-                current_state = STATE_UNLOCKED
-
-                # Delete window
-                cv2.destroyAllWindows()
-                print("--- PHONE UNLOCKED: Ready ---")
-
-                # Sleep
-                time.sleep(1)
-
-        # Unlocked
-        else:
-            if ser.in_waiting > 0:
-                try:
-                    # Read from serial
-                    command = ser.read().decode('utf-8', errors='ignore')
-                    
-                    # Photo
-                    if command == 'P': 
-
-                        # Read photo from camera and convert it to RGB565
-                        print("[MCU] Photo Request.")
-                        ret, frame = cap.read()
-                        img_data = convert_to_rgb565(frame)
-
-                        # Send photo to MCU
-                        print("Sending photo...")
-
-                        # Send data in 1024 byte packets
-                        CHUNK_SIZE = 1024
-                        for i in range(0, len(img_data), CHUNK_SIZE):
-                            ser.write(img_data[i:i+CHUNK_SIZE])
-                        print("Done.")
-
-                    # Compass Location
-                    elif command == 'C':
-
-                        # Read location
-                        print("[MCU] Location Request.")
-                        loc_str = get_device_location()
-                        loc_bytes = loc_str.encode('utf-8')
-
-                        # Send data to MCU
-                        if len(loc_bytes) < LOCATION_BUF_SIZE:
-                            loc_bytes += b'\x00' * (LOCATION_BUF_SIZE - len(loc_bytes))
-                        else:
-                            loc_bytes = loc_bytes[:LOCATION_BUF_SIZE]
-                        ser.write(loc_bytes)
-                        print(f"Sent: {loc_str}")
-
-                    # Weather
-                    elif command == 'W':
-
-                        # Read weather
-                        print("[MCU] Weather Request.")
-                        weath_str = get_weather()
-                        w_bytes = weath_str.encode('utf-8')
-
-                        # Send data to MCU
-                        if len(w_bytes) < LOCATION_BUF_SIZE:
-                            w_bytes += b'\x00' * (LOCATION_BUF_SIZE - len(w_bytes))
-                        else:
-                            w_bytes = w_bytes[:LOCATION_BUF_SIZE]
-                        ser.write(w_bytes)
-                        print(f"Sent:\n{weath_str}")
-
-                # Error handling
-                except Exception as e:
-                    print(f"Error: {e}")
-                    pass
-        
         # Keep OpenCV window responsive
         cv2.waitKey(1)
+        time.sleep(SERIAL_POLL_S * 10)
 
-# Run code
+# Run code, serial ports on the command line override PHONE_SERIAL_PORT
 if __name__ == "__main__":
-    run_server()
\ No newline at end of file
+    run_server(sys.argv[1:])
@@ -0,0 +1,112 @@
+// File: asset.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Streaming decoder for image assets produced by tools/asset_convert.py
+
+//************************************Includes***************************************/
+
+// Local Files
+#include "./asset.h"
+#include "./display.h"
+
+#include <stdbool.h>
+
+//*************************************Structures***************************************/
+
+// Decoder state, the stream is only ever read forwards
+typedef struct {
+    const asset_t *asset;
+    const uint8_t *src;     // Next byte of the encoded stream
+    uint8_t left;           // Pixels left in the current packet
+    bool run;               // Current packet is a run
+    uint16_t run_color;     // Color of the current run
+} asset_reader_t;
+
+//*************************************Helper Functions***************************************/
+
+/// @brief Reads one color (2 byte pixel or 1 byte palette index) from the stream
+static uint16_t asset_read_color(asset_reader_t *r) {
+    if (r->asset->encoding == ASSET_PAL_RLE) {
+        return r->asset->palette[*r->src++];
+    }
+    uint16_t color = (uint16_t)((r->src[0] << 8) | r->src[1]);
+    r->src += 2;
+    return color;
+}
+
+/// @brief Returns the next pixel of the asset
+static uint16_t asset_next(asset_reader_t *r) {
+
+    // Raw assets have no packets
+    if (r->asset->encoding == ASSET_RAW) {
+        return asset_read_color(r);
+    }
+
+    // Start a new packet
+    if (r->left == 0) {
+        uint8_t header = *r->src++;
+        r->left = (uint8_t)((header & ASSET_PACKET_COUNT) + 1);
+        r->run = (header & ASSET_PACKET_RUN) != 0;
+        if (r->run) {
+            r->run_color = asset_read_color(r);
+        }
+    }
+
+    r->left--;
+    return r->run ? r->run_color : asset_read_color(r);
+}
+
+/// @brief Decodes pixels into the open display window
+static void asset_write(asset_reader_t *r, uint32_t count) {
+    while (count--) {
+        display_stream_pixel(asset_next(r));
+    }
+}
+
+/// @brief Decodes and drops pixels that are off screen
+static void asset_skip(asset_reader_t *r, uint32_t count) {
+    while (count--) {
+        (void)asset_next(r);
+    }
+}
+
+//*************************************Public Functions***************************************/
+
+void asset_draw(int16_t x, int16_t y, const asset_t *asset) {
+    asset_reader_t reader = { asset, asset->data, 0, false, 0 };
+
+    // Visible rectangle
+    int32_t x0 = x, y0 = y;
+    int32_t x1 = x0 + asset->width, y1 = y0 + asset->height;
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > DISPLAY_WIDTH) x1 = DISPLAY_WIDTH;
+    if (y1 > DISPLAY_HEIGHT) y1 = DISPLAY_HEIGHT;
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    uint16_t vis_w = (uint16_t)(x1 - x0);
+    uint16_t vis_h = (uint16_t)(y1 - y0);
+    uint16_t col_skip = (uint16_t)(x0 - x);
+    uint16_t col_rest = (uint16_t)(asset->width - col_skip - vis_w);
+
+    display_stream_begin((int16_t)x0, (int16_t)y0, (int16_t)vis_w, (int16_t)vis_h);
+
+    // Fully visible, decode the whole stream straight into the window
+    if (vis_w == asset->width && vis_h == asset->height) {
+        asset_write(&reader, (uint32_t)vis_w * vis_h);
+    }
+
+    // Clipped, skip hidden rows and columns (clipping is done once per row)
+    else {
+        asset_skip(&reader, (uint32_t)(y0 - y) * asset->width);
+        for (uint16_t row = 0; row < vis_h; row++) {
+            asset_skip(&reader, col_skip);
+            asset_write(&reader, vis_w);
+            asset_skip(&reader, col_rest);
+        }
+    }
+
+    display_stream_end();
+}
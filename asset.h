@@ -0,0 +1,55 @@
+// File: asset.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Image assets produced by tools/asset_convert.py and their streaming decoder
+
+#ifndef ASSET_H_
+#define ASSET_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Asset encodings (must match tools/asset_convert.py)
+// All encodings store pixels big endian (panel order) with the lowest screen row first,
+// so the decoder writes straight into an address window with no swapping or flipping
+#define ASSET_RAW       0 // 2 bytes per pixel
+#define ASSET_RLE       1 // Packets of RGB565 pixels
+#define ASSET_PAL_RLE   2 // Packets of 1 byte palette indices
+
+// Packet header: bit 7 set = run of (n & 0x7F) + 1 copies of one pixel,
+// bit 7 clear = (n + 1) literal pixels follow
+#define ASSET_PACKET_RUN    0x80
+#define ASSET_PACKET_COUNT  0x7F
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    uint8_t encoding;           // ASSET_* encoding
+    const uint16_t *palette;    // Palette for ASSET_PAL_RLE, NULL otherwise
+    const uint8_t *data;        // Encoded pixel stream
+    uint32_t data_len;          // Length of the encoded stream in bytes
+} asset_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+/// @brief Decodes an asset straight into the display, clipped to the screen
+/// @param x X position of the asset
+/// @param y Y position of the asset
+/// @param asset Pointer to the asset
+void asset_draw(int16_t x, int16_t y, const asset_t *asset);
+
+/********************************Public Functions***********************************/
+
+#endif /* ASSET_H_ */
@@ -0,0 +1,112 @@
+// File: codec.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Streaming decoder for the packed photo format of tools/codec.py, a QOI style mix of runs,
+//              a recently seen color index and small deltas on RGB565, decoded straight into panel rows
+
+//************************************Includes***************************************/
+
+// Local Files
+#include "./codec.h"
+
+#include <string.h>
+
+//*************************************Defines***************************************/
+
+// Bytes of the op starting with tag
+#define CODEC_OP_BYTES(tag)     ((tag) == CODEC_OP_RGB ? 3u : ((tag) & 0xC0) == CODEC_OP_LUMA ? 2u : 1u)
+
+#define CODEC_HASH(px)          ((((px) >> 11) * 3u + (((px) >> 5) & 0x3Fu) * 5u + ((px) & 0x1Fu) * 7u) & 0x3Fu)
+
+//*************************************Public Functions***************************************/
+
+void codec_init(codec_t *c) {
+    memset(c, 0, sizeof(*c));
+}
+
+uint32_t codec_decode(codec_t *c, const uint8_t *in, uint32_t len, uint8_t *out, uint32_t pixels, uint32_t *used) {
+    uint32_t i = 0;
+    uint32_t n = 0;
+    uint16_t px = c->prev;
+
+    while (n < pixels) {
+
+        // A run may span rows, finish it first
+        if (c->run) {
+            uint32_t k = pixels - n < c->run ? pixels - n : c->run;
+            uint8_t hi = (uint8_t)(px >> 8);
+            uint8_t lo = (uint8_t)px;
+            c->run -= (uint8_t)k;
+            n += k;
+            while (k--) {
+                *out++ = hi;
+                *out++ = lo;
+            }
+            continue;
+        }
+        if (i == len) {
+            break;
+        }
+
+        // Next op, whole from the input when it fits, otherwise gathered across calls
+        uint8_t tag, b1 = 0, b2 = 0;
+        if (c->have) {
+            c->op[c->have++] = in[i++];
+            if (c->have < CODEC_OP_BYTES(c->op[0])) {
+                continue;
+            }
+            tag = c->op[0];
+            b1 = c->op[1];
+            b2 = c->op[2];
+            c->have = 0;
+        } else {
+            tag = in[i];
+            uint32_t size = CODEC_OP_BYTES(tag);
+            if (len - i < size) {
+                while (i < len) {
+                    c->op[c->have++] = in[i++];
+                }
+                break;
+            }
+            if (size > 1) b1 = in[i + 1];
+            if (size > 2) b2 = in[i + 2];
+            i += size;
+        }
+
+        // Most ops of a photo are deltas, check for them before the rarer ones
+        if ((tag & 0xC0) == CODEC_OP_DIFF) {
+            uint16_t r = (uint16_t)(((px >> 11) + (tag >> 4 & 0x03) - 2) & 0x1F);
+            uint16_t g = (uint16_t)((((px >> 5) & 0x3F) + (tag >> 2 & 0x03) - 2) & 0x3F);
+            uint16_t b = (uint16_t)(((px & 0x1F) + (tag & 0x03) - 2) & 0x1F);
+            px = (uint16_t)((r << 11) | (g << 5) | b);
+            c->index[CODEC_HASH(px)] = px;
+        } else if ((tag & 0xC0) == CODEC_OP_LUMA) {
+            uint16_t raw = tag & 0x3F;
+            int16_t half = (int16_t)((raw >> 1) - 16);      // dg / 2 rounded down
+            uint16_t r = (uint16_t)(((px >> 11) + (b1 >> 4) - 8 + half) & 0x1F);
+            uint16_t g = (uint16_t)((((px >> 5) & 0x3F) + raw - 32) & 0x3F);
+            uint16_t b = (uint16_t)(((px & 0x1F) + (b1 & 0x0F) - 8 + half) & 0x1F);
+            px = (uint16_t)((r << 11) | (g << 5) | b);
+            c->index[CODEC_HASH(px)] = px;
+        } else if ((tag & 0xC0) == CODEC_OP_INDEX) {
+            px = c->index[tag];
+        } else if (tag == CODEC_OP_RGB) {
+            px = (uint16_t)((b1 << 8) | b2);
+            c->index[CODEC_HASH(px)] = px;
+        } else if (tag == CODEC_OP_RESERVED) {
+            c->error = true;
+            break;
+        } else {
+            c->run = (uint8_t)((tag & 0x3F) + 1);
+            continue;
+        }
+
+        *out++ = (uint8_t)(px >> 8);
+        *out++ = (uint8_t)px;
+        n++;
+    }
+
+    c->prev = px;
+    *used = i;
+    return n;
+}
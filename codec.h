@@ -0,0 +1,73 @@
+// File: codec.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Streaming decoder for the packed photo format of tools/codec.py, a QOI style mix of runs,
+//              a recently seen color index and small deltas on RGB565, decoded straight into panel rows
+
+#ifndef CODEC_H_
+#define CODEC_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Stream: payload length (u32 big endian), then one op per pixel or run of pixels.
+// The previous pixel starts at 0 (black) and every index entry starts at 0.
+//   00iiiiii              INDEX  pixel = index[i]
+//   01rrggbb              DIFF   dr, dg, db in -2..1 (stored + 2)
+//   10gggggg rrrrbbbb     LUMA   dg in -32..31 (stored + 32), dr - dg/2 and db - dg/2 in -8..7 (stored + 8)
+//   11llllll              RUN    previous pixel l + 1 times (1..62)
+//   11111110 hi lo        RGB    pixel as is
+//   11111111              reserved, decoding stops with an error
+// Deltas wrap around in each channel, dg/2 rounds towards minus infinity.
+// Every decoded pixel is stored in index[(r * 3 + g * 5 + b * 7) % 64] (5, 6, 5 bit channels).
+#define CODEC_HEADER_BYTES  4
+#define CODEC_INDEX_SIZE    64
+#define CODEC_MAX_RUN       62
+
+#define CODEC_OP_INDEX      0x00
+#define CODEC_OP_DIFF       0x40
+#define CODEC_OP_LUMA       0x80
+#define CODEC_OP_RUN        0xC0
+#define CODEC_OP_RGB        0xFE
+#define CODEC_OP_RESERVED   0xFF
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+// Decoder state, 136 bytes, carries ops and runs across input chunks and output rows
+typedef struct {
+    uint16_t index[CODEC_INDEX_SIZE];   // Recently seen colors by hash
+    uint16_t prev;                      // Last pixel written
+    uint8_t op[3];                      // Op split across two input chunks
+    uint8_t have;                       // Bytes of op read so far
+    uint8_t run;                        // Pixels of the current run still to write
+    bool error;                         // A reserved op was read
+} codec_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+/// @brief Resets the decoder for a new image
+void codec_init(codec_t *c);
+
+/// @brief Decodes until the input is used up or the output is full, whichever comes first
+/// @param c Decoder state
+/// @param in Encoded bytes (payload only, without the length header)
+/// @param len Number of encoded bytes
+/// @param out Pixels as big endian RGB565 bytes, ready for display_stream_write
+/// @param pixels Room in out, in pixels
+/// @param used Returns the number of encoded bytes consumed
+/// @return Number of pixels written (less than pixels if the input ran out or c->error was set)
+uint32_t codec_decode(codec_t *c, const uint8_t *in, uint32_t len, uint8_t *out, uint32_t pixels, uint32_t *used);
+
+/********************************Public Functions***********************************/
+
+#endif /* CODEC_H_ */
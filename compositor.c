@@ -0,0 +1,258 @@
+// File: compositor.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Opt-in dirty tile compositor, merges a frame of rectangle and text operations
+//              into one final color per pixel and only sends the damaged spans to the ST7789
+
+//************************************Includes***************************************/
+
+// Local Files
+#include "./compositor.h"
+#include "./font5x7.h"
+#include "./text.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+//*************************************Defines***************************************/
+
+#define COMP_OP_RECT    0
+#define COMP_OP_TEXT    1
+
+//*************************************Structures***************************************/
+
+// One recorded operation, bounds are in screen coordinates (lowest Y first)
+typedef struct {
+    uint8_t type;
+    uint8_t size;       // Text size
+    int16_t x, y;       // Bottom left corner of the bounds
+    int16_t w, h;       // Size of the bounds
+    uint16_t color;
+    uint16_t text;      // Offset of the string in the text pool
+    uint8_t text_len;
+} comp_op_t;
+
+//*************************************Variables***************************************/
+
+static comp_op_t ops[COMP_MAX_OPS];
+static uint8_t num_ops = 0;
+
+static char text_pool[COMP_TEXT_POOL];
+static uint16_t text_used = 0;
+
+// One bit per tile, bit N of row T is tile (N, T)
+static uint16_t dirty[COMP_TILES_Y];
+
+// Line buffer for resolving one row of a dirty span
+static uint16_t line_color[DISPLAY_WIDTH];
+static bool line_covered[DISPLAY_WIDTH];
+
+//*************************************Helper Functions***************************************/
+
+/// @brief Marks every tile under a rectangle as dirty
+static void comp_damage(int16_t x, int16_t y, int16_t w, int16_t h) {
+    int32_t x0 = x, y0 = y, x1 = (int32_t)x + w, y1 = (int32_t)y + h;
+
+    // Clip to the screen
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > DISPLAY_WIDTH) x1 = DISPLAY_WIDTH;
+    if (y1 > DISPLAY_HEIGHT) y1 = DISPLAY_HEIGHT;
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    // Tile range
+    uint16_t tx0 = (uint16_t)(x0 / COMP_TILE_SIZE);
+    uint16_t tx1 = (uint16_t)((x1 - 1) / COMP_TILE_SIZE);
+    uint16_t mask = (uint16_t)(((1u << (tx1 + 1)) - 1) & ~((1u << tx0) - 1));
+
+    for (int32_t ty = y0 / COMP_TILE_SIZE; ty <= (y1 - 1) / COMP_TILE_SIZE; ty++) {
+        dirty[ty] |= mask;
+    }
+}
+
+/// @brief Paints every operation that touches a row segment into the line buffer
+/// @param y Screen row
+/// @param xa First column (inclusive)
+/// @param xb Last column (exclusive)
+/// @return True if every pixel of the segment is covered by an operation
+static bool comp_resolve_row(int16_t y, int16_t xa, int16_t xb) {
+    memset(&line_covered[xa], 0, (size_t)(xb - xa));
+
+    // Painter's order, the last operation touching a pixel wins
+    for (uint8_t i = 0; i < num_ops; i++) {
+        const comp_op_t *op = &ops[i];
+        if (y < op->y || y >= op->y + op->h) {
+            continue;
+        }
+
+        int16_t start = op->x > xa ? op->x : xa;
+        int16_t end = (op->x + op->w) < xb ? (int16_t)(op->x + op->w) : xb;
+
+        if (op->type == COMP_OP_RECT) {
+            for (int16_t px = start; px < end; px++) {
+                line_color[px] = op->color;
+                line_covered[px] = true;
+            }
+        } else {
+
+            // Glyph row, row 0 is at the top of the bounds (highest Y)
+            uint8_t row = (uint8_t)((op->y + op->h - 1 - y) / op->size);
+            uint16_t cell = (uint16_t)(FONT_CELL_WIDTH * op->size);
+            if (start >= end) {
+                continue;
+            }
+
+            // Walk the atlas rows of the characters under the segment
+            uint16_t rel = (uint16_t)(start - op->x);
+            uint16_t ch = rel / cell;
+            uint32_t bits = text_glyph_row(text_pool[op->text + ch], row, op->size) >> (rel % cell);
+            uint16_t left = (uint16_t)(cell - rel % cell);
+            for (int16_t px = start; px < end; px++) {
+                if (left == 0) {
+                    bits = text_glyph_row(text_pool[op->text + ++ch], row, op->size);
+                    left = cell;
+                }
+                if (bits & 1) {
+                    line_color[px] = op->color;
+                    line_covered[px] = true;
+                }
+                bits >>= 1;
+                left--;
+            }
+        }
+    }
+
+    for (int16_t px = xa; px < xb; px++) {
+        if (!line_covered[px]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @brief Sends the covered runs of the line buffer, one window per run
+static void comp_send_row(int16_t y, int16_t xa, int16_t xb) {
+    int16_t px = xa;
+    while (px < xb) {
+
+        // Skip uncovered pixels, the panel keeps its content there
+        while (px < xb && !line_covered[px]) px++;
+        int16_t start = px;
+        while (px < xb && line_covered[px]) px++;
+
+        if (px > start) {
+            display_stream_begin(start, y, px - start, 1);
+            for (int16_t i = start; i < px; i++) {
+                display_stream_pixel(line_color[i]);
+            }
+            display_stream_end();
+        }
+    }
+}
+
+/// @brief Resolves and sends one horizontal run of dirty tiles
+static void comp_flush_span(int16_t xa, int16_t xb, int16_t ya, int16_t yb) {
+    bool full = true;
+
+    // Fully covered spans (the usual case of a clear plus text) go out as one window
+    for (int16_t y = ya; y < yb && full; y++) {
+        full = comp_resolve_row(y, xa, xb);
+    }
+
+    if (full) {
+        display_stream_begin(xa, ya, xb - xa, yb - ya);
+        for (int16_t y = ya; y < yb; y++) {
+            comp_resolve_row(y, xa, xb);
+            for (int16_t px = xa; px < xb; px++) {
+                display_stream_pixel(line_color[px]);
+            }
+        }
+        display_stream_end();
+        return;
+    }
+
+    // Partially covered, send the covered runs of each row
+    for (int16_t y = ya; y < yb; y++) {
+        comp_resolve_row(y, xa, xb);
+        comp_send_row(y, xa, xb);
+    }
+}
+
+//*************************************Public Functions***************************************/
+
+void comp_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (w <= 0 || h <= 0) {
+        return;
+    }
+    if (num_ops == COMP_MAX_OPS) {
+        comp_flush();
+    }
+
+    ops[num_ops++] = (comp_op_t){ COMP_OP_RECT, 1, x, y, w, h, color, 0, 0 };
+    comp_damage(x, y, w, h);
+}
+
+void comp_text(int16_t x, int16_t y, const char *str, uint8_t size, uint16_t color) {
+    size_t len = strlen(str);
+
+    // Text stops at the first newline, like one display_print run
+    const char *newline = strchr(str, '\n');
+    if (newline) {
+        len = (size_t)(newline - str);
+    }
+    if (len == 0 || size == 0) {
+        return;
+    }
+    if (size > TEXT_MAX_SIZE) {
+        size = TEXT_MAX_SIZE;
+    }
+    if (len > COMP_TEXT_POOL) {
+        len = COMP_TEXT_POOL;
+    }
+    if (len > 255) {
+        len = 255;
+    }
+    if (num_ops == COMP_MAX_OPS || text_used + len > COMP_TEXT_POOL) {
+        comp_flush();
+    }
+
+    memcpy(&text_pool[text_used], str, len);
+
+    // Bounds, glyphs extend down from the cursor
+    int16_t w = (int16_t)(len * FONT_CELL_WIDTH * size);
+    int16_t h = (int16_t)(FONT_CELL_HEIGHT * size);
+    ops[num_ops++] = (comp_op_t){ COMP_OP_TEXT, size, x, (int16_t)(y - h + 1), w, h, color, text_used, (uint8_t)len };
+    text_used += (uint16_t)len;
+    comp_damage(x, (int16_t)(y - h + 1), w, h);
+}
+
+void comp_flush(void) {
+
+    // Walk each tile row, merging neighbouring dirty tiles into one span
+    for (uint16_t ty = 0; ty < COMP_TILES_Y; ty++) {
+        uint16_t mask = dirty[ty];
+        int16_t ya = (int16_t)(ty * COMP_TILE_SIZE);
+        int16_t yb = (int16_t)(ya + COMP_TILE_SIZE > DISPLAY_HEIGHT ? DISPLAY_HEIGHT : ya + COMP_TILE_SIZE);
+
+        uint16_t tx = 0;
+        while (mask >> tx) {
+            if (!(mask & (1u << tx))) {
+                tx++;
+                continue;
+            }
+            uint16_t start = tx;
+            while (tx < COMP_TILES_X && (mask & (1u << tx))) tx++;
+
+            int16_t xa = (int16_t)(start * COMP_TILE_SIZE);
+            int16_t xb = (int16_t)(tx * COMP_TILE_SIZE > DISPLAY_WIDTH ? DISPLAY_WIDTH : tx * COMP_TILE_SIZE);
+            comp_flush_span(xa, xb, ya, yb);
+        }
+        dirty[ty] = 0;
+    }
+
+    // Start a new frame
+    num_ops = 0;
+    text_used = 0;
+}
@@ -0,0 +1,60 @@
+// File: compositor.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Opt-in dirty tile compositor, merges a frame of rectangle and text operations
+//              into one final color per pixel and only sends the damaged spans to the ST7789
+
+#ifndef COMPOSITOR_H_
+#define COMPOSITOR_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+#include "./display.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Damage is tracked in square tiles
+#define COMP_TILE_SIZE      16
+#define COMP_TILES_X        ((DISPLAY_WIDTH + COMP_TILE_SIZE - 1) / COMP_TILE_SIZE)
+#define COMP_TILES_Y        ((DISPLAY_HEIGHT + COMP_TILE_SIZE - 1) / COMP_TILE_SIZE)
+
+// Operations recorded per frame, the frame is flushed early if either runs out
+#define COMP_MAX_OPS        48
+#define COMP_TEXT_POOL      256
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+// Usage (hold sem_Display from the first call until comp_flush returns):
+//   comp_rect(0, 60, 240, 60, COLOR_BG);
+//   comp_text(30, 100, time_buffer, 4, COLOR_TEXT);
+//   comp_flush();
+// Pixels covered by no operation are left untouched on the panel.
+
+/// @brief Records a filled rectangle
+/// @param x X position (may be off screen)
+/// @param y Y position (may be off screen)
+/// @param w Width
+/// @param h Height
+/// @param color RGB565 color
+void comp_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+/// @brief Records transparent text, placed like display_setCursor / display_print
+/// @param x Cursor X position
+/// @param y Cursor Y position (glyphs extend towards lower Y)
+/// @param str String to print (copied, single line)
+/// @param size Text size (1 = 6x8 pixel cells, at most TEXT_MAX_SIZE)
+/// @param color RGB565 text color
+void comp_text(int16_t x, int16_t y, const char *str, uint8_t size, uint16_t color);
+
+/// @brief Resolves the recorded operations and sends the dirty spans, then starts a new frame
+void comp_flush(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* COMPOSITOR_H_ */
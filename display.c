@@ -0,0 +1,140 @@
+// File: display.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Burst drawing helpers for the ST7789 (address window set once per rectangle)
+
+//************************************Includes***************************************/
+
+// Local Files
+#include "./display.h"
+#include "./MultimodDrivers/multimod.h"
+
+//*************************************Helper Functions***************************************/
+
+/// @brief Clips a rectangle to the screen
+/// @param x Pointer to the X position, updated to the first visible column
+/// @param y Pointer to the Y position, updated to the first visible row
+/// @param w Pointer to the width, updated to the visible width
+/// @param h Pointer to the height, updated to the visible height
+/// @return False if nothing is visible
+static bool display_clip(int16_t *x, int16_t *y, int16_t *w, int16_t *h) {
+
+    // Use 32 bit math so large rectangles do not overflow
+    int32_t x0 = *x;
+    int32_t y0 = *y;
+    int32_t x1 = x0 + *w;
+    int32_t y1 = y0 + *h;
+
+    // Clip each edge
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > DISPLAY_WIDTH) x1 = DISPLAY_WIDTH;
+    if (y1 > DISPLAY_HEIGHT) y1 = DISPLAY_HEIGHT;
+
+    // Fully off screen
+    if (x0 >= x1 || y0 >= y1) {
+        return false;
+    }
+
+    *x = (int16_t)x0;
+    *y = (int16_t)y0;
+    *w = (int16_t)(x1 - x0);
+    *h = (int16_t)(y1 - y0);
+    return true;
+}
+
+//*************************************Public Functions***************************************/
+
+void display_blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t *pixels, uint8_t flags) {
+
+    // Visible rectangle
+    int16_t vx = x, vy = y, vw = w, vh = h;
+    if (!display_clip(&vx, &vy, &vw, &vh)) {
+        return;
+    }
+
+    // Offsets of the visible rectangle inside the source
+    uint16_t col_skip = (uint16_t)(vx - x);
+    uint16_t row_skip = (uint16_t)(vy - y);
+
+    // Set the window once for the whole visible rectangle
+    ST7789_Select();
+    ST7789_SetWindow(vx, vy, vw, vh);
+
+    // The panel fills the window from the lowest Y upwards, pick the source row for each screen row
+    for (uint16_t r = 0; r < (uint16_t)vh; r++) {
+        uint16_t src_row = row_skip + r;
+        if (flags & DISPLAY_BLIT_FLIP_Y) {
+            src_row = (uint16_t)(h - 1 - src_row);
+        }
+
+        // Clipping is done once per row, the run itself is streamed without checks
+        const uint8_t *src = pixels + ((uint32_t)src_row * (uint16_t)w + col_skip) * 2;
+        const uint8_t *end = src + (uint32_t)vw * 2;
+
+        if (flags & DISPLAY_BLIT_LE) {
+            // Swap each byte pair into panel order
+            while (src < end) {
+                ST7789_WriteData(src[1]);
+                ST7789_WriteData(src[0]);
+                src += 2;
+            }
+        } else {
+            // Already in panel order
+            while (src < end) {
+                ST7789_WriteData(*src++);
+            }
+        }
+    }
+
+    ST7789_Deselect();
+}
+
+void display_fill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+
+    // Visible rectangle
+    if (!display_clip(&x, &y, &w, &h)) {
+        return;
+    }
+
+    uint8_t high_byte = (uint8_t)(color >> 8);
+    uint8_t low_byte  = (uint8_t)(color & 0xFF);
+    uint32_t count = (uint32_t)w * (uint16_t)h;
+
+    // One window, one burst
+    ST7789_Select();
+    ST7789_SetWindow(x, y, w, h);
+    while (count--) {
+        ST7789_WriteData(high_byte);
+        ST7789_WriteData(low_byte);
+    }
+    ST7789_Deselect();
+}
+
+bool display_stream_begin(int16_t x, int16_t y, int16_t w, int16_t h) {
+
+    // Callers push exactly w * h pixels, so the window must not be clipped
+    if (x < 0 || y < 0 || w <= 0 || h <= 0 ||
+        x + w > DISPLAY_WIDTH || y + h > DISPLAY_HEIGHT) {
+        return false;
+    }
+
+    ST7789_Select();
+    ST7789_SetWindow(x, y, w, h);
+    return true;
+}
+
+void display_stream_write(const uint8_t *data, uint32_t len) {
+    while (len--) {
+        ST7789_WriteData(*data++);
+    }
+}
+
+void display_stream_pixel(uint16_t color) {
+    ST7789_WriteData((uint8_t)(color >> 8));
+    ST7789_WriteData((uint8_t)(color & 0xFF));
+}
+
+void display_stream_end(void) {
+    ST7789_Deselect();
+}
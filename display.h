@@ -0,0 +1,70 @@
+// File: display.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Burst drawing helpers for the ST7789 (address window set once per rectangle)
+
+#ifndef DISPLAY_H_
+#define DISPLAY_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Panel dimensions
+#define DISPLAY_WIDTH           240
+#define DISPLAY_HEIGHT          280
+
+// Blit source flags
+#define DISPLAY_BLIT_NATIVE     0x00 // Big endian pixels, first row is the lowest Y
+#define DISPLAY_BLIT_LE         0x01 // Pixels stored as little endian byte pairs
+#define DISPLAY_BLIT_FLIP_Y     0x02 // First row of the source is drawn at the highest Y
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+/// @brief Draws a bitmap with one address window for the visible part of the rectangle
+/// @param x X position of the bitmap (may be negative or off screen)
+/// @param y Y position of the bitmap (may be negative or off screen)
+/// @param w Width of the bitmap
+/// @param h Height of the bitmap
+/// @param pixels Pointer to w * h RGB565 pixels stored as byte pairs
+/// @param flags DISPLAY_BLIT_* flags describing the source layout
+void display_blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t *pixels, uint8_t flags);
+
+/// @brief Fills a rectangle with a single color, clipped to the screen
+/// @param x X position of the rectangle (may be negative or off screen)
+/// @param y Y position of the rectangle (may be negative or off screen)
+/// @param w Width of the rectangle
+/// @param h Height of the rectangle
+/// @param color RGB565 color
+void display_fill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+/// @brief Opens an address window for streaming pixels, clipped to the screen
+/// @param x X position of the window
+/// @param y Y position of the window
+/// @param w Width of the window
+/// @param h Height of the window
+/// @return False if the window is fully off screen or partially clipped (nothing is opened)
+bool display_stream_begin(int16_t x, int16_t y, int16_t w, int16_t h);
+
+/// @brief Streams raw panel order bytes (high byte first) into the open window
+/// @param data Pointer to the bytes
+/// @param len Number of bytes
+void display_stream_write(const uint8_t *data, uint32_t len);
+
+/// @brief Streams a single RGB565 pixel into the open window
+/// @param color RGB565 color
+void display_stream_pixel(uint16_t color);
+
+/// @brief Closes the streaming window
+void display_stream_end(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* DISPLAY_H_ */
@@ -0,0 +1,44 @@
+// File: font5x7.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: 5x7 font matching the GFX library, used by the compositor and text renderers
+
+#ifndef FONT5X7_H_
+#define FONT5X7_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Printable ASCII only
+#define FONT_FIRST_CHAR     0x20
+#define FONT_LAST_CHAR      0x7E
+
+// Glyph cell, 5 columns of pixels plus 1 column of spacing, 8 rows (row 0 is bit 0)
+#define FONT_GLYPH_COLS     5
+#define FONT_CELL_WIDTH     6
+#define FONT_CELL_HEIGHT    8
+
+/*************************************Defines***************************************/
+
+/***********************************Variables***************************************/
+
+// One byte per column, bit 0 is the top row
+extern const uint8_t font5x7[FONT_LAST_CHAR - FONT_FIRST_CHAR + 1][FONT_GLYPH_COLS];
+
+/***********************************Variables***************************************/
+
+/********************************Public Functions***********************************/
+
+/// @brief Returns the glyph columns for a character (unprintable characters use '?')
+/// @param c Character
+/// @return Pointer to FONT_GLYPH_COLS column bytes
+const uint8_t *font_glyph(char c);
+
+/********************************Public Functions***********************************/
+
+#endif /* FONT5X7_H_ */
@@ -0,0 +1,397 @@
+// File: glyph_atlas.c
+// Generated by tools/glyph_atlas.py from font5x7.c, do not edit
+// Description: 5x7 font pre-scaled horizontally for text sizes 1, 2, 4 and 5
+
+#include "./glyph_atlas.h"
+
+const uint8_t glyph_atlas_1[GLYPH_ATLAS_GLYPHS][GLYPH_ATLAS_ROWS] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // ' '
+    {0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x00}, // '!'
+    {0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00}, // '"'
+    {0x0A, 0x0A, 0x1F, 0x0A, 0x1F, 0x0A, 0x0A, 0x00}, // '#'
+    {0x04, 0x1E, 0x05, 0x0E, 0x14, 0x0F, 0x04, 0x00}, // '$'
+    {0x03, 0x13, 0x08, 0x04, 0x02, 0x19, 0x18, 0x00}, // '%'
+    {0x02, 0x05, 0x05, 0x02, 0x15, 0x09, 0x16, 0x00}, // '&'
+    {0x0C, 0x0C, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00}, // '''
+    {0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08, 0x00}, // '('
+    {0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02, 0x00}, // ')'
+    {0x04, 0x15, 0x0E, 0x1F, 0x0E, 0x15, 0x04, 0x00}, // '*'
+    {0x00, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00, 0x00}, // '+'
+    {0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x04, 0x02}, // ','
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00}, // '-'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00}, // '.'
+    {0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00}, // '/'
+    {0x0E, 0x11, 0x19, 0x15, 0x13, 0x11, 0x0E, 0x00}, // '0'
+    {0x04, 0x06, 0x04, 0x04, 0x04, 0x04, 0x0E, 0x00}, // '1'
+    {0x0E, 0x11, 0x10, 0x0E, 0x01, 0x01, 0x1F, 0x00}, // '2'
+    {0x1F, 0x10, 0x08, 0x0C, 0x10, 0x11, 0x0E, 0x00}, // '3'
+    {0x08, 0x0C, 0x0A, 0x09, 0x1F, 0x08, 0x08, 0x00}, // '4'
+    {0x1F, 0x01, 0x0F, 0x10, 0x10, 0x11, 0x0E, 0x00}, // '5'
+    {0x1C, 0x02, 0x01, 0x0F, 0x11, 0x11, 0x0E, 0x00}, // '6'
+    {0x1F, 0x10, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00}, // '7'
+    {0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E, 0x00}, // '8'
+    {0x0E, 0x11, 0x11, 0x1E, 0x10, 0x08, 0x07, 0x00}, // '9'
+    {0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00}, // ':'
+    {0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x02, 0x00}, // ';'
+    {0x10, 0x08, 0x04, 0x02, 0x04, 0x08, 0x10, 0x00}, // '<'
+    {0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00}, // '='
+    {0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02, 0x00}, // '>'
+    {0x0E, 0x11, 0x10, 0x0C, 0x04, 0x00, 0x04, 0x00}, // '?'
+    {0x0E, 0x11, 0x15, 0x1D, 0x0D, 0x01, 0x1E, 0x00}, // '@'
+    {0x04, 0x0A, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x00}, // 'A'
+    {0x0F, 0x11, 0x11, 0x0F, 0x11, 0x11, 0x0F, 0x00}, // 'B'
+    {0x0E, 0x11, 0x01, 0x01, 0x01, 0x11, 0x0E, 0x00}, // 'C'
+    {0x0F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0F, 0x00}, // 'D'
+    {0x1F, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x1F, 0x00}, // 'E'
+    {0x1F, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x01, 0x00}, // 'F'
+    {0x1E, 0x11, 0x01, 0x01, 0x19, 0x11, 0x1E, 0x00}, // 'G'
+    {0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11, 0x00}, // 'H'
+    {0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E, 0x00}, // 'I'
+    {0x1C, 0x08, 0x08, 0x08, 0x08, 0x09, 0x06, 0x00}, // 'J'
+    {0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11, 0x00}, // 'K'
+    {0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1F, 0x00}, // 'L'
+    {0x11, 0x1B, 0x15, 0x15, 0x15, 0x11, 0x11, 0x00}, // 'M'
+    {0x11, 0x11, 0x13, 0x15, 0x19, 0x11, 0x11, 0x00}, // 'N'
+    {0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E, 0x00}, // 'O'
+    {0x0F, 0x11, 0x11, 0x0F, 0x01, 0x01, 0x01, 0x00}, // 'P'
+    {0x0E, 0x11, 0x11, 0x11, 0x15, 0x09, 0x16, 0x00}, // 'Q'
+    {0x0F, 0x11, 0x11, 0x0F, 0x05, 0x09, 0x11, 0x00}, // 'R'
+    {0x0E, 0x11, 0x01, 0x0E, 0x10, 0x11, 0x0E, 0x00}, // 'S'
+    {0x1F, 0x15, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00}, // 'T'
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E, 0x00}, // 'U'
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04, 0x00}, // 'V'
+    {0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A, 0x00}, // 'W'
+    {0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11, 0x00}, // 'X'
+    {0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x00}, // 'Y'
+    {0x1F, 0x10, 0x08, 0x0E, 0x02, 0x01, 0x1F, 0x00}, // 'Z'
+    {0x1E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x1E, 0x00}, // '['
+    {0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00}, // '\'
+    {0x1E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x00}, // ']'
+    {0x04, 0x0A, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00}, // '^'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00}, // '_'
+    {0x06, 0x06, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00}, // '`'
+    {0x00, 0x00, 0x06, 0x08, 0x0E, 0x09, 0x1E, 0x00}, // 'a'
+    {0x01, 0x01, 0x0D, 0x13, 0x11, 0x13, 0x0D, 0x00}, // 'b'
+    {0x00, 0x00, 0x0E, 0x11, 0x01, 0x11, 0x0E, 0x00}, // 'c'
+    {0x10, 0x10, 0x16, 0x19, 0x11, 0x19, 0x16, 0x00}, // 'd'
+    {0x00, 0x00, 0x0E, 0x11, 0x1F, 0x01, 0x0E, 0x00}, // 'e'
+    {0x08, 0x14, 0x04, 0x0E, 0x04, 0x04, 0x04, 0x00}, // 'f'
+    {0x00, 0x00, 0x0E, 0x19, 0x19, 0x16, 0x10, 0x0E}, // 'g'
+    {0x01, 0x01, 0x0D, 0x13, 0x11, 0x11, 0x11, 0x00}, // 'h'
+    {0x04, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0E, 0x00}, // 'i'
+    {0x08, 0x00, 0x08, 0x08, 0x08, 0x09, 0x06, 0x00}, // 'j'
+    {0x01, 0x01, 0x09, 0x05, 0x03, 0x05, 0x09, 0x00}, // 'k'
+    {0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E, 0x00}, // 'l'
+    {0x00, 0x00, 0x0B, 0x15, 0x15, 0x15, 0x15, 0x00}, // 'm'
+    {0x00, 0x00, 0x0D, 0x13, 0x11, 0x11, 0x11, 0x00}, // 'n'
+    {0x00, 0x00, 0x0E, 0x11, 0x11, 0x11, 0x0E, 0x00}, // 'o'
+    {0x00, 0x00, 0x0D, 0x13, 0x13, 0x0D, 0x01, 0x01}, // 'p'
+    {0x00, 0x00, 0x16, 0x19, 0x19, 0x16, 0x10, 0x10}, // 'q'
+    {0x00, 0x00, 0x0D, 0x13, 0x01, 0x01, 0x01, 0x00}, // 'r'
+    {0x00, 0x00, 0x1E, 0x01, 0x0E, 0x10, 0x0F, 0x00}, // 's'
+    {0x04, 0x04, 0x1F, 0x04, 0x04, 0x14, 0x08, 0x00}, // 't'
+    {0x00, 0x00, 0x11, 0x11, 0x11, 0x19, 0x16, 0x00}, // 'u'
+    {0x00, 0x00, 0x11, 0x11, 0x11, 0x0A, 0x04, 0x00}, // 'v'
+    {0x00, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0A, 0x00}, // 'w'
+    {0x00, 0x00, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x00}, // 'x'
+    {0x00, 0x00, 0x11, 0x11, 0x1E, 0x10, 0x11, 0x0E}, // 'y'
+    {0x00, 0x00, 0x1F, 0x08, 0x04, 0x02, 0x1F, 0x00}, // 'z'
+    {0x08, 0x04, 0x04, 0x02, 0x04, 0x04, 0x08, 0x00}, // '{'
+    {0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x00}, // '|'
+    {0x02, 0x04, 0x04, 0x08, 0x04, 0x04, 0x02, 0x00}, // '}'
+    {0x02, 0x15, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00}, // '~'
+};
+
+const uint16_t glyph_atlas_2[GLYPH_ATLAS_GLYPHS][GLYPH_ATLAS_ROWS] = {
+    {0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000}, // ' '
+    {0x030, 0x030, 0x030, 0x030, 0x030, 0x000, 0x030, 0x000}, // '!'
+    {0x0CC, 0x0CC, 0x0CC, 0x000, 0x000, 0x000, 0x000, 0x000}, // '"'
+    {0x0CC, 0x0CC, 0x3FF, 0x0CC, 0x3FF, 0x0CC, 0x0CC, 0x000}, // '#'
+    {0x030, 0x3FC, 0x033, 0x0FC, 0x330, 0x0FF, 0x030, 0x000}, // '$'
+    {0x00F, 0x30F, 0x0C0, 0x030, 0x00C, 0x3C3, 0x3C0, 0x000}, // '%'
+    {0x00C, 0x033, 0x033, 0x00C, 0x333, 0x0C3, 0x33C, 0x000}, // '&'
+    {0x0F0, 0x0F0, 0x030, 0x00C, 0x000, 0x000, 0x000, 0x000}, // '''
+    {0x0C0, 0x030, 0x00C, 0x00C, 0x00C, 0x030, 0x0C0, 0x000}, // '('
+    {0x00C, 0x030, 0x0C0, 0x0C0, 0x0C0, 0x030, 0x00C, 0x000}, // ')'
+    {0x030, 0x333, 0x0FC, 0x3FF, 0x0FC, 0x333, 0x030, 0x000}, // '*'
+    {0x000, 0x030, 0x030, 0x3FF, 0x030, 0x030, 0x000, 0x000}, // '+'
+    {0x000, 0x000, 0x000, 0x000, 0x0F0, 0x0F0, 0x030, 0x00C}, // ','
+    {0x000, 0x000, 0x000, 0x3FF, 0x000, 0x000, 0x000, 0x000}, // '-'
+    {0x000, 0x000, 0x000, 0x000, 0x000, 0x0F0, 0x0F0, 0x000}, // '.'
+    {0x000, 0x300, 0x0C0, 0x030, 0x00C, 0x003, 0x000, 0x000}, // '/'
+    {0x0FC, 0x303, 0x3C3, 0x333, 0x30F, 0x303, 0x0FC, 0x000}, // '0'
+    {0x030, 0x03C, 0x030, 0x030, 0x030, 0x030, 0x0FC, 0x000}, // '1'
+    {0x0FC, 0x303, 0x300, 0x0FC, 0x003, 0x003, 0x3FF, 0x000}, // '2'
+    {0x3FF, 0x300, 0x0C0, 0x0F0, 0x300, 0x303, 0x0FC, 0x000}, // '3'
+    {0x0C0, 0x0F0, 0x0CC, 0x0C3, 0x3FF, 0x0C0, 0x0C0, 0x000}, // '4'
+    {0x3FF, 0x003, 0x0FF, 0x300, 0x300, 0x303, 0x0FC, 0x000}, // '5'
+    {0x3F0, 0x00C, 0x003, 0x0FF, 0x303, 0x303, 0x0FC, 0x000}, // '6'
+    {0x3FF, 0x300, 0x300, 0x0C0, 0x030, 0x00C, 0x003, 0x000}, // '7'
+    {0x0FC, 0x303, 0x303, 0x0FC, 0x303, 0x303, 0x0FC, 0x000}, // '8'
+    {0x0FC, 0x303, 0x303, 0x3FC, 0x300, 0x0C0, 0x03F, 0x000}, // '9'
+    {0x000, 0x000, 0x030, 0x000, 0x030, 0x000, 0x000, 0x000}, // ':'
+    {0x000, 0x000, 0x030, 0x000, 0x030, 0x030, 0x00C, 0x000}, // ';'
+    {0x300, 0x0C0, 0x030, 0x00C, 0x030, 0x0C0, 0x300, 0x000}, // '<'
+    {0x000, 0x000, 0x3FF, 0x000, 0x3FF, 0x000, 0x000, 0x000}, // '='
+    {0x00C, 0x030, 0x0C0, 0x300, 0x0C0, 0x030, 0x00C, 0x000}, // '>'
+    {0x0FC, 0x303, 0x300, 0x0F0, 0x030, 0x000, 0x030, 0x000}, // '?'
+    {0x0FC, 0x303, 0x333, 0x3F3, 0x0F3, 0x003, 0x3FC, 0x000}, // '@'
+    {0x030, 0x0CC, 0x303, 0x303, 0x3FF, 0x303, 0x303, 0x000}, // 'A'
+    {0x0FF, 0x303, 0x303, 0x0FF, 0x303, 0x303, 0x0FF, 0x000}, // 'B'
+    {0x0FC, 0x303, 0x003, 0x003, 0x003, 0x303, 0x0FC, 0x000}, // 'C'
+    {0x0FF, 0x303, 0x303, 0x303, 0x303, 0x303, 0x0FF, 0x000}, // 'D'
+    {0x3FF, 0x003, 0x003, 0x0FF, 0x003, 0x003, 0x3FF, 0x000}, // 'E'
+    {0x3FF, 0x003, 0x003, 0x0FF, 0x003, 0x003, 0x003, 0x000}, // 'F'
+    {0x3FC, 0x303, 0x003, 0x003, 0x3C3, 0x303, 0x3FC, 0x000}, // 'G'
+    {0x303, 0x303, 0x303, 0x3FF, 0x303, 0x303, 0x303, 0x000}, // 'H'
+    {0x0FC, 0x030, 0x030, 0x030, 0x030, 0x030, 0x0FC, 0x000}, // 'I'
+    {0x3F0, 0x0C0, 0x0C0, 0x0C0, 0x0C0, 0x0C3, 0x03C, 0x000}, // 'J'
+    {0x303, 0x0C3, 0x033, 0x00F, 0x033, 0x0C3, 0x303, 0x000}, // 'K'
+    {0x003, 0x003, 0x003, 0x003, 0x003, 0x003, 0x3FF, 0x000}, // 'L'
+    {0x303, 0x3CF, 0x333, 0x333, 0x333, 0x303, 0x303, 0x000}, // 'M'
+    {0x303, 0x303, 0x30F, 0x333, 0x3C3, 0x303, 0x303, 0x000}, // 'N'
+    {0x0FC, 0x303, 0x303, 0x303, 0x303, 0x303, 0x0FC, 0x000}, // 'O'
+    {0x0FF, 0x303, 0x303, 0x0FF, 0x003, 0x003, 0x003, 0x000}, // 'P'
+    {0x0FC, 0x303, 0x303, 0x303, 0x333, 0x0C3, 0x33C, 0x000}, // 'Q'
+    {0x0FF, 0x303, 0x303, 0x0FF, 0x033, 0x0C3, 0x303, 0x000}, // 'R'
+    {0x0FC, 0x303, 0x003, 0x0FC, 0x300, 0x303, 0x0FC, 0x000}, // 'S'
+    {0x3FF, 0x333, 0x030, 0x030, 0x030, 0x030, 0x030, 0x000}, // 'T'
+    {0x303, 0x303, 0x303, 0x303, 0x303, 0x303, 0x0FC, 0x000}, // 'U'
+    {0x303, 0x303, 0x303, 0x303, 0x303, 0x0CC, 0x030, 0x000}, // 'V'
+    {0x303, 0x303, 0x303, 0x333, 0x333, 0x333, 0x0CC, 0x000}, // 'W'
+    {0x303, 0x303, 0x0CC, 0x030, 0x0CC, 0x303, 0x303, 0x000}, // 'X'
+    {0x303, 0x303, 0x0CC, 0x030, 0x030, 0x030, 0x030, 0x000}, // 'Y'
+    {0x3FF, 0x300, 0x0C0, 0x0FC, 0x00C, 0x003, 0x3FF, 0x000}, // 'Z'
+    {0x3FC, 0x00C, 0x00C, 0x00C, 0x00C, 0x00C, 0x3FC, 0x000}, // '['
+    {0x000, 0x003, 0x00C, 0x030, 0x0C0, 0x300, 0x000, 0x000}, // '\'
+    {0x3FC, 0x300, 0x300, 0x300, 0x300, 0x300, 0x3FC, 0x000}, // ']'
+    {0x030, 0x0CC, 0x303, 0x000, 0x000, 0x000, 0x000, 0x000}, // '^'
+    {0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x3FF, 0x000}, // '_'
+    {0x03C, 0x03C, 0x030, 0x0C0, 0x000, 0x000, 0x000, 0x000}, // '`'
+    {0x000, 0x000, 0x03C, 0x0C0, 0x0FC, 0x0C3, 0x3FC, 0x000}, // 'a'
+    {0x003, 0x003, 0x0F3, 0x30F, 0x303, 0x30F, 0x0F3, 0x000}, // 'b'
+    {0x000, 0x000, 0x0FC, 0x303, 0x003, 0x303, 0x0FC, 0x000}, // 'c'
+    {0x300, 0x300, 0x33C, 0x3C3, 0x303, 0x3C3, 0x33C, 0x000}, // 'd'
+    {0x000, 0x000, 0x0FC, 0x303, 0x3FF, 0x003, 0x0FC, 0x000}, // 'e'
+    {0x0C0, 0x330, 0x030, 0x0FC, 0x030, 0x030, 0x030, 0x000}, // 'f'
+    {0x000, 0x000, 0x0FC, 0x3C3, 0x3C3, 0x33C, 0x300, 0x0FC}, // 'g'
+    {0x003, 0x003, 0x0F3, 0x30F, 0x303, 0x303, 0x303, 0x000}, // 'h'
+    {0x030, 0x000, 0x03C, 0x030, 0x030, 0x030, 0x0FC, 0x000}, // 'i'
+    {0x0C0, 0x000, 0x0C0, 0x0C0, 0x0C0, 0x0C3, 0x03C, 0x000}, // 'j'
+    {0x003, 0x003, 0x0C3, 0x033, 0x00F, 0x033, 0x0C3, 0x000}, // 'k'
+    {0x03C, 0x030, 0x030, 0x030, 0x030, 0x030, 0x0FC, 0x000}, // 'l'
+    {0x000, 0x000, 0x0CF, 0x333, 0x333, 0x333, 0x333, 0x000}, // 'm'
+    {0x000, 0x000, 0x0F3, 0x30F, 0x303, 0x303, 0x303, 0x000}, // 'n'
+    {0x000, 0x000, 0x0FC, 0x303, 0x303, 0x303, 0x0FC, 0x000}, // 'o'
+    {0x000, 0x000, 0x0F3, 0x30F, 0x30F, 0x0F3, 0x003, 0x003}, // 'p'
+    {0x000, 0x000, 0x33C, 0x3C3, 0x3C3, 0x33C, 0x300, 0x300}, // 'q'
+    {0x000, 0x000, 0x0F3, 0x30F, 0x003, 0x003, 0x003, 0x000}, // 'r'
+    {0x000, 0x000, 0x3FC, 0x003, 0x0FC, 0x300, 0x0FF, 0x000}, // 's'
+    {0x030, 0x030, 0x3FF, 0x030, 0x030, 0x330, 0x0C0, 0x000}, // 't'
+    {0x000, 0x000, 0x303, 0x303, 0x303, 0x3C3, 0x33C, 0x000}, // 'u'
+    {0x000, 0x000, 0x303, 0x303, 0x303, 0x0CC, 0x030, 0x000}, // 'v'
+    {0x000, 0x000, 0x303, 0x303, 0x333, 0x333, 0x0CC, 0x000}, // 'w'
+    {0x000, 0x000, 0x303, 0x0CC, 0x030, 0x0CC, 0x303, 0x000}, // 'x'
+    {0x000, 0x000, 0x303, 0x303, 0x3FC, 0x300, 0x303, 0x0FC}, // 'y'
+    {0x000, 0x000, 0x3FF, 0x0C0, 0x030, 0x00C, 0x3FF, 0x000}, // 'z'
+    {0x0C0, 0x030, 0x030, 0x00C, 0x030, 0x030, 0x0C0, 0x000}, // '{'
+    {0x030, 0x030, 0x030, 0x000, 0x030, 0x030, 0x030, 0x000}, // '|'
+    {0x00C, 0x030, 0x030, 0x0C0, 0x030, 0x030, 0x00C, 0x000}, // '}'
+    {0x00C, 0x333, 0x0C0, 0x000, 0x000, 0x000, 0x000, 0x000}, // '~'
+};
+
+const uint32_t glyph_atlas_4[GLYPH_ATLAS_GLYPHS][GLYPH_ATLAS_ROWS] = {
+    {0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000}, // ' '
+    {0x000F00, 0x000F00, 0x000F00, 0x000F00, 0x000F00, 0x000000, 0x000F00, 0x000000}, // '!'
+    {0x00F0F0, 0x00F0F0, 0x00F0F0, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000}, // '"'
+    {0x00F0F0, 0x00F0F0, 0x0FFFFF, 0x00F0F0, 0x0FFFFF, 0x00F0F0, 0x00F0F0, 0x000000}, // '#'
+    {0x000F00, 0x0FFFF0, 0x000F0F, 0x00FFF0, 0x0F0F00, 0x00FFFF, 0x000F00, 0x000000}, // '$'
+    {0x0000FF, 0x0F00FF, 0x00F000, 0x000F00, 0x0000F0, 0x0FF00F, 0x0FF000, 0x000000}, // '%'
+    {0x0000F0, 0x000F0F, 0x000F0F, 0x0000F0, 0x0F0F0F, 0x00F00F, 0x0F0FF0, 0x000000}, // '&'
+    {0x00FF00, 0x00FF00, 0x000F00, 0x0000F0, 0x000000, 0x000000, 0x000000, 0x000000}, // '''
+    {0x00F000, 0x000F00, 0x0000F0, 0x0000F0, 0x0000F0, 0x000F00, 0x00F000, 0x000000}, // '('
+    {0x0000F0, 0x000F00, 0x00F000, 0x00F000, 0x00F000, 0x000F00, 0x0000F0, 0x000000}, // ')'
+    {0x000F00, 0x0F0F0F, 0x00FFF0, 0x0FFFFF, 0x00FFF0, 0x0F0F0F, 0x000F00, 0x000000}, // '*'
+    {0x000000, 0x000F00, 0x000F00, 0x0FFFFF, 0x000F00, 0x000F00, 0x000000, 0x000000}, // '+'
+    {0x000000, 0x000000, 0x000000, 0x000000, 0x00FF00, 0x00FF00, 0x000F00, 0x0000F0}, // ','
+    {0x000000, 0x000000, 0x000000, 0x0FFFFF, 0x000000, 0x000000, 0x000000, 0x000000}, // '-'
+    {0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x00FF00, 0x00FF00, 0x000000}, // '.'
+    {0x000000, 0x0F0000, 0x00F000, 0x000F00, 0x0000F0, 0x00000F, 0x000000, 0x000000}, // '/'
+    {0x00FFF0, 0x0F000F, 0x0FF00F, 0x0F0F0F, 0x0F00FF, 0x0F000F, 0x00FFF0, 0x000000}, // '0'
+    {0x000F00, 0x000FF0, 0x000F00, 0x000F00, 0x000F00, 0x000F00, 0x00FFF0, 0x000000}, // '1'
+    {0x00FFF0, 0x0F000F, 0x0F0000, 0x00FFF0, 0x00000F, 0x00000F, 0x0FFFFF, 0x000000}, // '2'
+    {0x0FFFFF, 0x0F0000, 0x00F000, 0x00FF00, 0x0F0000, 0x0F000F, 0x00FFF0, 0x000000}, // '3'
+    {0x00F000, 0x00FF00, 0x00F0F0, 0x00F00F, 0x0FFFFF, 0x00F000, 0x00F000, 0x000000}, // '4'
+    {0x0FFFFF, 0x00000F, 0x00FFFF, 0x0F0000, 0x0F0000, 0x0F000F, 0x00FFF0, 0x000000}, // '5'
+    {0x0FFF00, 0x0000F0, 0x00000F, 0x00FFFF, 0x0F000F, 0x0F000F, 0x00FFF0, 0x000000}, // '6'
+    {0x0FFFFF, 0x0F0000, 0x0F0000, 0x00F000, 0x000F00, 0x0000F0, 0x00000F, 0x000000}, // '7'
+    {0x00FFF0, 0x0F000F, 0x0F000F, 0x00FFF0, 0x0F000F, 0x0F000F, 0x00FFF0, 0x000000}, // '8'
+    {0x00FFF0, 0x0F000F, 0x0F000F, 0x0FFFF0, 0x0F0000, 0x00F000, 0x000FFF, 0x000000}, // '9'
+    {0x000000, 0x000000, 0x000F00, 0x000000, 0x000F00, 0x000000, 0x000000, 0x000000}, // ':'
+    {0x000000, 0x000000, 0x000F00, 0x000000, 0x000F00, 0x000F00, 0x0000F0, 0x000000}, // ';'
+    {0x0F0000, 0x00F000, 0x000F00, 0x0000F0, 0x000F00, 0x00F000, 0x0F0000, 0x000000}, // '<'
+    {0x000000, 0x000000, 0x0FFFFF, 0x000000, 0x0FFFFF, 0x000000, 0x000000, 0x000000}, // '='
+    {0x0000F0, 0x000F00, 0x00F000, 0x0F0000, 0x00F000, 0x000F00, 0x0000F0, 0x000000}, // '>'
+    {0x00FFF0, 0x0F000F, 0x0F0000, 0x00FF00, 0x000F00, 0x000000, 0x000F00, 0x000000}, // '?'
+    {0x00FFF0, 0x0F000F, 0x0F0F0F, 0x0FFF0F, 0x00FF0F, 0x00000F, 0x0FFFF0, 0x000000}, // '@'
+    {0x000F00, 0x00F0F0, 0x0F000F, 0x0F000F, 0x0FFFFF, 0x0F000F, 0x0F000F, 0x000000}, // 'A'
+    {0x00FFFF, 0x0F000F, 0x0F000F, 0x00FFFF, 0x0F000F, 0x0F000F, 0x00FFFF, 0x000000}, // 'B'
+    {0x00FFF0, 0x0F000F, 0x00000F, 0x00000F, 0x00000F, 0x0F000F, 0x00FFF0, 0x000000}, // 'C'
+    {0x00FFFF, 0x0F000F, 0x0F000F, 0x0F000F, 0x0F000F, 0x0F000F, 0x00FFFF, 0x000000}, // 'D'
+    {0x0FFFFF, 0x00000F, 0x00000F, 0x00FFFF, 0x00000F, 0x00000F, 0x0FFFFF, 0x000000}, // 'E'
+    {0x0FFFFF, 0x00000F, 0x00000F, 0x00FFFF, 0x00000F, 0x00000F, 0x00000F, 0x000000}, // 'F'
+    {0x0FFFF0, 0x0F000F, 0x00000F, 0x00000F, 0x0FF00F, 0x0F000F, 0x0FFFF0, 0x000000}, // 'G'
+    {0x0F000F, 0x0F000F, 0x0F000F, 0x0FFFFF, 0x0F000F, 0x0F000F, 0x0F000F, 0x000000}, // 'H'
+    {0x00FFF0, 0x000F00, 0x000F00, 0x000F00, 0x000F00, 0x000F00, 0x00FFF0, 0x000000}, // 'I'
+    {0x0FFF00, 0x00F000, 0x00F000, 0x00F000, 0x00F000, 0x00F00F, 0x000FF0, 0x000000}, // 'J'
+    {0x0F000F, 0x00F00F, 0x000F0F, 0x0000FF, 0x000F0F, 0x00F00F, 0x0F000F, 0x000000}, // 'K'
+    {0x00000F, 0x00000F, 0x00000F, 0x00000F, 0x00000F, 0x00000F, 0x0FFFFF, 0x000000}, // 'L'
+    {0x0F000F, 0x0FF0FF, 0x0F0F0F, 0x0F0F0F, 0x0F0F0F, 0x0F000F, 0x0F000F, 0x000000}, // 'M'
+    {0x0F000F, 0x0F000F, 0x0F00FF, 0x0F0F0F, 0x0FF00F, 0x0F000F, 0x0F000F, 0x000000}, // 'N'
+    {0x00FFF0, 0x0F000F, 0x0F000F, 0x0F000F, 0x0F000F, 0x0F000F, 0x00FFF0, 0x000000}, // 'O'
+    {0x00FFFF, 0x0F000F, 0x0F000F, 0x00FFFF, 0x00000F, 0x00000F, 0x00000F, 0x000000}, // 'P'
+    {0x00FFF0, 0x0F000F, 0x0F000F, 0x0F000F, 0x0F0F0F, 0x00F00F, 0x0F0FF0, 0x000000}, // 'Q'
+    {0x00FFFF, 0x0F000F, 0x0F000F, 0x00FFFF, 0x000F0F, 0x00F00F, 0x0F000F, 0x000000}, // 'R'
+    {0x00FFF0, 0x0F000F, 0x00000F, 0x00FFF0, 0x0F0000, 0x0F000F, 0x00FFF0, 0x000000}, // 'S'
+    {0x0FFFFF, 0x0F0F0F, 0x000F00, 0x000F00, 0x000F00, 0x000F00, 0x000F00, 0x000000}, // 'T'
+    {0x0F000F, 0x0F000F, 0x0F000F, 0x0F000F, 0x0F000F, 0x0F000F, 0x00FFF0, 0x000000}, // 'U'
+    {0x0F000F, 0x0F000F, 0x0F000F, 0x0F000F, 0x0F000F, 0x00F0F0, 0x000F00, 0x000000}, // 'V'
+    {0x0F000F, 0x0F000F, 0x0F000F, 0x0F0F0F, 0x0F0F0F, 0x0F0F0F, 0x00F0F0, 0x000000}, // 'W'
+    {0x0F000F, 0x0F000F, 0x00F0F0, 0x000F00, 0x00F0F0, 0x0F000F, 0x0F000F, 0x000000}, // 'X'
+    {0x0F000F, 0x0F000F, 0x00F0F0, 0x000F00, 0x000F00, 0x000F00, 0x000F00, 0x000000}, // 'Y'
+    {0x0FFFFF, 0x0F0000, 0x00F000, 0x00FFF0, 0x0000F0, 0x00000F, 0x0FFFFF, 0x000000}, // 'Z'
+    {0x0FFFF0, 0x0000F0, 0x0000F0, 0x0000F0, 0x0000F0, 0x0000F0, 0x0FFFF0, 0x000000}, // '['
+    {0x000000, 0x00000F, 0x0000F0, 0x000F00, 0x00F000, 0x0F0000, 0x000000, 0x000000}, // '\'
+    {0x0FFFF0, 0x0F0000, 0x0F0000, 0x0F0000, 0x0F0000, 0x0F0000, 0x0FFFF0, 0x000000}, // ']'
+    {0x000F00, 0x00F0F0, 0x0F000F, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000}, // '^'
+    {0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x0FFFFF, 0x000000}, // '_'
+    {0x000FF0, 0x000FF0, 0x000F00, 0x00F000, 0x000000, 0x000000, 0x000000, 0x000000}, // '`'
+    {0x000000, 0x000000, 0x000FF0, 0x00F000, 0x00FFF0, 0x00F00F, 0x0FFFF0, 0x000000}, // 'a'
+    {0x00000F, 0x00000F, 0x00FF0F, 0x0F00FF, 0x0F000F, 0x0F00FF, 0x00FF0F, 0x000000}, // 'b'
+    {0x000000, 0x000000, 0x00FFF0, 0x0F000F, 0x00000F, 0x0F000F, 0x00FFF0, 0x000000}, // 'c'
+    {0x0F0000, 0x0F0000, 0x0F0FF0, 0x0FF00F, 0x0F000F, 0x0FF00F, 0x0F0FF0, 0x000000}, // 'd'
+    {0x000000, 0x000000, 0x00FFF0, 0x0F000F, 0x0FFFFF, 0x00000F, 0x00FFF0, 0x000000}, // 'e'
+    {0x00F000, 0x0F0F00, 0x000F00, 0x00FFF0, 0x000F00, 0x000F00, 0x000F00, 0x000000}, // 'f'
+    {0x000000, 0x000000, 0x00FFF0, 0x0FF00F, 0x0FF00F, 0x0F0FF0, 0x0F0000, 0x00FFF0}, // 'g'
+    {0x00000F, 0x00000F, 0x00FF0F, 0x0F00FF, 0x0F000F, 0x0F000F, 0x0F000F, 0x000000}, // 'h'
+    {0x000F00, 0x000000, 0x000FF0, 0x000F00, 0x000F00, 0x000F00, 0x00FFF0, 0x000000}, // 'i'
+    {0x00F000, 0x000000, 0x00F000, 0x00F000, 0x00F000, 0x00F00F, 0x000FF0, 0x000000}, // 'j'
+    {0x00000F, 0x00000F, 0x00F00F, 0x000F0F, 0x0000FF, 0x000F0F, 0x00F00F, 0x000000}, // 'k'
+    {0x000FF0, 0x000F00, 0x000F00, 0x000F00, 0x000F00, 0x000F00, 0x00FFF0, 0x000000}, // 'l'
+    {0x000000, 0x000000, 0x00F0FF, 0x0F0F0F, 0x0F0F0F, 0x0F0F0F, 0x0F0F0F, 0x000000}, // 'm'
+    {0x000000, 0x000000, 0x00FF0F, 0x0F00FF, 0x0F000F, 0x0F000F, 0x0F000F, 0x000000}, // 'n'
+    {0x000000, 0x000000, 0x00FFF0, 0x0F000F, 0x0F000F, 0x0F000F, 0x00FFF0, 0x000000}, // 'o'
+    {0x000000, 0x000000, 0x00FF0F, 0x0F00FF, 0x0F00FF, 0x00FF0F, 0x00000F, 0x00000F}, // 'p'
+    {0x000000, 0x000000, 0x0F0FF0, 0x0FF00F, 0x0FF00F, 0x0F0FF0, 0x0F0000, 0x0F0000}, // 'q'
+    {0x000000, 0x000000, 0x00FF0F, 0x0F00FF, 0x00000F, 0x00000F, 0x00000F, 0x000000}, // 'r'
+    {0x000000, 0x000000, 0x0FFFF0, 0x00000F, 0x00FFF0, 0x0F0000, 0x00FFFF, 0x000000}, // 's'
+    {0x000F00, 0x000F00, 0x0FFFFF, 0x000F00, 0x000F00, 0x0F0F00, 0x00F000, 0x000000}, // 't'
+    {0x000000, 0x000000, 0x0F000F, 0x0F000F, 0x0F000F, 0x0FF00F, 0x0F0FF0, 0x000000}, // 'u'
+    {0x000000, 0x000000, 0x0F000F, 0x0F000F, 0x0F000F, 0x00F0F0, 0x000F00, 0x000000}, // 'v'
+    {0x000000, 0x000000, 0x0F000F, 0x0F000F, 0x0F0F0F, 0x0F0F0F, 0x00F0F0, 0x000000}, // 'w'
+    {0x000000, 0x000000, 0x0F000F, 0x00F0F0, 0x000F00, 0x00F0F0, 0x0F000F, 0x000000}, // 'x'
+    {0x000000, 0x000000, 0x0F000F, 0x0F000F, 0x0FFFF0, 0x0F0000, 0x0F000F, 0x00FFF0}, // 'y'
+    {0x000000, 0x000000, 0x0FFFFF, 0x00F000, 0x000F00, 0x0000F0, 0x0FFFFF, 0x000000}, // 'z'
+    {0x00F000, 0x000F00, 0x000F00, 0x0000F0, 0x000F00, 0x000F00, 0x00F000, 0x000000}, // '{'
+    {0x000F00, 0x000F00, 0x000F00, 0x000000, 0x000F00, 0x000F00, 0x000F00, 0x000000}, // '|'
+    {0x0000F0, 0x000F00, 0x000F00, 0x00F000, 0x000F00, 0x000F00, 0x0000F0, 0x000000}, // '}'
+    {0x0000F0, 0x0F0F0F, 0x00F000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000}, // '~'
+};
+
+const uint32_t glyph_atlas_5[GLYPH_ATLAS_GLYPHS][GLYPH_ATLAS_ROWS] = {
+    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // ' '
+    {0x00007C00, 0x00007C00, 0x00007C00, 0x00007C00, 0x00007C00, 0x00000000, 0x00007C00, 0x00000000}, // '!'
+    {0x000F83E0, 0x000F83E0, 0x000F83E0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // '"'
+    {0x000F83E0, 0x000F83E0, 0x01FFFFFF, 0x000F83E0, 0x01FFFFFF, 0x000F83E0, 0x000F83E0, 0x00000000}, // '#'
+    {0x00007C00, 0x01FFFFE0, 0x00007C1F, 0x000FFFE0, 0x01F07C00, 0x000FFFFF, 0x00007C00, 0x00000000}, // '$'
+    {0x000003FF, 0x01F003FF, 0x000F8000, 0x00007C00, 0x000003E0, 0x01FF801F, 0x01FF8000, 0x00000000}, // '%'
+    {0x000003E0, 0x00007C1F, 0x00007C1F, 0x000003E0, 0x01F07C1F, 0x000F801F, 0x01F07FE0, 0x00000000}, // '&'
+    {0x000FFC00, 0x000FFC00, 0x00007C00, 0x000003E0, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // '''
+    {0x000F8000, 0x00007C00, 0x000003E0, 0x000003E0, 0x000003E0, 0x00007C00, 0x000F8000, 0x00000000}, // '('
+    {0x000003E0, 0x00007C00, 0x000F8000, 0x000F8000, 0x000F8000, 0x00007C00, 0x000003E0, 0x00000000}, // ')'
+    {0x00007C00, 0x01F07C1F, 0x000FFFE0, 0x01FFFFFF, 0x000FFFE0, 0x01F07C1F, 0x00007C00, 0x00000000}, // '*'
+    {0x00000000, 0x00007C00, 0x00007C00, 0x01FFFFFF, 0x00007C00, 0x00007C00, 0x00000000, 0x00000000}, // '+'
+    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000FFC00, 0x000FFC00, 0x00007C00, 0x000003E0}, // ','
+    {0x00000000, 0x00000000, 0x00000000, 0x01FFFFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // '-'
+    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000FFC00, 0x000FFC00, 0x00000000}, // '.'
+    {0x00000000, 0x01F00000, 0x000F8000, 0x00007C00, 0x000003E0, 0x0000001F, 0x00000000, 0x00000000}, // '/'
+    {0x000FFFE0, 0x01F0001F, 0x01FF801F, 0x01F07C1F, 0x01F003FF, 0x01F0001F, 0x000FFFE0, 0x00000000}, // '0'
+    {0x00007C00, 0x00007FE0, 0x00007C00, 0x00007C00, 0x00007C00, 0x00007C00, 0x000FFFE0, 0x00000000}, // '1'
+    {0x000FFFE0, 0x01F0001F, 0x01F00000, 0x000FFFE0, 0x0000001F, 0x0000001F, 0x01FFFFFF, 0x00000000}, // '2'
+    {0x01FFFFFF, 0x01F00000, 0x000F8000, 0x000FFC00, 0x01F00000, 0x01F0001F, 0x000FFFE0, 0x00000000}, // '3'
+    {0x000F8000, 0x000FFC00, 0x000F83E0, 0x000F801F, 0x01FFFFFF, 0x000F8000, 0x000F8000, 0x00000000}, // '4'
+    {0x01FFFFFF, 0x0000001F, 0x000FFFFF, 0x01F00000, 0x01F00000, 0x01F0001F, 0x000FFFE0, 0x00000000}, // '5'
+    {0x01FFFC00, 0x000003E0, 0x0000001F, 0x000FFFFF, 0x01F0001F, 0x01F0001F, 0x000FFFE0, 0x00000000}, // '6'
+    {0x01FFFFFF, 0x01F00000, 0x01F00000, 0x000F8000, 0x00007C00, 0x000003E0, 0x0000001F, 0x00000000}, // '7'
+    {0x000FFFE0, 0x01F0001F, 0x01F0001F, 0x000FFFE0, 0x01F0001F, 0x01F0001F, 0x000FFFE0, 0x00000000}, // '8'
+    {0x000FFFE0, 0x01F0001F, 0x01F0001F, 0x01FFFFE0, 0x01F00000, 0x000F8000, 0x00007FFF, 0x00000000}, // '9'
+    {0x00000000, 0x00000000, 0x00007C00, 0x00000000, 0x00007C00, 0x00000000, 0x00000000, 0x00000000}, // ':'
+    {0x00000000, 0x00000000, 0x00007C00, 0x00000000, 0x00007C00, 0x00007C00, 0x000003E0, 0x00000000}, // ';'
+    {0x01F00000, 0x000F8000, 0x00007C00, 0x000003E0, 0x00007C00, 0x000F8000, 0x01F00000, 0x00000000}, // '<'
+    {0x00000000, 0x00000000, 0x01FFFFFF, 0x00000000, 0x01FFFFFF, 0x00000000, 0x00000000, 0x00000000}, // '='
+    {0x000003E0, 0x00007C00, 0x000F8000, 0x01F00000, 0x000F8000, 0x00007C00, 0x000003E0, 0x00000000}, // '>'
+    {0x000FFFE0, 0x01F0001F, 0x01F00000, 0x000FFC00, 0x00007C00, 0x00000000, 0x00007C00, 0x00000000}, // '?'
+    {0x000FFFE0, 0x01F0001F, 0x01F07C1F, 0x01FFFC1F, 0x000FFC1F, 0x0000001F, 0x01FFFFE0, 0x00000000}, // '@'
+    {0x00007C00, 0x000F83E0, 0x01F0001F, 0x01F0001F, 0x01FFFFFF, 0x01F0001F, 0x01F0001F, 0x00000000}, // 'A'
+    {0x000FFFFF, 0x01F0001F, 0x01F0001F, 0x000FFFFF, 0x01F0001F, 0x01F0001F, 0x000FFFFF, 0x00000000}, // 'B'
+    {0x000FFFE0, 0x01F0001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x01F0001F, 0x000FFFE0, 0x00000000}, // 'C'
+    {0x000FFFFF, 0x01F0001F, 0x01F0001F, 0x01F0001F, 0x01F0001F, 0x01F0001F, 0x000FFFFF, 0x00000000}, // 'D'
+    {0x01FFFFFF, 0x0000001F, 0x0000001F, 0x000FFFFF, 0x0000001F, 0x0000001F, 0x01FFFFFF, 0x00000000}, // 'E'
+    {0x01FFFFFF, 0x0000001F, 0x0000001F, 0x000FFFFF, 0x0000001F, 0x0000001F, 0x0000001F, 0x00000000}, // 'F'
+    {0x01FFFFE0, 0x01F0001F, 0x0000001F, 0x0000001F, 0x01FF801F, 0x01F0001F, 0x01FFFFE0, 0x00000000}, // 'G'
+    {0x01F0001F, 0x01F0001F, 0x01F0001F, 0x01FFFFFF, 0x01F0001F, 0x01F0001F, 0x01F0001F, 0x00000000}, // 'H'
+    {0x000FFFE0, 0x00007C00, 0x00007C00, 0x00007C00, 0x00007C00, 0x00007C00, 0x000FFFE0, 0x00000000}, // 'I'
+    {0x01FFFC00, 0x000F8000, 0x000F8000, 0x000F8000, 0x000F8000, 0x000F801F, 0x00007FE0, 0x00000000}, // 'J'
+    {0x01F0001F, 0x000F801F, 0x00007C1F, 0x000003FF, 0x00007C1F, 0x000F801F, 0x01F0001F, 0x00000000}, // 'K'
+    {0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x0000001F, 0x01FFFFFF, 0x00000000}, // 'L'
+    {0x01F0001F, 0x01FF83FF, 0x01F07C1F, 0x01F07C1F, 0x01F07C1F, 0x01F0001F, 0x01F0001F, 0x00000000}, // 'M'
+    {0x01F0001F, 0x01F0001F, 0x01F003FF, 0x01F07C1F, 0x01FF801F, 0x01F0001F, 0x01F0001F, 0x00000000}, // 'N'
+    {0x000FFFE0, 0x01F0001F, 0x01F0001F, 0x01F0001F, 0x01F0001F, 0x01F0001F, 0x000FFFE0, 0x00000000}, // 'O'
+    {0x000FFFFF, 0x01F0001F, 0x01F0001F, 0x000FFFFF, 0x0000001F, 0x0000001F, 0x0000001F, 0x00000000}, // 'P'
+    {0x000FFFE0, 0x01F0001F, 0x01F0001F, 0x01F0001F, 0x01F07C1F, 0x000F801F, 0x01F07FE0, 0x00000000}, // 'Q'
+    {0x000FFFFF, 0x01F0001F, 0x01F0001F, 0x000FFFFF, 0x00007C1F, 0x000F801F, 0x01F0001F, 0x00000000}, // 'R'
+    {0x000FFFE0, 0x01F0001F, 0x0000001F, 0x000FFFE0, 0x01F00000, 0x01F0001F, 0x000FFFE0, 0x00000000}, // 'S'
+    {0x01FFFFFF, 0x01F07C1F, 0x00007C00, 0x00007C00, 0x00007C00, 0x00007C00, 0x00007C00, 0x00000000}, // 'T'
+    {0x01F0001F, 0x01F0001F, 0x01F0001F, 0x01F0001F, 0x01F0001F, 0x01F0001F, 0x000FFFE0, 0x00000000}, // 'U'
+    {0x01F0001F, 0x01F0001F, 0x01F0001F, 0x01F0001F, 0x01F0001F, 0x000F83E0, 0x00007C00, 0x00000000}, // 'V'
+    {0x01F0001F, 0x01F0001F, 0x01F0001F, 0x01F07C1F, 0x01F07C1F, 0x01F07C1F, 0x000F83E0, 0x00000000}, // 'W'
+    {0x01F0001F, 0x01F0001F, 0x000F83E0, 0x00007C00, 0x000F83E0, 0x01F0001F, 0x01F0001F, 0x00000000}, // 'X'
+    {0x01F0001F, 0x01F0001F, 0x000F83E0, 0x00007C00, 0x00007C00, 0x00007C00, 0x00007C00, 0x00000000}, // 'Y'
+    {0x01FFFFFF, 0x01F00000, 0x000F8000, 0x000FFFE0, 0x000003E0, 0x0000001F, 0x01FFFFFF, 0x00000000}, // 'Z'
+    {0x01FFFFE0, 0x000003E0, 0x000003E0, 0x000003E0, 0x000003E0, 0x000003E0, 0x01FFFFE0, 0x00000000}, // '['
+    {0x00000000, 0x0000001F, 0x000003E0, 0x00007C00, 0x000F8000, 0x01F00000, 0x00000000, 0x00000000}, // '\'
+    {0x01FFFFE0, 0x01F00000, 0x01F00000, 0x01F00000, 0x01F00000, 0x01F00000, 0x01FFFFE0, 0x00000000}, // ']'
+    {0x00007C00, 0x000F83E0, 0x01F0001F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // '^'
+    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01FFFFFF, 0x00000000}, // '_'
+    {0x00007FE0, 0x00007FE0, 0x00007C00, 0x000F8000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // '`'
+    {0x00000000, 0x00000000, 0x00007FE0, 0x000F8000, 0x000FFFE0, 0x000F801F, 0x01FFFFE0, 0x00000000}, // 'a'
+    {0x0000001F, 0x0000001F, 0x000FFC1F, 0x01F003FF, 0x01F0001F, 0x01F003FF, 0x000FFC1F, 0x00000000}, // 'b'
+    {0x00000000, 0x00000000, 0x000FFFE0, 0x01F0001F, 0x0000001F, 0x01F0001F, 0x000FFFE0, 0x00000000}, // 'c'
+    {0x01F00000, 0x01F00000, 0x01F07FE0, 0x01FF801F, 0x01F0001F, 0x01FF801F, 0x01F07FE0, 0x00000000}, // 'd'
+    {0x00000000, 0x00000000, 0x000FFFE0, 0x01F0001F, 0x01FFFFFF, 0x0000001F, 0x000FFFE0, 0x00000000}, // 'e'
+    {0x000F8000, 0x01F07C00, 0x00007C00, 0x000FFFE0, 0x00007C00, 0x00007C00, 0x00007C00, 0x00000000}, // 'f'
+    {0x00000000, 0x00000000, 0x000FFFE0, 0x01FF801F, 0x01FF801F, 0x01F07FE0, 0x01F00000, 0x000FFFE0}, // 'g'
+    {0x0000001F, 0x0000001F, 0x000FFC1F, 0x01F003FF, 0x01F0001F, 0x01F0001F, 0x01F0001F, 0x00000000}, // 'h'
+    {0x00007C00, 0x00000000, 0x00007FE0, 0x00007C00, 0x00007C00, 0x00007C00, 0x000FFFE0, 0x00000000}, // 'i'
+    {0x000F8000, 0x00000000, 0x000F8000, 0x000F8000, 0x000F8000, 0x000F801F, 0x00007FE0, 0x00000000}, // 'j'
+    {0x0000001F, 0x0000001F, 0x000F801F, 0x00007C1F, 0x000003FF, 0x00007C1F, 0x000F801F, 0x00000000}, // 'k'
+    {0x00007FE0, 0x00007C00, 0x00007C00, 0x00007C00, 0x00007C00, 0x00007C00, 0x000FFFE0, 0x00000000}, // 'l'
+    {0x00000000, 0x00000000, 0x000F83FF, 0x01F07C1F, 0x01F07C1F, 0x01F07C1F, 0x01F07C1F, 0x00000000}, // 'm'
+    {0x00000000, 0x00000000, 0x000FFC1F, 0x01F003FF, 0x01F0001F, 0x01F0001F, 0x01F0001F, 0x00000000}, // 'n'
+    {0x00000000, 0x00000000, 0x000FFFE0, 0x01F0001F, 0x01F0001F, 0x01F0001F, 0x000FFFE0, 0x00000000}, // 'o'
+    {0x00000000, 0x00000000, 0x000FFC1F, 0x01F003FF, 0x01F003FF, 0x000FFC1F, 0x0000001F, 0x0000001F}, // 'p'
+    {0x00000000, 0x00000000, 0x01F07FE0, 0x01FF801F, 0x01FF801F, 0x01F07FE0, 0x01F00000, 0x01F00000}, // 'q'
+    {0x00000000, 0x00000000, 0x000FFC1F, 0x01F003FF, 0x0000001F, 0x0000001F, 0x0000001F, 0x00000000}, // 'r'
+    {0x00000000, 0x00000000, 0x01FFFFE0, 0x0000001F, 0x000FFFE0, 0x01F00000, 0x000FFFFF, 0x00000000}, // 's'
+    {0x00007C00, 0x00007C00, 0x01FFFFFF, 0x00007C00, 0x00007C00, 0x01F07C00, 0x000F8000, 0x00000000}, // 't'
+    {0x00000000, 0x00000000, 0x01F0001F, 0x01F0001F, 0x01F0001F, 0x01FF801F, 0x01F07FE0, 0x00000000}, // 'u'
+    {0x00000000, 0x00000000, 0x01F0001F, 0x01F0001F, 0x01F0001F, 0x000F83E0, 0x00007C00, 0x00000000}, // 'v'
+    {0x00000000, 0x00000000, 0x01F0001F, 0x01F0001F, 0x01F07C1F, 0x01F07C1F, 0x000F83E0, 0x00000000}, // 'w'
+    {0x00000000, 0x00000000, 0x01F0001F, 0x000F83E0, 0x00007C00, 0x000F83E0, 0x01F0001F, 0x00000000}, // 'x'
+    {0x00000000, 0x00000000, 0x01F0001F, 0x01F0001F, 0x01FFFFE0, 0x01F00000, 0x01F0001F, 0x000FFFE0}, // 'y'
+    {0x00000000, 0x00000000, 0x01FFFFFF, 0x000F8000, 0x00007C00, 0x000003E0, 0x01FFFFFF, 0x00000000}, // 'z'
+    {0x000F8000, 0x00007C00, 0x00007C00, 0x000003E0, 0x00007C00, 0x00007C00, 0x000F8000, 0x00000000}, // '{'
+    {0x00007C00, 0x00007C00, 0x00007C00, 0x00000000, 0x00007C00, 0x00007C00, 0x00007C00, 0x00000000}, // '|'
+    {0x000003E0, 0x00007C00, 0x00007C00, 0x000F8000, 0x00007C00, 0x00007C00, 0x000003E0, 0x00000000}, // '}'
+    {0x000003E0, 0x01F07C1F, 0x000F8000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000}, // '~'
+};
@@ -0,0 +1,32 @@
+// File: glyph_atlas.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: 5x7 font pre-scaled horizontally for text sizes 1, 2, 4 and 5 (see tools/glyph_atlas.py)
+
+#ifndef GLYPH_ATLAS_H_
+#define GLYPH_ATLAS_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define GLYPH_ATLAS_GLYPHS  95 // Printable ASCII
+#define GLYPH_ATLAS_ROWS    8  // Row 0 is the top row
+
+/*************************************Defines***************************************/
+
+/***********************************Variables***************************************/
+
+// One scaled cell row per entry (spacing column included), bit 0 is the leftmost pixel
+extern const uint8_t  glyph_atlas_1[GLYPH_ATLAS_GLYPHS][GLYPH_ATLAS_ROWS];
+extern const uint16_t glyph_atlas_2[GLYPH_ATLAS_GLYPHS][GLYPH_ATLAS_ROWS];
+extern const uint32_t glyph_atlas_4[GLYPH_ATLAS_GLYPHS][GLYPH_ATLAS_ROWS];
+extern const uint32_t glyph_atlas_5[GLYPH_ATLAS_GLYPHS][GLYPH_ATLAS_ROWS];
+
+/***********************************Variables***************************************/
+
+#endif /* GLYPH_ATLAS_H_ */
@@ -0,0 +1,85 @@
+// File: heading.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Integer compass math, CORDIC heading from magnetometer X/Y and table driven needle endpoints
+
+//************************************Includes***************************************/
+
+// Local Files
+#include "./heading.h"
+
+//*************************************Defines***************************************/
+
+// Inputs are scaled up before the rotations so the last iterations still move the vector,
+// 16 bit inputs times the CORDIC gain (1.65) times sqrt(2) still fit in 31 bits
+#define HEADING_CORDIC_SHIFT    14
+
+// Table steps per turn and the angle bits below one step
+#define HEADING_STEP_BITS       (16 - 2 - 8)
+
+//*************************************Public Functions***************************************/
+
+uint16_t heading_atan2(int16_t y, int16_t x) {
+    int32_t vx = x, vy = y;
+    uint16_t angle = 0;
+
+    if (vx == 0 && vy == 0) {
+        return 0;
+    }
+
+    // Rotate by half a turn into the right half plane, where CORDIC converges
+    if (vx < 0) {
+        vx = -vx;
+        vy = -vy;
+        angle = 0x8000;
+    }
+
+    vx *= (1 << HEADING_CORDIC_SHIFT);
+    vy *= (1 << HEADING_CORDIC_SHIFT);
+
+    // Vectoring mode, rotate the vector onto the X axis and sum the rotations
+    for (uint8_t i = 0; i < HEADING_CORDIC_ITERATIONS; i++) {
+        int32_t dx = vx >> i;
+        int32_t dy = vy >> i;
+        if (vy > 0) {
+            vx += dy;
+            vy -= dx;
+            angle += heading_atan_table[i];
+        } else {
+            vx -= dy;
+            vy += dx;
+            angle -= heading_atan_table[i];
+        }
+    }
+
+    return angle;
+}
+
+int16_t heading_sin(uint16_t angle) {
+
+    // Nearest table step, then fold the quadrant onto the quarter wave
+    uint16_t step = (uint16_t)(((uint32_t)angle + (1u << (HEADING_STEP_BITS - 1))) >> HEADING_STEP_BITS) & (4 * HEADING_QUARTER_STEPS - 1);
+    uint16_t index = step & (HEADING_QUARTER_STEPS - 1);
+
+    switch (step / HEADING_QUARTER_STEPS) {
+        case 0: return heading_sin_table[index];
+        case 1: return heading_sin_table[HEADING_QUARTER_STEPS - index];
+        case 2: return (int16_t)-heading_sin_table[index];
+        default: return (int16_t)-heading_sin_table[HEADING_QUARTER_STEPS - index];
+    }
+}
+
+int16_t heading_cos(uint16_t angle) {
+    return heading_sin((uint16_t)(angle + 0x4000));
+}
+
+void heading_tip(uint16_t angle, int16_t cx, int16_t cy, int16_t length, int16_t *tip_x, int16_t *tip_y) {
+
+    // Q15 products, rounded to the nearest pixel
+    *tip_x = (int16_t)(cx + (((int32_t)heading_cos(angle) * length + (1 << 14)) >> 15));
+    *tip_y = (int16_t)(cy + (((int32_t)heading_sin(angle) * length + (1 << 14)) >> 15));
+}
+
+uint16_t heading_to_deg10(uint16_t angle) {
+    return (uint16_t)(((uint32_t)angle * 3600u + HEADING_TURN / 2) / HEADING_TURN) % 3600u;
+}
@@ -0,0 +1,69 @@
+// File: heading.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Integer compass math, CORDIC heading from magnetometer X/Y and table driven needle endpoints
+
+#ifndef HEADING_H_
+#define HEADING_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Angles are binary angle units, a uint16_t wraps once per turn
+#define HEADING_TURN                65536u
+#define HEADING_FROM_DEG(deg)       ((uint16_t)(((uint32_t)(deg) * HEADING_TURN) / 360u))
+
+// CORDIC iterations, past 15 the arctangent steps are below one unit
+#define HEADING_CORDIC_ITERATIONS   15
+
+// Sine table resolution, 4 * 256 steps per turn (0.35 degrees)
+#define HEADING_QUARTER_STEPS       256
+
+/*************************************Defines***************************************/
+
+/***********************************Variables***************************************/
+
+// Tables in heading_table.c (see tools/heading_table.py)
+extern const uint16_t heading_atan_table[HEADING_CORDIC_ITERATIONS];
+extern const int16_t heading_sin_table[HEADING_QUARTER_STEPS + 1];
+
+/***********************************Variables***************************************/
+
+/********************************Public Functions***********************************/
+
+/// @brief Angle of a vector, same as atan2(y, x) with integer shifts and adds only
+/// @param y Y component (raw magnetometer reading)
+/// @param x X component (raw magnetometer reading)
+/// @return Angle in binary angle units (0 for a zero vector)
+uint16_t heading_atan2(int16_t y, int16_t x);
+
+/// @brief Sine from the quarter wave table
+/// @param angle Angle in binary angle units
+/// @return Q15 sine
+int16_t heading_sin(uint16_t angle);
+
+/// @brief Cosine from the quarter wave table
+/// @param angle Angle in binary angle units
+/// @return Q15 cosine
+int16_t heading_cos(uint16_t angle);
+
+/// @brief End point of a line of a given length from a center, rounded to the nearest pixel
+/// @param angle Angle in binary angle units (0 points towards +X, a quarter turn towards +Y)
+/// @param cx Center X position
+/// @param cy Center Y position
+/// @param length Length in pixels
+/// @param tip_x Returns the end point X position
+/// @param tip_y Returns the end point Y position
+void heading_tip(uint16_t angle, int16_t cx, int16_t cy, int16_t length, int16_t *tip_x, int16_t *tip_y);
+
+/// @brief Converts an angle to tenths of a degree
+uint16_t heading_to_deg10(uint16_t angle);
+
+/********************************Public Functions***********************************/
+
+#endif /* HEADING_H_ */
@@ -0,0 +1,172 @@
+// File: heading_bench.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Accuracy versus speed of the integer compass math against the double precision path,
+//              runs on target (cycles) and in the host build (nanoseconds)
+
+//************************************Includes***************************************/
+
+// Local Files
+#include "./heading_bench.h"
+#include "./heading.h"
+#include "./perf.h"
+#include "./text.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+//*************************************Defines***************************************/
+
+// Same geometry as the Compass app
+#define BENCH_CENTER_X      120
+#define BENCH_CENTER_Y      140
+#define BENCH_NEEDLE        45
+
+#define BENCH_SAMPLES       (HEADING_BENCH_ANGLES * HEADING_BENCH_MAGNITUDES)
+
+//*************************************Variables***************************************/
+
+// Raw magnetometer readings range from a few tens to a few thousand counts
+static const int16_t magnitudes[HEADING_BENCH_MAGNITUDES] = { 40, 400, 4000, 30000 };
+
+// Results go to volatile sinks so the compiler keeps every call
+static volatile uint16_t sink_angle;
+static volatile double sink_deg;
+static volatile int16_t sink_tip;
+
+//*************************************Helper Functions***************************************/
+
+/// @brief Test vector i, generated the same cheap way for every timed loop
+static void bench_vector(uint32_t i, int16_t *x, int16_t *y) {
+    uint16_t angle = (uint16_t)((i % HEADING_BENCH_ANGLES) * (HEADING_TURN / HEADING_BENCH_ANGLES) + 37);
+    int32_t mag = magnitudes[i / HEADING_BENCH_ANGLES];
+    *x = (int16_t)(((int32_t)heading_cos(angle) * mag) >> 15);
+    *y = (int16_t)(((int32_t)heading_sin(angle) * mag) >> 15);
+}
+
+/// @brief The original Compass_App heading, degrees in [0, 360)
+static double bench_double_heading(int16_t x, int16_t y) {
+    double heading_deg = atan2((double)y, (double)x) * (180.0 / M_PI);
+    if (heading_deg < 0.0) heading_deg += 360.0;
+    return heading_deg;
+}
+
+/// @brief Ticks spent generating the vectors alone, subtracted from every timed loop
+static uint32_t bench_baseline(void) {
+    int16_t x, y;
+    uint32_t start = perf_now();
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++) {
+        bench_vector(i, &x, &y);
+        sink_tip = (int16_t)(x + y);
+    }
+    return perf_now() - start;
+}
+
+/// @brief Per call ticks of a loop, with the baseline removed
+static uint32_t bench_per_call(uint32_t ticks, uint32_t baseline) {
+    return ticks > baseline ? (ticks - baseline) / BENCH_SAMPLES : 0;
+}
+
+//*************************************Public Functions***************************************/
+
+void heading_bench_run(heading_bench_t *r) {
+    int16_t x, y, tx, ty;
+    uint32_t start, baseline;
+    uint64_t err_sum = 0;
+
+    *r = (heading_bench_t){0};
+    r->samples = BENCH_SAMPLES;
+    baseline = bench_baseline();
+
+    // Heading, double precision
+    start = perf_now();
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++) {
+        bench_vector(i, &x, &y);
+        sink_deg = bench_double_heading(x, y);
+    }
+    r->atan2_double = bench_per_call(perf_now() - start, baseline);
+
+    // Heading, CORDIC
+    start = perf_now();
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++) {
+        bench_vector(i, &x, &y);
+        sink_angle = heading_atan2(y, x);
+    }
+    r->atan2_cordic = bench_per_call(perf_now() - start, baseline);
+
+    // Needle end point, the original DrawCompass math (angles are scattered over the turn)
+    start = perf_now();
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++) {
+        double heading_deg = (uint16_t)(i * 91u) * (360.0 / HEADING_TURN);
+        double angle_rad = (heading_deg * (M_PI / 180.0)) + M_PI;
+        sink_tip = (int16_t)(BENCH_CENTER_X + (int16_t)(cos(angle_rad) * BENCH_NEEDLE));
+        sink_tip = (int16_t)(BENCH_CENTER_Y - (int16_t)(sin(angle_rad) * BENCH_NEEDLE));
+    }
+    r->tip_double = bench_per_call(perf_now() - start, 0);
+
+    // Needle end point, sine table
+    start = perf_now();
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++) {
+        heading_tip((uint16_t)(i * 91u), BENCH_CENTER_X, BENCH_CENTER_Y, BENCH_NEEDLE, &tx, &ty);
+        sink_tip = tx;
+        sink_tip = ty;
+    }
+    r->tip_table = bench_per_call(perf_now() - start, 0);
+
+    // Accuracy, untimed
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++) {
+        bench_vector(i, &x, &y);
+
+        // Heading error, wrapped to the short way round
+        double ref = bench_double_heading(x, y);
+        double got = heading_atan2(y, x) * (360.0 / HEADING_TURN);
+        double err = fabs(got - ref);
+        if (err > 180.0) err = 360.0 - err;
+        uint32_t mdeg = (uint32_t)(err * 1000.0 + 0.5);
+        err_sum += mdeg;
+        if (mdeg > r->err_max_mdeg) r->err_max_mdeg = mdeg;
+
+        // End point error against the exact rounded end point
+        uint16_t angle = heading_atan2(y, x);
+        double rad = angle * (2.0 * M_PI / HEADING_TURN);
+        int16_t ex = (int16_t)floor(BENCH_CENTER_X + cos(rad) * BENCH_NEEDLE + 0.5);
+        int16_t ey = (int16_t)floor(BENCH_CENTER_Y + sin(rad) * BENCH_NEEDLE + 0.5);
+        heading_tip(angle, BENCH_CENTER_X, BENCH_CENTER_Y, BENCH_NEEDLE, &tx, &ty);
+        uint32_t dx = (uint32_t)abs(tx - ex), dy = (uint32_t)abs(ty - ey);
+        if (dx || dy) r->tip_mismatches++;
+        if (dx > r->tip_err_max) r->tip_err_max = dx;
+        if (dy > r->tip_err_max) r->tip_err_max = dy;
+    }
+    r->err_mean_mdeg = (uint32_t)(err_sum / BENCH_SAMPLES);
+}
+
+bool heading_bench_line(const heading_bench_t *r, uint8_t line, char *buf) {
+    switch (line) {
+        case 0: snprintf(buf, HEADING_BENCH_LINE, "%lu samples, %s per call", (unsigned long)r->samples, PERF_UNIT); break;
+        case 1: snprintf(buf, HEADING_BENCH_LINE, "atan2 double: %lu", (unsigned long)r->atan2_double); break;
+        case 2: snprintf(buf, HEADING_BENCH_LINE, "atan2 CORDIC: %lu", (unsigned long)r->atan2_cordic); break;
+        case 3: snprintf(buf, HEADING_BENCH_LINE, "err max %lu mean %lu mdeg", (unsigned long)r->err_max_mdeg, (unsigned long)r->err_mean_mdeg); break;
+        case 4: snprintf(buf, HEADING_BENCH_LINE, "tip cos/sin:  %lu", (unsigned long)r->tip_double); break;
+        case 5: snprintf(buf, HEADING_BENCH_LINE, "tip table:    %lu", (unsigned long)r->tip_table); break;
+        case 6: snprintf(buf, HEADING_BENCH_LINE, "tip err max %lu px, %lu differ", (unsigned long)r->tip_err_max, (unsigned long)r->tip_mismatches); break;
+        default: return false;
+    }
+    return true;
+}
+
+void heading_bench_show(void) {
+    heading_bench_t r;
+    char buf[HEADING_BENCH_LINE];
+
+    perf_init();
+    heading_bench_run(&r);
+
+    for (uint8_t line = 0; heading_bench_line(&r, line, buf); line++) {
+        text_draw(10, (int16_t)(250 - line * 12), buf, 1, 0xFFFF, 0x0000, 220);
+    }
+}
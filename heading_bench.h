@@ -0,0 +1,62 @@
+// File: heading_bench.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Accuracy versus speed of the integer compass math against the double precision path,
+//              runs on target (cycles) and in the host build (nanoseconds)
+
+#ifndef HEADING_BENCH_H_
+#define HEADING_BENCH_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Test vectors, HEADING_BENCH_ANGLES directions at each of HEADING_BENCH_MAGNITUDES magnitudes
+#define HEADING_BENCH_ANGLES        720 // Half a degree apart
+#define HEADING_BENCH_MAGNITUDES    4
+
+// Length of one formatted result line (lines are clipped to the panel width)
+#define HEADING_BENCH_LINE          48
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    uint32_t samples;
+    uint32_t atan2_double;      // Ticks per heading, double atan2 (PERF_UNIT)
+    uint32_t atan2_cordic;      // Ticks per heading, CORDIC
+    uint32_t tip_double;        // Ticks per needle end point, double cos / sin
+    uint32_t tip_table;         // Ticks per needle end point, sine table
+    uint32_t err_max_mdeg;      // Largest heading error in millidegrees
+    uint32_t err_mean_mdeg;     // Mean heading error in millidegrees
+    uint32_t tip_err_max;       // Largest end point error in pixels (either axis)
+    uint32_t tip_mismatches;    // End points that differ from the rounded double result
+} heading_bench_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+/// @brief Runs the benchmark (call perf_init first)
+/// @param r Returns the results
+void heading_bench_run(heading_bench_t *r);
+
+/// @brief Formats one line of the results
+/// @param r Results
+/// @param line Line number, starting at 0
+/// @param buf Buffer of at least HEADING_BENCH_LINE characters
+/// @return False once past the last line
+bool heading_bench_line(const heading_bench_t *r, uint8_t line, char *buf);
+
+/// @brief Runs the benchmark and prints the results on the panel (target build with HEADING_BENCH defined)
+void heading_bench_show(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* HEADING_BENCH_H_ */
@@ -0,0 +1,24 @@
+// File: GFX_Library.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Host stand-in for the GFX text functions (see gfx_host.c)
+
+#ifndef GFX_LIBRARY_H_
+#define GFX_LIBRARY_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+/************************************Includes***************************************/
+
+/********************************Public Functions***********************************/
+
+void display_setCursor(int16_t x, int16_t y);
+void display_setTextColor(uint16_t color);
+void display_setTextSize(uint8_t size);
+void display_print(char c);
+
+/********************************Public Functions***********************************/
+
+#endif /* GFX_LIBRARY_H_ */
@@ -0,0 +1,48 @@
+// File: multimod.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Host stand-in for the Multimod driver header (display functions in st7789_host.c,
+//              board init, buttons, joystick and BMI160 magnetometer in multimod_host.c)
+
+#ifndef MULTIMOD_H_
+#define MULTIMOD_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
+
+/************************************Includes***************************************/
+
+/********************************Public Functions***********************************/
+
+// ST7789 low level access
+void ST7789_Select(void);
+void ST7789_Deselect(void);
+void ST7789_WriteCommand(uint8_t cmd);
+void ST7789_WriteData(uint8_t data);
+void ST7789_SetWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+
+// ST7789 drawing
+void ST7789_DrawPixel(int16_t x, int16_t y, uint16_t color);
+void ST7789_DrawRectangle(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+void ST7789_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+void ST7789_DrawCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color);
+
+// Board
+void multimod_init(void);
+uint8_t MultimodButtons_Get(void);
+uint32_t JOYSTICK_GetXY(void);
+
+// BMI160 with the magnetometer behind its auxiliary interface
+void BMI160_WriteRegister(uint8_t reg, uint8_t data);
+void BMI160_MagSetPmuMode(uint8_t mode);
+void BMI160_MagManualWrite(uint8_t addr, uint8_t reg, uint8_t data);
+int BMI160_MagManualRead(uint8_t addr, uint8_t reg, uint8_t n, uint8_t *buf);
+
+/********************************Public Functions***********************************/
+
+#endif /* MULTIMOD_H_ */
@@ -0,0 +1,43 @@
+// File: RTOS.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Host stand-in for the RTOS API, implemented on pthreads by rtos_host.c
+
+#ifndef RTOS_H_
+#define RTOS_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/***********************************Structures**************************************/
+
+// Counting semaphore, negative values count the blocked threads
+typedef int32_t semaphore_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void RTOS_Init(void);
+void RTOS_Launch(void);
+
+/// @brief Adds a thread, priority 0 is the highest and 255 is the idle slot
+int RTOS_AddThread(void (*thread)(void), uint8_t priority, char *name);
+
+/// @brief Registers an interrupt handler, raised on the host by rtos_host_raise
+int RTOS_Add_APeriodicEvent(void (*handler)(void), uint8_t priority, uint8_t irq);
+
+void RTOS_InitSemaphore(semaphore_t *s, int32_t value);
+void RTOS_WaitSemaphore(semaphore_t *s);
+void RTOS_SignalSemaphore(semaphore_t *s);
+
+/// @brief Blocks the calling thread for a number of milliseconds
+void sleep(uint32_t ms);
+
+/********************************Public Functions***********************************/
+
+#endif /* RTOS_H_ */
@@ -0,0 +1,127 @@
+// File: codec_bench.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Host tool decoding packed photos the way photo.c does (small input chunks into panel rows),
+//              checking them against the expected pixels and timing the decoder per pixel
+//              Usage: codec_bench EXPECTED.565 PACKED.qz [EXPECTED.565 PACKED.qz ...]
+//              (tools/codec_bench.py builds the corpus and runs this)
+
+//************************************Includes***************************************/
+
+#include "../codec.h"
+#include "../perf.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//*************************************Defines***************************************/
+
+#define BENCH_WIDTH     240     // Pixels per output row
+#define BENCH_CHUNK     64      // Input bytes per call, like the UART reads of photo.c
+#define BENCH_REPEATS   20      // Best of, to keep the scheduler out of the timings
+
+//*************************************Helper Functions***************************************/
+
+static uint8_t *bench_read(const char *path, uint32_t *len) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *data = malloc(size > 0 ? (size_t)size : 1);
+    if (data && fread(data, 1, (size_t)size, f) != (size_t)size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    *len = (uint32_t)size;
+    return data;
+}
+
+/// @brief Decodes a whole image row by row from chunks of the payload
+/// @return Pixels decoded
+static uint32_t bench_decode(const uint8_t *payload, uint32_t len, uint8_t *image, uint32_t pixels) {
+    static codec_t c;
+    uint32_t done = 0;
+    uint32_t pos = 0;
+    uint32_t chunk = 0;
+    uint32_t chunk_pos = 0;
+
+    codec_init(&c);
+    while (done < pixels && !c.error) {
+        uint32_t row = pixels - done < BENCH_WIDTH ? pixels - done : BENCH_WIDTH;
+        uint32_t filled = 0;
+        while (filled < row && !c.error) {
+            if (chunk_pos == chunk) {
+                if (pos == len) {
+                    return done + filled;
+                }
+                chunk = len - pos < BENCH_CHUNK ? len - pos : BENCH_CHUNK;
+                chunk_pos = 0;
+                pos += chunk;
+            }
+            uint32_t used;
+            filled += codec_decode(&c, payload + pos - chunk + chunk_pos, chunk - chunk_pos,
+                                   image + (done + filled) * 2, row - filled, &used);
+            chunk_pos += used;
+        }
+        done += filled;
+    }
+    return done;
+}
+
+//*************************************MAIN*******************************************/
+
+int main(int argc, char **argv) {
+    int failed = 0;
+
+    if (argc < 3 || (argc - 1) % 2) {
+        fprintf(stderr, "usage: %s EXPECTED.565 PACKED.qz [...]\n", argv[0]);
+        return 2;
+    }
+    perf_init();
+    printf("unit %s\n", PERF_UNIT);
+
+    for (int a = 1; a + 1 < argc; a += 2) {
+        uint32_t raw_len, packed_len;
+        uint8_t *raw = bench_read(argv[a], &raw_len);
+        uint8_t *packed = bench_read(argv[a + 1], &packed_len);
+        if (!raw || !packed || packed_len < CODEC_HEADER_BYTES) {
+            return 1;
+        }
+
+        uint32_t payload = ((uint32_t)packed[0] << 24) | ((uint32_t)packed[1] << 16) |
+                           ((uint32_t)packed[2] << 8) | packed[3];
+        if (payload > packed_len - CODEC_HEADER_BYTES) {
+            payload = packed_len - CODEC_HEADER_BYTES;
+        }
+        uint32_t pixels = raw_len / 2;
+        uint8_t *image = calloc(raw_len, 1);
+
+        uint32_t best = UINT32_MAX;
+        uint32_t decoded = 0;
+        for (int r = 0; r < BENCH_REPEATS; r++) {
+            uint32_t start = perf_now();
+            decoded = bench_decode(packed + CODEC_HEADER_BYTES, payload, image, pixels);
+            uint32_t ticks = perf_now() - start;
+            if (ticks < best) {
+                best = ticks;
+            }
+        }
+
+        bool match = decoded == pixels && payload + CODEC_HEADER_BYTES == packed_len &&
+                     memcmp(raw, image, raw_len) == 0;
+        failed |= !match;
+        printf("%s %u %u %.2f %s\n", argv[a + 1], raw_len, packed_len,
+               pixels ? (double)best / pixels : 0.0, match ? "ok" : "MISMATCH");
+
+        free(image);
+        free(raw);
+        free(packed);
+    }
+    return failed;
+}
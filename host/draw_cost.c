@@ -0,0 +1,302 @@
+// File: draw_cost.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Host tool comparing the SPI cost of per-pixel drawing against burst blits, and checking
+//              that each new path draws the same frame as the legacy one (exit code 1 if not)
+//              Usage: draw_cost [--spi-hz HZ] [--png DIR]
+
+//************************************Includes***************************************/
+
+#include "./st7789_host.h"
+#include "./MultimodDrivers/multimod.h"
+#include "../display.h"
+#include "../compositor.h"
+#include "../sprite.h"
+#include "../text.h"
+#include "../widget.h"
+#include "../needle.h"
+#include "./MultimodDrivers/GFX_Library.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//*************************************Defines***************************************/
+
+// Same layout as the home screen in threads.c
+#define ICON_SIZE       80
+#define NUM_ICONS       4
+#define PHOTO_SIZE      240
+
+#define FRAME_PIXELS    (ST7789_HOST_WIDTH * ST7789_HOST_HEIGHT)
+
+//*************************************Variables***************************************/
+
+static uint8_t icon[ICON_SIZE * ICON_SIZE * 2];
+
+// Frogger lanes (grass, river, grass, road)
+static const uint16_t lanes[4] = { 0x2660, 0x001F, 0x2660, 0x39E7 };
+
+// Frame captures, one PNG per scenario row when set
+static const char *png_dir = NULL;
+static int png_index = 0;
+
+// Both passes of a scenario start from the same frame, the new pass must end on the legacy pass's frame
+static uint16_t start_frame[FRAME_PIXELS];
+static uint16_t legacy_frame[FRAME_PIXELS];
+static uint16_t new_frame[FRAME_PIXELS];
+static uint32_t mismatches = 0;
+
+//*************************************Helper Functions***************************************/
+
+/// @brief Original threads.c display_photo (icons before the asset headers), one ST7789_DrawPixel per pixel
+static void legacy_display_photo(uint16_t x_pos, uint16_t y_pos, const uint8_t *bitmap, uint16_t w, uint16_t h) {
+    uint32_t index = 0;
+    for (uint16_t y = 0; y < h; y++) {
+        for (uint16_t x = 0; x < w; x++) {
+            if ((x_pos + x >= DISPLAY_WIDTH) || (y_pos + y >= DISPLAY_HEIGHT)) {
+                index += 2;
+                continue;
+            }
+            uint16_t color = (uint16_t)((bitmap[index + 1] << 8) | bitmap[index]);
+            ST7789_DrawPixel(x_pos + x, y_pos + (h - 1 - y), color);
+            index += 2;
+        }
+    }
+}
+
+/// @brief Prints one row of the report (and saves the frame) and returns the total bytes
+static uint32_t report(const char *name) {
+    st7789_stats_t s = ST7789_Host_GetStats();
+    uint32_t total = s.command_bytes + s.data_bytes;
+    printf("%-28s %8u %10u %10u %10u %9u\n", name, s.windows, s.command_bytes, s.data_bytes, total,
+           ST7789_Host_SpiMicros(&s));
+    ST7789_Host_ResetStats();
+
+    if (png_dir) {
+        char path[256];
+        snprintf(path, sizeof(path), "%s/%02d.png", png_dir, png_index++);
+        if (ST7789_Host_SavePNG(path) != 0) {
+            fprintf(stderr, "could not write %s\n", path);
+        }
+    }
+    return total;
+}
+
+/// @brief Starts a scenario, both of its passes start from the frame on the panel now
+static void scenario_begin(void) {
+    ST7789_Host_Snapshot(start_frame);
+}
+
+/// @brief Ends the legacy pass of a scenario, keeps its frame and puts the starting frame back
+/// @return Total bytes of the pass
+static uint32_t legacy_done(const char *name) {
+    uint32_t total = report(name);
+    ST7789_Host_Snapshot(legacy_frame);
+    ST7789_Host_Restore(start_frame);
+    return total;
+}
+
+/// @brief Prints the reduction between two totals and whether the new pass drew the legacy pass's frame
+static void reduction(uint32_t before, uint32_t after) {
+    ST7789_Host_Snapshot(new_frame);
+    uint32_t differ = 0;
+    for (uint32_t i = 0; i < FRAME_PIXELS; i++) {
+        differ += new_frame[i] != legacy_frame[i];
+    }
+    mismatches += differ != 0;
+    printf("%-28s %.1f%% fewer SPI bytes, ", "  -> reduction", 100.0 * (double)(before - after) / (double)before);
+    if (differ) {
+        printf("FRAME MISMATCH, %u pixels differ\n\n", differ);
+    } else {
+        printf("same frame\n\n");
+    }
+}
+
+/// @brief Prints the reduction between two totals for passes that do not draw the same frame
+static void reduction_unchecked(uint32_t before, uint32_t after, const char *why) {
+    printf("%-28s %.1f%% fewer SPI bytes, frame not compared (%s)\n\n", "  -> reduction",
+           100.0 * (double)(before - after) / (double)before, why);
+}
+
+//*************************************MAIN*******************************************/
+
+int main(int argc, char **argv) {
+    uint32_t before, after;
+    uint32_t spi_hz = ST7789_HOST_SPI_HZ;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--spi-hz") == 0 && i + 1 < argc) {
+            spi_hz = (uint32_t)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--png") == 0 && i + 1 < argc) {
+            png_dir = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [--spi-hz HZ] [--png DIR]\n", argv[0]);
+            return 1;
+        }
+    }
+    ST7789_Host_SetSpiClock(spi_hz);
+    ST7789_Host_Clear(0x0000);
+
+    // Any pattern works, the cost does not depend on pixel values
+    for (uint32_t i = 0; i < sizeof(icon); i++) {
+        icon[i] = (uint8_t)i;
+    }
+
+    printf("SPI clock %u Hz\n", spi_hz);
+    printf("%-28s %8s %10s %10s %10s %9s\n", "scenario", "windows", "cmd bytes", "data bytes", "total", "spi us");
+    ST7789_Host_ResetStats();
+
+    // Home screen icons (DrawHome_Static)
+    scenario_begin();
+    for (int i = 0; i < NUM_ICONS; i++) {
+        legacy_display_photo(30 + (i % 2) * 110, 50 + (i / 2) * 110, icon, ICON_SIZE, ICON_SIZE);
+    }
+    before = legacy_done("home icons, per pixel");
+    for (int i = 0; i < NUM_ICONS; i++) {
+        display_blit(30 + (i % 2) * 110, 50 + (i / 2) * 110, ICON_SIZE, ICON_SIZE, icon, DISPLAY_BLIT_LE | DISPLAY_BLIT_FLIP_Y);
+    }
+    after = report("home icons, blit");
+    reduction(before, after);
+
+    // Cursor move (UpdateHome_Cursor clears and redraws two boxes)
+    scenario_begin();
+    for (int i = 0; i < 2; i++) {
+        ST7789_DrawRectangle(28, 48, ICON_SIZE + 4, ICON_SIZE + 4, 0x0000);
+        legacy_display_photo(30, 50, icon, ICON_SIZE, ICON_SIZE);
+    }
+    before = legacy_done("cursor move, per pixel");
+    for (int i = 0; i < 2; i++) {
+        ST7789_DrawRectangle(28, 48, ICON_SIZE + 4, ICON_SIZE + 4, 0x0000);
+        display_blit(30, 50, ICON_SIZE, ICON_SIZE, icon, DISPLAY_BLIT_LE | DISPLAY_BLIT_FLIP_Y);
+    }
+    after = report("cursor move, blit");
+    reduction(before, after);
+
+    // Camera frame (Camera_App receive loop), a gradient so a flipped or shifted row shows
+    scenario_begin();
+    for (int y = 0; y < PHOTO_SIZE; y++) {
+        for (int x = 0; x < PHOTO_SIZE; x++) {
+            ST7789_DrawPixel(x, PHOTO_SIZE - 1 - y, (uint16_t)(((x >> 3) << 11) | ((y >> 2) << 5) | ((x + y) >> 4)));
+        }
+    }
+    before = legacy_done("camera frame, per pixel");
+    for (int y = 0; y < PHOTO_SIZE; y++) {
+        display_stream_begin(0, PHOTO_SIZE - 1 - y, PHOTO_SIZE, 1);
+        for (int x = 0; x < PHOTO_SIZE; x++) {
+            display_stream_pixel((uint16_t)(((x >> 3) << 11) | ((y >> 2) << 5) | ((x + y) >> 4)));
+        }
+        display_stream_end();
+    }
+    after = report("camera frame, row stream");
+    reduction(before, after);
+
+    // Frogger entity moving 1 pixel (erase old rectangle, draw new one)
+    scenario_begin();
+    display_fill(40, 60, 60, 20, 0x39E7);
+    display_fill(41, 60, 60, 20, 0xE7E0);
+    before = legacy_done("frogger move, erase+draw");
+    comp_rect(40, 60, 60, 20, 0x39E7);
+    comp_rect(41, 60, 60, 20, 0xE7E0);
+    comp_flush();
+    after = report("frogger move, compositor");
+    reduction(before, after);
+
+    // Frogger frame, 12 entities 60 pixels wide each moving 1 pixel
+    sprite_init(lanes, 4, 20, 240);
+    sprite_begin_frame();
+    for (int i = 0; i < 12; i++) {
+        sprite_add(i, (i % 3) * 80, 20 + (i / 3 % 3) * 20, 60, 20, 0xA145);
+    }
+    sprite_end_frame();
+    ST7789_Host_ResetStats();
+    scenario_begin();
+    for (int i = 0; i < 12; i++) {
+        comp_rect((i % 3) * 80, 20 + (i / 3 % 3) * 20, 60, 20, lanes[1 + i / 3 % 3]);
+        comp_rect((i % 3) * 80 + 1, 20 + (i / 3 % 3) * 20, 60, 20, 0xA145);
+    }
+    comp_flush();
+    before = legacy_done("frogger frame, compositor");
+    sprite_begin_frame();
+    for (int i = 0; i < 12; i++) {
+        sprite_add(i, (i % 3) * 80 + 1, 20 + (i / 3 % 3) * 20, 60, 20, 0xA145);
+    }
+    sprite_end_frame();
+    after = report("frogger frame, lane sprites");
+    reduction(before, after);
+
+    // Lock screen time (size 4), clear band then glyphs through the GFX library, on a screen of its own (the
+    // text run only paints its own box)
+    ST7789_Host_Clear(0x0000);
+    scenario_begin();
+    ST7789_DrawRectangle(0, 69, 240, 32, 0x0000);
+    display_setCursor(30, 100);
+    display_setTextColor(0xFFFF);
+    display_setTextSize(4);
+    for (const char *c = "12:34:56"; *c; c++) {
+        display_print(*c);
+    }
+    before = legacy_done("clock, clear+GFX print");
+    comp_rect(0, 69, 240, 32, 0x0000);
+    comp_text(30, 100, "12:34:56", 4, 0xFFFF);
+    comp_flush();
+    after = report("clock, compositor");
+    reduction(before, after);
+    ST7789_Host_Restore(start_frame);
+    text_draw(30, 100, "12:34:56", 4, 0xFFFF, 0x0000, 210);
+    after = report("clock, text run");
+    reduction(before, after);
+
+    // Lock screen refresh, the clock is fetched every 50 ticks but changes once a minute
+    static widget_t clock;
+    widget_number_init(&clock, 30, 100, 4, 8, 0xFFFF, 0x0000);
+    widget_set_text(&clock, "9:41 PM");
+    ST7789_Host_ResetStats();
+    widget_set_text(&clock, "9:41 PM");
+    report("clock refresh, same time");
+    widget_set_text(&clock, "9:42 PM");
+    after = report("clock refresh, next minute");
+    reduction_unchecked(before, after, "no legacy pass of its own");
+
+    // Weather refresh with one field changed
+    static widget_t fields[5];
+    static const char *values[5] = { "23C", "Clear", "Atlanta, Georgia", "United States", "Humidity 40% Wind 3 m/s" };
+    static const uint8_t sizes[5] = { 5, 2, 2, 2, 1 };
+    static const int16_t rows[5] = { 240, 190, 160, 140, 110 };
+    ST7789_Host_Clear(0x0000);
+    scenario_begin();
+    for (int i = 0; i < 5; i++) {
+        text_draw(10, rows[i], i == 0 ? "24C" : values[i], sizes[i], 0xFFFF, 0x0000, 230);
+    }
+    before = legacy_done("weather refresh, text runs");
+    for (int i = 0; i < 5; i++) {
+        widget_label_init(&fields[i], 10, rows[i], sizes[i], (uint8_t)(230 / (6 * sizes[i])), 0xFFFF, 0x0000);
+        widget_set_text(&fields[i], values[i]);
+    }
+    ST7789_Host_ResetStats();
+    for (int i = 0; i < 5; i++) {
+        widget_set_text(&fields[i], i == 0 ? "24C" : values[i]);
+    }
+    after = report("weather refresh, widgets");
+    reduction(before, after);
+
+    // Compass needle turning one step (1.4 degrees), old erase + dial + redraw with Bresenham lines
+    ST7789_DrawLine(120, 140, 120 + 45, 140, 0x0000);
+    ST7789_DrawCircle(120, 140, 50, 0xFFFF);
+    ST7789_DrawLine(120, 90, 120, 95, 0xFFFF);
+    ST7789_DrawLine(120, 140, 120 + 45, 140 + 1, 0xF800);
+    before = report("needle step, erase+draw");
+    needle_draw(120, 140, NEEDLE_NONE, 0, 0xF800, 0x0000);
+    ST7789_Host_ResetStats();
+    needle_draw(120, 140, 0, 1, 0xF800, 0x0000);
+    after = report("needle step, AA delta");
+    reduction_unchecked(before, after, "anti-aliased, differs by design");
+    needle_draw(120, 140, 1, 12, 0xF800, 0x0000);
+    report("needle 15 deg, AA delta");
+
+    if (mismatches) {
+        printf("%u scenarios drew a different frame than their legacy pass\n", mismatches);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,35 @@
+// File: gpio.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Host stand-in for the TivaWare GPIO interrupt API (see driverlib_host.c)
+
+#ifndef DRIVERLIB_GPIO_H_
+#define DRIVERLIB_GPIO_H_
+
+/************************************Includes***************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define GPIO_PIN_0              0x01
+#define GPIO_PIN_1              0x02
+#define GPIO_PIN_2              0x04
+#define GPIO_PIN_3              0x08
+#define GPIO_PIN_4              0x10
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+void GPIOIntEnable(uint32_t port, uint32_t flags);
+void GPIOIntDisable(uint32_t port, uint32_t flags);
+uint32_t GPIOIntStatus(uint32_t port, bool masked);
+void GPIOIntClear(uint32_t port, uint32_t flags);
+
+/********************************Public Functions***********************************/
+
+#endif /* DRIVERLIB_GPIO_H_ */
@@ -0,0 +1,23 @@
+// File: interrupt.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Host stand-in for the TivaWare interrupt controller API (see driverlib_host.c)
+
+#ifndef DRIVERLIB_INTERRUPT_H_
+#define DRIVERLIB_INTERRUPT_H_
+
+/************************************Includes***************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/************************************Includes***************************************/
+
+/********************************Public Functions***********************************/
+
+bool IntMasterEnable(void);
+bool IntMasterDisable(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* DRIVERLIB_INTERRUPT_H_ */
@@ -0,0 +1,34 @@
+// File: sysctl.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Host stand-in for the TivaWare system control API (see driverlib_host.c)
+
+#ifndef DRIVERLIB_SYSCTL_H_
+#define DRIVERLIB_SYSCTL_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define SYSCTL_SYSDIV_2_5       0xC1000000
+#define SYSCTL_USE_PLL          0x00000000
+#define SYSCTL_OSC_MAIN         0x00000000
+#define SYSCTL_XTAL_16MHZ       0x00000540
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+void SysCtlClockSet(uint32_t config);
+uint32_t SysCtlClockGet(void);
+
+/// @brief Busy waits 3 cycles of the simulated 80 MHz clock per count
+void SysCtlDelay(uint32_t count);
+
+/********************************Public Functions***********************************/
+
+#endif /* DRIVERLIB_SYSCTL_H_ */
@@ -0,0 +1,61 @@
+// File: uart.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Host stand-in for the TivaWare UART API, UART0 is a pseudo terminal (see driverlib_host.c)
+
+#ifndef DRIVERLIB_UART_H_
+#define DRIVERLIB_UART_H_
+
+/************************************Includes***************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define UART_INT_RX             0x010
+#define UART_INT_RT             0x040
+#define UART_FIFO_TX4_8         0x02
+#define UART_FIFO_RX4_8         0x10
+#define UART_RXERROR_OVERRUN    0x08
+#define UART_CONFIG_WLEN_8      0x60
+#define UART_CONFIG_STOP_ONE    0x00
+#define UART_CONFIG_PAR_NONE    0x00
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+/// @brief Sets the line rate, the simulated line garbles bytes while Camera.py's terminal runs at another
+void UARTConfigSetExpClk(uint32_t base, uint32_t clock, uint32_t baud, uint32_t config);
+
+/// @brief The host transmit FIFO empties at once, always false
+bool UARTBusy(uint32_t base);
+
+/// @brief Blocks the calling RTOS thread until a byte arrives
+int32_t UARTCharGet(uint32_t base);
+
+void UARTCharPut(uint32_t base, unsigned char data);
+
+/// @brief Sends a byte, the host transmit FIFO is never full so this always succeeds
+bool UARTCharPutNonBlocking(uint32_t base, unsigned char data);
+bool UARTCharsAvail(uint32_t base);
+
+/// @brief Pops one received byte, -1 if the receive FIFO is empty
+int32_t UARTCharGetNonBlocking(uint32_t base);
+
+void UARTFIFOLevelSet(uint32_t base, uint32_t tx_level, uint32_t rx_level);
+void UARTIntEnable(uint32_t base, uint32_t flags);
+void UARTIntDisable(uint32_t base, uint32_t flags);
+uint32_t UARTIntStatus(uint32_t base, bool masked);
+void UARTIntClear(uint32_t base, uint32_t flags);
+
+/// @brief The host receive FIFO never overruns, always 0
+uint32_t UARTRxErrorGet(uint32_t base);
+void UARTRxErrorClear(uint32_t base);
+
+/********************************Public Functions***********************************/
+
+#endif /* DRIVERLIB_UART_H_ */
@@ -0,0 +1,620 @@
+// File: driverlib_host.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Simulated TivaWare peripherals for the POSIX port, UART0 is a pseudo terminal that
+//              Camera.py opens like the real serial port, GPIO port interrupts go through rtos_host
+
+#define _DEFAULT_SOURCE
+#define _XOPEN_SOURCE 600
+
+//************************************Includes***************************************/
+
+#include "driverlib_host.h"
+#include "rtos_host.h"
+#include "../proto.h"
+
+#include "driverlib/sysctl.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/uart.h"
+#include "driverlib/gpio.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+//*************************************Defines***************************************/
+
+#define SIM_CLOCK_HZ    80000000u
+
+//*************************************Structures***************************************/
+
+typedef struct {
+    uint8_t cmd;
+    int16_t arg;        // First payload byte the request must carry, -1 for any
+    bool framed;        // Sent back as a frame with the request's seq, otherwise as raw bytes
+    uint8_t *data;
+    uint32_t len;
+} uart_reply_t;
+
+// Bytes queued at the same time, they come off the wire one after another from start_ns
+typedef struct {
+    uint64_t start_ns;
+    uint32_t count;
+} uart_burst_t;
+
+typedef struct {
+    uint32_t base;
+    uint8_t irq;
+    uint32_t enabled;
+    uint32_t status;
+} gpio_port_t;
+
+//*************************************Variables***************************************/
+
+// UART0 receive side, guarded by the kernel lock. Bytes between rx_tail and rx_ready are off the wire and
+// in the receive FIFO, the rest up to rx_head are still arriving. The FIFO only holds UART_HOST_FIFO_SIZE
+// bytes while the receive interrupts are masked (the ISR drains it on every tick otherwise)
+static uint8_t rx[UART_HOST_RX_SIZE];
+static uint32_t rx_head = 0;
+static uint32_t rx_ready = 0;
+static uint32_t rx_tail = 0;
+static uint32_t rx_errors = 0;              // UART_RXERROR_* latched until UARTRxErrorClear
+
+// Line rate model
+static uint32_t uart_baud = UART_HOST_BAUD;
+static uint64_t wire_free_ns = 0;
+static uart_burst_t bursts[UART_HOST_MAX_BURSTS];
+static uint8_t burst_first = 0;
+static uint8_t num_bursts = 0;
+
+// Line model: the rate UART0 is set to, and the fastest rate the cable carries cleanly (0 for any)
+static uint32_t line_baud = UART_HOST_BAUD;
+static uint32_t line_limit = 0;
+static uint32_t line_bytes = 0;
+
+// Terminal speeds Camera.py can set (pyserial uses the standard termios rates)
+static const struct {
+    speed_t code;
+    uint32_t baud;
+} speeds[] = {
+    { B115200, 115200 }, { B230400, 230400 }, { B460800, 460800 }, { B921600, 921600 },
+    { B1500000, 1500000 }, { B2000000, 2000000 }, { B3000000, 3000000 },
+};
+
+// UART0 interrupt mask, receive interrupts fire while the FIFO holds data
+static uint32_t uart_int_mask = 0;
+
+static int pty = -1;
+static int pty_peer = -1;
+static char pty_name[64];
+
+static uart_reply_t replies[UART_HOST_MAX_REPLIES];
+
+// Request frames sent by the phone, answered by a reply or passed on to the terminal whole
+static proto_rx_t tx_frames;
+
+// Button interrupts on port E start enabled, like after multimod_init
+static gpio_port_t ports[] = {
+    { GPIO_PORTE_BASE, INT_GPIOE, 0xFF, 0 },
+    { GPIO_PORTF_BASE, INT_GPIOF, 0x00, 0 },
+};
+
+//*************************************Helper Functions***************************************/
+
+static gpio_port_t *gpio_port(uint32_t base) {
+    for (size_t i = 0; i < sizeof(ports) / sizeof(ports[0]); i++) {
+        if (ports[i].base == base) {
+            return &ports[i];
+        }
+    }
+    return NULL;
+}
+
+static uint64_t uart_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/// @brief Takes bytes that came off the wire into the receive FIFO (kernel lock held). With the receive
+/// interrupts masked nothing drains it, so once it holds UART_HOST_FIFO_SIZE bytes the newer ones are lost
+/// and the overrun error is latched, like on the real UART
+static void uart_rx_arrive(uint32_t count) {
+    uint32_t room = count;
+    if (!(uart_int_mask & (UART_INT_RX | UART_INT_RT))) {
+        uint32_t held = (rx_ready - rx_tail + UART_HOST_RX_SIZE) % UART_HOST_RX_SIZE;
+        room = held >= UART_HOST_FIFO_SIZE ? 0 : UART_HOST_FIFO_SIZE - held;
+        room = room < count ? room : count;
+    }
+
+    // The lost bytes follow the ones the FIFO kept, the kept ones move up over them
+    uint32_t lost = count - room;
+    if (lost) {
+        uint32_t kept = (rx_ready + room - rx_tail + UART_HOST_RX_SIZE) % UART_HOST_RX_SIZE;
+        for (uint32_t i = kept; i-- > 0; ) {
+            rx[(rx_tail + i + lost) % UART_HOST_RX_SIZE] = rx[(rx_tail + i) % UART_HOST_RX_SIZE];
+        }
+        rx_tail = (rx_tail + lost) % UART_HOST_RX_SIZE;
+        rx_errors |= UART_RXERROR_OVERRUN;
+    }
+    rx_ready = (rx_ready + count) % UART_HOST_RX_SIZE;
+}
+
+/// @brief Moves the bytes that are off the wire by now into the receive FIFO (kernel lock held)
+static void uart_rx_pace(void) {
+    uint64_t now = uart_now_ns();
+    while (num_bursts) {
+        uart_burst_t *b = &bursts[burst_first];
+        uint32_t done = b->count;
+        if (uart_baud && now < b->start_ns + (uint64_t)b->count * 10000000000ull / uart_baud) {
+            done = now <= b->start_ns ? 0 : (uint32_t)((now - b->start_ns) * uart_baud / 10000000000ull);
+        }
+        uart_rx_arrive(done);
+        if (done < b->count) {
+            b->count -= done;
+            b->start_ns += (uint64_t)done * 10000000000ull / (uart_baud ? uart_baud : 1);
+            break;
+        }
+        burst_first = (uint8_t)((burst_first + 1) % UART_HOST_MAX_BURSTS);
+        num_bursts--;
+    }
+}
+
+/// @brief True if received bytes are waiting (kernel lock held)
+static bool uart_rx_waiting(void) {
+    uart_rx_pace();
+    return rx_ready != rx_tail;
+}
+
+/// @brief Raises the UART0 interrupt if data is waiting and receive interrupts are on
+static void uart_rx_irq(void) {
+    rtos_host_lock();
+    bool raise = uart_rx_waiting() && (uart_int_mask & (UART_INT_RX | UART_INT_RT));
+    rtos_host_unlock();
+    if (raise) {
+        rtos_host_raise(INT_UART0);
+    }
+}
+
+/// @brief Kernel tick, delivers the bytes that came off the wire since the last tick
+static void uart_tick(void) {
+    uint32_t before = rx_ready;
+    uart_rx_pace();
+    if (rx_ready != before) {
+        rtos_host_notify(RTOS_HOST_EVENT_UART0);
+        uart_rx_irq();
+    }
+}
+
+/// @brief Puts bytes on the wire to the phone (kernel lock held), bytes that do not fit are dropped
+static void uart_rx_push(const uint8_t *data, uint32_t len) {
+    uint32_t queued = 0;
+    for (uint32_t i = 0; i < len; i++) {
+        uint32_t next = (rx_head + 1) % UART_HOST_RX_SIZE;
+        if (next == rx_tail) {
+            break;
+        }
+        rx[rx_head] = data[i];
+        rx_head = next;
+        queued++;
+    }
+    if (!queued) {
+        return;
+    }
+
+    // The bytes start on the wire once the previous ones are through
+    uint64_t now = uart_now_ns();
+    uint64_t start = wire_free_ns > now ? wire_free_ns : now;
+    wire_free_ns = start + (uart_baud ? (uint64_t)queued * 10000000000ull / uart_baud : 0);
+    if (num_bursts == UART_HOST_MAX_BURSTS) {
+        bursts[(burst_first + num_bursts - 1) % UART_HOST_MAX_BURSTS].count += queued;
+    } else {
+        bursts[(burst_first + num_bursts) % UART_HOST_MAX_BURSTS] = (uart_burst_t){ start, queued };
+        num_bursts++;
+    }
+}
+
+/// @brief Rate Camera.py set on its end of the terminal, 0 if unknown
+static uint32_t uart_peer_baud(void) {
+    struct termios tio;
+    if (pty_peer < 0 || tcgetattr(pty_peer, &tio) != 0) {
+        return 0;
+    }
+    for (size_t i = 0; i < sizeof(speeds) / sizeof(speeds[0]); i++) {
+        if (speeds[i].code == cfgetospeed(&tio)) {
+            return speeds[i].baud;
+        }
+    }
+    return 0;
+}
+
+/// @brief Damages bytes crossing the line like the real one would: every byte is garbage while the two ends
+/// run at different rates, and a bit flips every UART_HOST_ERROR_GAP bytes above the cable's limit
+static void uart_line(uint8_t *data, uint32_t len) {
+    uint32_t peer = uart_peer_baud();
+
+    rtos_host_lock();
+    bool mismatch = peer && peer != line_baud;
+    bool noisy = line_limit && line_baud > line_limit;
+    for (uint32_t i = 0; i < len && (mismatch || noisy); i++) {
+        if (mismatch) {
+            data[i] = (uint8_t)((data[i] ^ 0xC3) | 0x81);
+        } else if (++line_bytes % UART_HOST_ERROR_GAP == 0) {
+            data[i] ^= 0x10;
+        }
+    }
+    rtos_host_unlock();
+}
+
+static void *uart_reader_main(void *arg) {
+    (void)arg;
+    uint8_t buf[512];
+
+    while (1) {
+        ssize_t n = read(pty, buf, sizeof(buf));
+        if (n <= 0) {
+
+            // No peer yet (or it went away), poll until Camera.py opens the terminal
+            struct timespec ts = { 0, 10000000 };
+            nanosleep(&ts, NULL);
+            continue;
+        }
+        uart_line(buf, (uint32_t)n);
+        uart_host_inject(buf, (uint32_t)n);
+    }
+    return NULL;
+}
+
+//*************************************System Control***************************************/
+
+void SysCtlClockSet(uint32_t config) {
+    (void)config;
+}
+
+uint32_t SysCtlClockGet(void) {
+    return SIM_CLOCK_HZ;
+}
+
+void SysCtlDelay(uint32_t count) {
+    uint64_t ns = (uint64_t)count * 3u * 1000000000ull / SIM_CLOCK_HZ;
+    struct timespec ts = { (time_t)(ns / 1000000000ull), (long)(ns % 1000000000ull) };
+    nanosleep(&ts, NULL);
+}
+
+bool IntMasterEnable(void) {
+    return false;
+}
+
+bool IntMasterDisable(void) {
+    return false;
+}
+
+//*************************************UART***************************************/
+
+int32_t UARTCharGet(uint32_t base) {
+    if (base != UART0_BASE) {
+        return 0;
+    }
+
+    rtos_host_lock();
+    while (!uart_rx_waiting()) {
+        rtos_host_wait(RTOS_HOST_EVENT_UART0);
+    }
+    uint8_t c = rx[rx_tail];
+    rx_tail = (rx_tail + 1) % UART_HOST_RX_SIZE;
+    rtos_host_unlock();
+    return c;
+}
+
+bool UARTCharsAvail(uint32_t base) {
+    if (base != UART0_BASE) {
+        return false;
+    }
+
+    rtos_host_lock();
+    bool avail = uart_rx_waiting();
+    rtos_host_unlock();
+    return avail;
+}
+
+void UARTCharPut(uint32_t base, unsigned char data) {
+    proto_frame_t frame;
+    if (base != UART0_BASE) {
+        return;
+    }
+
+    // Requests are only answered or forwarded once their frame is complete
+    rtos_host_lock();
+    bool complete = proto_parse(&tx_frames, data, &frame);
+    rtos_host_unlock();
+    if (!complete) {
+        return;
+    }
+
+    // Scripted replies stand in for Camera.py
+    bool replied = false;
+    rtos_host_lock();
+    for (uint8_t i = 0; i < UART_HOST_MAX_REPLIES && !replied; i++) {
+        uart_reply_t *r = &replies[i];
+        if (r->len && r->cmd == frame.type && (r->arg < 0 || (frame.len && frame.payload[0] == r->arg))) {
+            if (r->framed) {
+                uint8_t out[PROTO_MAX_FRAME];
+                uart_rx_push(out, proto_encode(out, frame.type, frame.seq, r->data,
+                                               (uint16_t)(r->len < PROTO_MAX_PAYLOAD ? r->len : PROTO_MAX_PAYLOAD)));
+            } else {
+                uart_rx_push(r->data, r->len);
+            }
+            replied = true;
+        }
+    }
+    rtos_host_unlock();
+    if (replied) {
+        rtos_host_notify(RTOS_HOST_EVENT_UART0);
+        uart_rx_irq();
+        return;
+    }
+
+    uint8_t out[PROTO_MAX_FRAME];
+    uint16_t size = proto_encode(out, frame.type, frame.seq, frame.payload, frame.len);
+    uart_line(out, size);
+    if (pty >= 0 && write(pty, out, size) != size) {
+        fprintf(stderr, "uart0: write failed\n");
+    }
+}
+
+void UARTConfigSetExpClk(uint32_t base, uint32_t clock, uint32_t baud, uint32_t config) {
+    (void)clock;
+    (void)config;
+    if (base != UART0_BASE) {
+        return;
+    }
+
+    // Received bytes come off the wire at the new rate too
+    rtos_host_lock();
+    line_baud = baud;
+    uart_baud = baud;
+    rtos_host_unlock();
+}
+
+bool UARTBusy(uint32_t base) {
+    (void)base;
+    return false;
+}
+
+bool UARTCharPutNonBlocking(uint32_t base, unsigned char data) {
+    UARTCharPut(base, data);
+    return true;
+}
+
+int32_t UARTCharGetNonBlocking(uint32_t base) {
+    int32_t c = -1;
+    if (base != UART0_BASE) {
+        return c;
+    }
+
+    rtos_host_lock();
+    if (uart_rx_waiting()) {
+        c = rx[rx_tail];
+        rx_tail = (rx_tail + 1) % UART_HOST_RX_SIZE;
+    }
+    rtos_host_unlock();
+    return c;
+}
+
+void UARTFIFOLevelSet(uint32_t base, uint32_t tx_level, uint32_t rx_level) {
+    (void)base;
+    (void)tx_level;
+    (void)rx_level;
+}
+
+void UARTIntEnable(uint32_t base, uint32_t flags) {
+    if (base != UART0_BASE) {
+        return;
+    }
+    rtos_host_lock();
+    uart_rx_pace();
+    uart_int_mask |= flags;
+    rtos_host_unlock();
+    uart_rx_irq();
+}
+
+void UARTIntDisable(uint32_t base, uint32_t flags) {
+    if (base != UART0_BASE) {
+        return;
+    }
+    rtos_host_lock();
+    uart_rx_pace();
+    uart_int_mask &= ~flags;
+    rtos_host_unlock();
+}
+
+uint32_t UARTIntStatus(uint32_t base, bool masked) {
+    if (base != UART0_BASE) {
+        return 0;
+    }
+    rtos_host_lock();
+    uint32_t status = uart_rx_waiting() ? (UART_INT_RX | UART_INT_RT) : 0;
+    if (masked) {
+        status &= uart_int_mask;
+    }
+    rtos_host_unlock();
+    return status;
+}
+
+void UARTIntClear(uint32_t base, uint32_t flags) {
+    (void)base;
+    (void)flags;
+}
+
+uint32_t UARTRxErrorGet(uint32_t base) {
+    if (base != UART0_BASE) {
+        return 0;
+    }
+    rtos_host_lock();
+    uint32_t errors = rx_errors;
+    rtos_host_unlock();
+    return errors;
+}
+
+void UARTRxErrorClear(uint32_t base) {
+    if (base != UART0_BASE) {
+        return;
+    }
+    rtos_host_lock();
+    rx_errors = 0;
+    rtos_host_unlock();
+}
+
+//*************************************GPIO***************************************/
+
+void GPIOIntEnable(uint32_t port, uint32_t flags) {
+    gpio_port_t *p = gpio_port(port);
+    if (!p) {
+        return;
+    }
+
+    rtos_host_lock();
+    p->enabled |= flags;
+    bool raise = (p->status & p->enabled) != 0;
+    rtos_host_unlock();
+
+    // An edge latched while masked fires as soon as it is unmasked
+    if (raise) {
+        rtos_host_raise(p->irq);
+    }
+}
+
+void GPIOIntDisable(uint32_t port, uint32_t flags) {
+    gpio_port_t *p = gpio_port(port);
+    if (p) {
+        rtos_host_lock();
+        p->enabled &= ~flags;
+        rtos_host_unlock();
+    }
+}
+
+uint32_t GPIOIntStatus(uint32_t port, bool masked) {
+    gpio_port_t *p = gpio_port(port);
+    if (!p) {
+        return 0;
+    }
+
+    rtos_host_lock();
+    uint32_t status = masked ? (p->status & p->enabled) : p->status;
+    rtos_host_unlock();
+    return status;
+}
+
+void GPIOIntClear(uint32_t port, uint32_t flags) {
+    gpio_port_t *p = gpio_port(port);
+    if (p) {
+        rtos_host_lock();
+        p->status &= ~flags;
+        rtos_host_unlock();
+    }
+}
+
+//*************************************Host Functions***************************************/
+
+const char *uart_host_open(void) {
+    pty = posix_openpt(O_RDWR | O_NOCTTY);
+    if (pty < 0 || grantpt(pty) != 0 || unlockpt(pty) != 0) {
+        perror("uart0: posix_openpt");
+        return NULL;
+    }
+    snprintf(pty_name, sizeof(pty_name), "%s", ptsname(pty));
+
+    // Raw bytes both ways, the peer stays open so the master never sees a hangup
+    pty_peer = open(pty_name, O_RDWR | O_NOCTTY);
+    if (pty_peer >= 0) {
+        struct termios tio;
+        tcgetattr(pty_peer, &tio);
+        cfmakeraw(&tio);
+        cfsetspeed(&tio, B460800);
+        tcsetattr(pty_peer, TCSANOW, &tio);
+    }
+
+    rtos_host_add_tick_hook(uart_tick);
+
+    pthread_t reader;
+    if (pthread_create(&reader, NULL, uart_reader_main, NULL) != 0) {
+        return NULL;
+    }
+    pthread_detach(reader);
+    return pty_name;
+}
+
+void uart_host_baud(uint32_t baud) {
+    rtos_host_lock();
+    uart_baud = baud;
+    rtos_host_unlock();
+}
+
+void uart_host_limit(uint32_t baud) {
+    rtos_host_lock();
+    line_limit = baud;
+    rtos_host_unlock();
+}
+
+void uart_host_inject(const uint8_t *data, uint32_t len) {
+    rtos_host_lock();
+    uart_rx_push(data, len);
+    rtos_host_unlock();
+    rtos_host_notify(RTOS_HOST_EVENT_UART0);
+    uart_rx_irq();
+}
+
+void uart_host_reply(uint8_t cmd, int16_t arg, bool framed, const uint8_t *data, uint32_t len) {
+    uart_reply_t *slot = NULL;
+    rtos_host_lock();
+    for (uint8_t i = 0; i < UART_HOST_MAX_REPLIES && !slot; i++) {
+        if (replies[i].len && replies[i].cmd == cmd && replies[i].arg == arg) {
+            slot = &replies[i];
+        }
+    }
+    for (uint8_t i = 0; i < UART_HOST_MAX_REPLIES && !slot; i++) {
+        if (!replies[i].len) {
+            slot = &replies[i];
+        }
+    }
+    if (!slot) {
+        rtos_host_unlock();
+        return;
+    }
+
+    free(slot->data);
+    slot->cmd = cmd;
+    slot->arg = arg;
+    slot->framed = framed;
+    slot->data = NULL;
+    slot->len = 0;
+    if (len) {
+        slot->data = malloc(len);
+        memcpy(slot->data, data, len);
+        slot->len = len;
+    }
+    rtos_host_unlock();
+}
+
+void gpio_host_edge(uint32_t port, uint32_t pins) {
+    gpio_port_t *p = gpio_port(port);
+    if (!p) {
+        return;
+    }
+
+    rtos_host_lock();
+    p->status |= pins;
+    bool raise = (p->status & p->enabled) != 0;
+    rtos_host_unlock();
+
+    if (raise) {
+        rtos_host_raise(p->irq);
+    }
+}
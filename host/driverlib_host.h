@@ -0,0 +1,58 @@
+// File: driverlib_host.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Host side of the simulated TivaWare peripherals (UART0 pseudo terminal, GPIO edges)
+
+#ifndef DRIVERLIB_HOST_H_
+#define DRIVERLIB_HOST_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define UART_HOST_RX_SIZE       (1u << 18)  // Bytes on their way to the phone, holds a whole 240x240 photo
+#define UART_HOST_FIFO_SIZE     16          // Receive FIFO of the UART, bytes past it are lost while nothing drains it
+#define UART_HOST_MAX_REPLIES   8
+#define UART_HOST_BAUD          460800      // Received bytes come off the wire at this rate
+#define UART_HOST_MAX_BURSTS    64
+#define UART_HOST_ERROR_GAP     50          // Bytes between flipped bits above the line rate limit
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+/// @brief Opens the pseudo terminal behind UART0 and starts its reader
+/// @return Path of the terminal to hand to Camera.py (NULL on failure)
+const char *uart_host_open(void);
+
+/// @brief Sets the simulated line rate of UART0 RX
+/// @param baud Bits per second (10 per byte), 0 delivers every byte at once
+void uart_host_baud(uint32_t baud);
+
+/// @brief Fastest rate the simulated cable carries cleanly, every UART_HOST_ERROR_GAP-th byte gets a
+/// flipped bit above it
+/// @param baud Bits per second, 0 for no limit
+void uart_host_limit(uint32_t baud);
+
+/// @brief Queues bytes into UART0 RX as if the host had sent them
+void uart_host_inject(const uint8_t *data, uint32_t len);
+
+/// @brief Answers a request frame locally instead of forwarding it to the terminal
+/// @param cmd Request type sent by the phone
+/// @param arg First argument byte the request must carry, -1 for any
+/// @param framed Reply with a frame echoing the request (text replies), or with the raw bytes (pixel streams)
+/// @param data Reply payload or bytes (copied)
+/// @param len Reply length, 0 removes the reply
+void uart_host_reply(uint8_t cmd, int16_t arg, bool framed, const uint8_t *data, uint32_t len);
+
+/// @brief Latches an edge on GPIO pins, raising the port interrupt if it is enabled
+void gpio_host_edge(uint32_t port, uint32_t pins);
+
+/********************************Public Functions***********************************/
+
+#endif /* DRIVERLIB_HOST_H_ */
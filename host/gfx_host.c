@@ -0,0 +1,61 @@
+// File: gfx_host.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Host build of the GFX text functions, draws like the firmware library
+//              (transparent glyphs, one pixel or one size x size rectangle per set glyph pixel)
+
+//************************************Includes***************************************/
+
+#include "./MultimodDrivers/GFX_Library.h"
+#include "./MultimodDrivers/multimod.h"
+#include "../font5x7.h"
+
+//*************************************Variables***************************************/
+
+static int16_t cursor_x = 0;
+static int16_t cursor_y = 0;
+static uint16_t text_color = 0xFFFF;
+static uint8_t text_size = 1;
+
+//*************************************Public Functions***************************************/
+
+void display_setCursor(int16_t x, int16_t y) {
+    cursor_x = x;
+    cursor_y = y;
+}
+
+void display_setTextColor(uint16_t color) {
+    text_color = color;
+}
+
+void display_setTextSize(uint8_t size) {
+    text_size = size ? size : 1;
+}
+
+void display_print(char c) {
+
+    // A newline starts a new line below the current one at the left edge
+    if (c == '\n') {
+        cursor_x = 0;
+        cursor_y -= FONT_CELL_HEIGHT * text_size;
+        return;
+    }
+
+    // Glyph rows extend down from the cursor, row 0 is the top row
+    const uint8_t *glyph = font_glyph(c);
+    for (uint8_t col = 0; col < FONT_GLYPH_COLS; col++) {
+        for (uint8_t row = 0; row < FONT_CELL_HEIGHT; row++) {
+            if (!(glyph[col] & (1 << row))) {
+                continue;
+            }
+            if (text_size == 1) {
+                ST7789_DrawPixel(cursor_x + col, cursor_y - row, text_color);
+            } else {
+                ST7789_DrawRectangle(cursor_x + col * text_size, cursor_y - (row + 1) * text_size + 1,
+                                     text_size, text_size, text_color);
+            }
+        }
+    }
+
+    cursor_x += FONT_CELL_WIDTH * text_size;
+}
@@ -0,0 +1,26 @@
+// File: heading_bench.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Host run of the compass math benchmark (the same code runs on target with HEADING_BENCH)
+
+//************************************Includes***************************************/
+
+#include "../heading_bench.h"
+#include "../perf.h"
+
+#include <stdio.h>
+
+//*************************************MAIN*******************************************/
+
+int main(void) {
+    heading_bench_t r;
+    char buf[HEADING_BENCH_LINE];
+
+    perf_init();
+    heading_bench_run(&r);
+
+    for (uint8_t line = 0; heading_bench_line(&r, line, buf); line++) {
+        printf("%s\n", buf);
+    }
+    return 0;
+}
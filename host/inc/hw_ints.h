@@ -0,0 +1,13 @@
+// File: hw_ints.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Host stand-in for the TivaWare interrupt numbers used by the phone
+
+#ifndef HW_INTS_H_
+#define HW_INTS_H_
+
+#define INT_GPIOE               20
+#define INT_UART0               21
+#define INT_GPIOF               46
+
+#endif /* HW_INTS_H_ */
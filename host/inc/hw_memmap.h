@@ -0,0 +1,13 @@
+// File: hw_memmap.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Host stand-in for the TivaWare peripheral base addresses used by the phone
+
+#ifndef HW_MEMMAP_H_
+#define HW_MEMMAP_H_
+
+#define GPIO_PORTE_BASE         0x40024000
+#define GPIO_PORTF_BASE         0x40025000
+#define UART0_BASE              0x4000C000
+
+#endif /* HW_MEMMAP_H_ */
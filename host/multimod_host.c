@@ -0,0 +1,80 @@
+// File: multimod_host.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Simulated Multimod board for the POSIX port, the inputs are set by phone_sim's script
+
+//************************************Includes***************************************/
+
+#include "multimod_host.h"
+#include "driverlib_host.h"
+#include "st7789_host.h"
+
+#include "MultimodDrivers/multimod.h"
+
+//*************************************Variables***************************************/
+
+// Written by the script thread, read by the RTOS threads
+static volatile uint8_t buttons = 0;
+static volatile uint32_t joystick = ((uint32_t)MULTIMOD_HOST_JOY_CENTER << 16) | MULTIMOD_HOST_JOY_CENTER;
+static volatile int16_t mag[3] = { 200, 0, -400 };
+
+//*************************************Public Functions***************************************/
+
+void multimod_init(void) {
+    ST7789_Host_Clear(0x0000);
+}
+
+uint8_t MultimodButtons_Get(void) {
+    return buttons;
+}
+
+uint32_t JOYSTICK_GetXY(void) {
+    return joystick;
+}
+
+void BMI160_WriteRegister(uint8_t reg, uint8_t data) {
+    (void)reg;
+    (void)data;
+}
+
+void BMI160_MagSetPmuMode(uint8_t mode) {
+    (void)mode;
+}
+
+void BMI160_MagManualWrite(uint8_t addr, uint8_t reg, uint8_t data) {
+    (void)addr;
+    (void)reg;
+    (void)data;
+}
+
+int BMI160_MagManualRead(uint8_t addr, uint8_t reg, uint8_t n, uint8_t *buf) {
+    (void)addr;
+    (void)reg;
+
+    // X, Y, Z little endian like the BMM150 data registers
+    for (uint8_t i = 0; i < n; i++) {
+        uint16_t v = (uint16_t)mag[(i / 2) % 3];
+        buf[i] = (uint8_t)((i & 1) ? v >> 8 : v);
+    }
+    return 0;
+}
+
+//*************************************Host Functions***************************************/
+
+void multimod_host_buttons(uint8_t mask) {
+    if (mask == buttons) {
+        return;
+    }
+    buttons = mask;
+    gpio_host_edge(GPIO_PORTE_BASE, 0x0F);
+}
+
+void multimod_host_joystick(uint16_t x, uint16_t y) {
+    joystick = ((uint32_t)x << 16) | y;
+}
+
+void multimod_host_mag(int16_t x, int16_t y, int16_t z) {
+    mag[0] = x;
+    mag[1] = y;
+    mag[2] = z;
+}
@@ -0,0 +1,36 @@
+// File: multimod_host.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Host side of the simulated Multimod board inputs (buttons, joystick, magnetometer)
+
+#ifndef MULTIMOD_HOST_H_
+#define MULTIMOD_HOST_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Joystick ADC range, the stick rests in the middle
+#define MULTIMOD_HOST_JOY_MAX       4095
+#define MULTIMOD_HOST_JOY_CENTER    2048
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+/// @brief Sets the held buttons, a change latches a port E edge like the real button lines
+void multimod_host_buttons(uint8_t mask);
+
+/// @brief Sets the raw joystick position
+void multimod_host_joystick(uint16_t x, uint16_t y);
+
+/// @brief Sets the raw magnetometer sample returned by BMI160_MagManualRead
+void multimod_host_mag(int16_t x, int16_t y, int16_t z);
+
+/********************************Public Functions***********************************/
+
+#endif /* MULTIMOD_HOST_H_ */
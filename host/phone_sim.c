@@ -0,0 +1,256 @@
+// File: phone_sim.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Runs the unmodified phone firmware (main.c, threads.c) on the POSIX port of the RTOS,
+//              with UART0 on a pseudo terminal for Camera.py and scripted board inputs
+//              Usage: phone_sim [--script FILE] [--spi-hz HZ] [--baud BAUD] [--link-limit BAUD] [--sleep-min MS]
+
+//************************************Includes***************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "./st7789_host.h"
+#include "./driverlib_host.h"
+#include "./multimod_host.h"
+#include "./rtos_host.h"
+#include "../uart_rx.h"
+#include "../link.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//*************************************Defines***************************************/
+
+#define SIM_LINE_SIZE   512
+
+//*************************************Variables***************************************/
+
+static FILE *script = NULL;
+static const char *script_path = NULL;
+
+//*************************************Helper Functions***************************************/
+
+// main.c is built with main renamed
+int phone_main(void);
+
+static void sim_sleep_until(uint32_t ms) {
+    while (rtos_host_millis() < ms) {
+        struct timespec ts = { 0, 1000000 };
+        nanosleep(&ts, NULL);
+    }
+}
+
+/// @brief Expands \n, \\ and \xHH escapes in place and returns the length
+static uint32_t sim_unescape(char *s) {
+    char *out = s;
+    for (char *in = s; *in; in++) {
+        if (in[0] != '\\' || !in[1]) {
+            *out++ = *in;
+            continue;
+        }
+        in++;
+        if (*in == 'n') {
+            *out++ = '\n';
+        } else if (*in == 'x' && in[1] && in[2]) {
+            char hex[3] = { in[1], in[2], 0 };
+            *out++ = (char)strtoul(hex, NULL, 16);
+            in += 2;
+        } else {
+            *out++ = *in;
+        }
+    }
+    *out = '\0';
+    return (uint32_t)(out - s);
+}
+
+/// @brief Reads a whole file for a binary reply
+static uint8_t *sim_read_file(const char *path, uint32_t *len) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *data = size > 0 ? malloc((size_t)size) : NULL;
+    if (data && fread(data, 1, (size_t)size, f) != (size_t)size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    *len = (uint32_t)size;
+    return data;
+}
+
+/// @brief Runs one script command, returns false on quit
+static bool sim_command(char *cmd, char *args, int line) {
+    if (strcmp(cmd, "button") == 0) {
+        multimod_host_buttons((uint8_t)strtoul(args, NULL, 0));
+    } else if (strcmp(cmd, "joystick") == 0) {
+        unsigned x = MULTIMOD_HOST_JOY_CENTER, y = MULTIMOD_HOST_JOY_CENTER;
+        sscanf(args, "%u %u", &x, &y);
+        multimod_host_joystick((uint16_t)x, (uint16_t)y);
+    } else if (strcmp(cmd, "mag") == 0) {
+        int x = 0, y = 0, z = 0;
+        sscanf(args, "%d %d %d", &x, &y, &z);
+        multimod_host_mag((int16_t)x, (int16_t)y, (int16_t)z);
+    } else if (strcmp(cmd, "uart") == 0) {
+        uint32_t len = sim_unescape(args);
+        uart_host_inject((const uint8_t *)args, len);
+    } else if (strcmp(cmd, "frame") == 0) {
+
+        // frame C text, a frame the host sends on its own (C U unlocks)
+        uint8_t out[PROTO_MAX_FRAME];
+        char *text = args[0] ? args + 1 : args;
+        while (*text == ' ') text++;
+        uint32_t len = sim_unescape(text);
+        uart_host_inject(out, proto_encode(out, (uint8_t)args[0], 0, (const uint8_t *)text,
+                                           (uint16_t)(len < PROTO_MAX_PAYLOAD ? len : PROTO_MAX_PAYLOAD)));
+    } else if (strcmp(cmd, "reply") == 0) {
+
+        // reply C text (a frame) or reply C @file (raw bytes), C\xHH only answers requests whose first
+        // argument byte is HH
+        uint8_t key = (uint8_t)args[0];
+        int16_t arg = -1;
+        char *text = args[0] ? args + 1 : args;
+        if (text[0] == '\\' && text[1] == 'x' && text[2] && text[3]) {
+            char hex[3] = { text[2], text[3], 0 };
+            arg = (int16_t)strtoul(hex, NULL, 16);
+            text += 4;
+        }
+        while (*text == ' ') text++;
+        if (*text == '@') {
+            uint32_t len = 0;
+            uint8_t *data = sim_read_file(text + 1, &len);
+            if (!data) {
+                fprintf(stderr, "%s:%d: cannot read %s\n", script_path, line, text + 1);
+                return true;
+            }
+            uart_host_reply(key, arg, false, data, len);
+            free(data);
+        } else {
+            uint32_t len = sim_unescape(text);
+            uart_host_reply(key, arg, true, (const uint8_t *)text, len);
+        }
+    } else if (strcmp(cmd, "link-limit") == 0) {
+        uart_host_limit((uint32_t)strtoul(args, NULL, 10));
+    } else if (strcmp(cmd, "sleep-min") == 0) {
+        rtos_host_sleep_min((uint32_t)strtoul(args, NULL, 10));
+    } else if (strcmp(cmd, "png") == 0) {
+        if (ST7789_Host_SavePNG(args) != 0) {
+            fprintf(stderr, "%s:%d: cannot write %s\n", script_path, line, args);
+        }
+    } else if (strcmp(cmd, "stats") == 0) {
+        st7789_stats_t s = ST7789_Host_GetStats();
+        printf("[%6u ms] %-24s windows %6u  command bytes %8u  data bytes %9u  spi %8u us\n",
+               rtos_host_millis(), args, s.windows, s.command_bytes, s.data_bytes, ST7789_Host_SpiMicros(&s));
+        fflush(stdout);
+        ST7789_Host_ResetStats();
+    } else if (strcmp(cmd, "rxstats") == 0) {
+        uart_rx_stats_t r = uart_rx_stats();
+        proto_stats_t p = proto_stats();
+        link_stats_t l = link_stats();
+        printf("[%6u ms] %-24s rx bytes %9u  overruns %u  stalls %u  timeouts %u  high water %u"
+               "  frames %u  crc errors %u  skipped %u\n", rtos_host_millis(), args, r.bytes, r.overruns, r.stalls,
+               r.timeouts, r.high_water, p.frames, p.crc_errors, p.skipped);
+        printf("[%6u ms] %-24s requests %u  replies %u  timeouts %u  unmatched %u  streams %u  failed %u"
+               "  most in flight %u\n", rtos_host_millis(), args, l.requests, l.replies, l.timeouts, l.unmatched,
+               l.streams, l.failed_streams, l.max_in_flight);
+        printf("[%6u ms] %-24s baud %u  negotiations %u  probe errors %u  fallbacks %u\n", rtos_host_millis(), args,
+               l.baud, l.negotiations, l.probe_errors, l.fallbacks);
+        fflush(stdout);
+    } else if (strcmp(cmd, "quit") == 0) {
+        return false;
+    } else {
+        fprintf(stderr, "%s:%d: unknown command %s\n", script_path, line, cmd);
+    }
+    return true;
+}
+
+/// @brief Script thread, each line is "TIME_MS COMMAND ARGS" with times since launch
+static void *sim_script_main(void *arg) {
+    (void)arg;
+    char buf[SIM_LINE_SIZE];
+    int line = 0;
+
+    while (fgets(buf, sizeof(buf), script)) {
+        line++;
+        buf[strcspn(buf, "\r\n")] = '\0';
+
+        char *p = buf;
+        while (*p == ' ' || *p == '\t') p++;
+        if (*p == '\0' || *p == '#') {
+            continue;
+        }
+
+        char *end;
+        unsigned long at = strtoul(p, &end, 10);
+        if (end == p) {
+            fprintf(stderr, "%s:%d: missing time\n", script_path, line);
+            continue;
+        }
+        p = end;
+        while (*p == ' ' || *p == '\t') p++;
+        char *cmd = p;
+        while (*p && *p != ' ' && *p != '\t') p++;
+        if (*p) {
+            *p++ = '\0';
+            while (*p == ' ' || *p == '\t') p++;
+        }
+
+        sim_sleep_until((uint32_t)at);
+        if (!sim_command(cmd, p, line)) {
+            exit(0);
+        }
+    }
+
+    // Script over, keep running for Camera.py
+    return NULL;
+}
+
+//*************************************Main***************************************/
+
+int main(int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--script") == 0 && i + 1 < argc) {
+            script_path = argv[++i];
+        } else if (strcmp(argv[i], "--spi-hz") == 0 && i + 1 < argc) {
+            ST7789_Host_SetSpiClock((uint32_t)strtoul(argv[++i], NULL, 10));
+        } else if (strcmp(argv[i], "--baud") == 0 && i + 1 < argc) {
+            uart_host_baud((uint32_t)strtoul(argv[++i], NULL, 10));
+        } else if (strcmp(argv[i], "--link-limit") == 0 && i + 1 < argc) {
+            uart_host_limit((uint32_t)strtoul(argv[++i], NULL, 10));
+        } else if (strcmp(argv[i], "--sleep-min") == 0 && i + 1 < argc) {
+            rtos_host_sleep_min((uint32_t)strtoul(argv[++i], NULL, 10));
+        } else {
+            fprintf(stderr, "usage: %s [--script FILE] [--spi-hz HZ] [--baud BAUD] [--link-limit BAUD]"
+                    " [--sleep-min MS]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    const char *tty = uart_host_open();
+    if (!tty) {
+        return 1;
+    }
+    printf("UART0 on %s\n", tty);
+    fflush(stdout);
+
+    if (script_path) {
+        script = fopen(script_path, "r");
+        if (!script) {
+            perror(script_path);
+            return 1;
+        }
+        pthread_t thread;
+        pthread_create(&thread, NULL, sim_script_main, NULL);
+        pthread_detach(thread);
+    }
+
+    // The firmware entry point, never returns
+    return phone_main();
+}
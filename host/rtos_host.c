@@ -0,0 +1,406 @@
+// File: rtos_host.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: POSIX port of the RTOS API, every RTOS thread is a pthread but only the one holding
+//              the CPU token runs, so priorities and semaphores behave like on the TM4C123.
+//              Threads are switched inside RTOS calls (there is no timer preemption of plain code),
+//              which matches the phone threads since every loop sleeps or waits each pass
+
+#define _POSIX_C_SOURCE 200809L
+
+//************************************Includes***************************************/
+
+#include "RTOS/RTOS.h"
+#include "rtos_host.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+//*************************************Defines***************************************/
+
+#define RTOS_HOST_MAX_THREADS   16
+#define RTOS_HOST_MAX_EVENTS    8
+#define RTOS_HOST_IDLE_PRIORITY 255         // The host idles in the tick thread instead
+#define RTOS_HOST_TICK_NS       1000000ull  // Kernel tick and round robin slice
+
+//*************************************Structures***************************************/
+
+typedef enum {
+    THREAD_READY,
+    THREAD_SLEEPING,
+    THREAD_SEMAPHORE,
+    THREAD_EVENT,
+    THREAD_DEAD
+} thread_state_t;
+
+typedef struct {
+    void (*entry)(void);
+    uint8_t priority;
+    char *name;
+    pthread_t handle;
+    pthread_cond_t turn;        // Signalled when the thread is handed the CPU
+    thread_state_t state;
+    uint64_t wake_ns;           // Sleep deadline
+    semaphore_t *blocked_on;    // Semaphore the thread waits on
+    uint8_t event;              // Host event the thread waits on
+    uint32_t last_run;          // Dispatch order, oldest runs first among equal priorities
+} rtos_thread_t;
+
+typedef struct {
+    void (*handler)(void);
+    uint8_t priority;
+    uint8_t irq;
+    bool pending;
+} rtos_event_t;
+
+//*************************************Variables***************************************/
+
+// Kernel lock, every scheduler structure and the simulated driver state sit behind it
+static pthread_mutex_t kernel;
+static pthread_cond_t tick_wake;
+static pthread_once_t kernel_once = PTHREAD_ONCE_INIT;
+
+static rtos_thread_t threads[RTOS_HOST_MAX_THREADS];
+static uint8_t num_threads = 0;
+
+// Thread holding the CPU token (NULL when every thread is blocked)
+static rtos_thread_t *current = NULL;
+static _Thread_local rtos_thread_t *self = NULL;
+static uint64_t slice_start = 0;
+static uint32_t dispatches = 0;
+
+static rtos_event_t events[RTOS_HOST_MAX_EVENTS];
+static uint8_t num_events = 0;
+
+static void (*tick_hooks[RTOS_HOST_MAX_TICK_HOOKS])(void);
+static uint8_t num_tick_hooks = 0;
+
+static bool launched = false;
+static uint64_t launch_ns = 0;
+
+// Shortest sleep, a phone whose threads wake late (0 sleeps as asked)
+static uint32_t sleep_min_ms = 0;
+
+//*************************************Helper Functions***************************************/
+
+/// @brief Creates the kernel lock on first use (the simulated drivers may be set up before RTOS_Init)
+static void rtos_kernel_init(void) {
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&kernel, &attr);
+    pthread_mutexattr_destroy(&attr);
+
+    // Sleep deadlines and the tick use the monotonic clock
+    pthread_condattr_t cattr;
+    pthread_condattr_init(&cattr);
+    pthread_condattr_setclock(&cattr, CLOCK_MONOTONIC);
+    pthread_cond_init(&tick_wake, &cattr);
+    pthread_condattr_destroy(&cattr);
+}
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/// @brief Picks the ready thread with the highest priority, the least recently run one on a tie
+static rtos_thread_t *rtos_pick(void) {
+    rtos_thread_t *best = NULL;
+    for (uint8_t i = 0; i < num_threads; i++) {
+        rtos_thread_t *t = &threads[i];
+        if (t->state != THREAD_READY) {
+            continue;
+        }
+        if (!best || t->priority < best->priority ||
+            (t->priority == best->priority && (int32_t)(t->last_run - best->last_run) < 0)) {
+            best = t;
+        }
+    }
+    return best;
+}
+
+/// @brief Hands the CPU token to a thread (NULL parks the CPU until something wakes up)
+static void rtos_dispatch(rtos_thread_t *t) {
+    current = t;
+    if (t) {
+        t->last_run = ++dispatches;
+        slice_start = now_ns();
+        pthread_cond_signal(&t->turn);
+    }
+}
+
+/// @brief Waits until the calling thread holds the CPU token
+static void rtos_wait_turn(void) {
+    while (current != self) {
+        pthread_cond_wait(&self->turn, &kernel);
+    }
+}
+
+/// @brief Gives the CPU away after the calling thread left the ready state
+static void rtos_block(void) {
+    rtos_dispatch(rtos_pick());
+    rtos_wait_turn();
+}
+
+/// @brief Preemption point, switches if a higher priority thread is ready or the slice ran out
+static void rtos_yield_point(void) {
+    if (!self || current != self) {
+        return;
+    }
+    rtos_thread_t *next = rtos_pick();
+    if (next && next != self &&
+        (next->priority < self->priority ||
+         (next->priority == self->priority && now_ns() - slice_start >= RTOS_HOST_TICK_NS))) {
+        rtos_dispatch(next);
+        rtos_wait_turn();
+    }
+}
+
+/// @brief Restarts the CPU when a thread became ready while it was parked
+static void rtos_wake(rtos_thread_t *t) {
+    t->state = THREAD_READY;
+    if (!current) {
+        rtos_dispatch(rtos_pick());
+    }
+}
+
+static void *rtos_thread_main(void *arg) {
+    self = arg;
+
+    pthread_mutex_lock(&kernel);
+    rtos_wait_turn();
+    pthread_mutex_unlock(&kernel);
+
+    self->entry();
+
+    // Threads are not expected to return, treat it like a kill
+    pthread_mutex_lock(&kernel);
+    self->state = THREAD_DEAD;
+    rtos_dispatch(rtos_pick());
+    pthread_mutex_unlock(&kernel);
+    return NULL;
+}
+
+static void rtos_start(rtos_thread_t *t) {
+    if (pthread_create(&t->handle, NULL, rtos_thread_main, t) != 0) {
+        fprintf(stderr, "rtos_host: cannot start thread %s\n", t->name);
+        exit(1);
+    }
+}
+
+/// @brief Kernel tick, wakes sleeping threads and runs raised interrupt handlers
+static void *rtos_tick_main(void *arg) {
+    (void)arg;
+
+    pthread_mutex_lock(&kernel);
+    while (1) {
+        uint64_t now = now_ns();
+        uint64_t next = now + RTOS_HOST_TICK_NS;
+
+        for (uint8_t i = 0; i < num_threads; i++) {
+            rtos_thread_t *t = &threads[i];
+            if (t->state != THREAD_SLEEPING) {
+                continue;
+            }
+            if (t->wake_ns <= now) {
+                rtos_wake(t);
+            } else if (t->wake_ns < next) {
+                next = t->wake_ns;
+            }
+        }
+
+        // Device models may raise interrupts for this tick
+        for (uint8_t i = 0; i < num_tick_hooks; i++) {
+            tick_hooks[i]();
+        }
+
+        // Interrupts in priority order, handlers run outside any thread
+        for (uint8_t n = 0; n < num_events; n++) {
+            rtos_event_t *best = NULL;
+            for (uint8_t i = 0; i < num_events; i++) {
+                if (events[i].pending && (!best || events[i].priority < best->priority)) {
+                    best = &events[i];
+                }
+            }
+            if (!best) {
+                break;
+            }
+            best->pending = false;
+            best->handler();
+        }
+
+        struct timespec ts = { (time_t)(next / 1000000000ull), (long)(next % 1000000000ull) };
+        pthread_cond_timedwait(&tick_wake, &kernel, &ts);
+    }
+    return NULL;
+}
+
+//*************************************Public Functions***************************************/
+
+void RTOS_Init(void) {
+    pthread_once(&kernel_once, rtos_kernel_init);
+}
+
+int RTOS_AddThread(void (*thread)(void), uint8_t priority, char *name) {
+    if (priority == RTOS_HOST_IDLE_PRIORITY) {
+        return 0;
+    }
+
+    rtos_host_lock();
+    if (num_threads == RTOS_HOST_MAX_THREADS) {
+        rtos_host_unlock();
+        return -1;
+    }
+    rtos_thread_t *t = &threads[num_threads++];
+    *t = (rtos_thread_t){ .entry = thread, .priority = priority, .name = name, .state = THREAD_READY };
+    pthread_cond_init(&t->turn, NULL);
+    if (launched) {
+        rtos_start(t);
+        rtos_wake(t);
+        rtos_yield_point();
+    }
+    rtos_host_unlock();
+    return 0;
+}
+
+int RTOS_Add_APeriodicEvent(void (*handler)(void), uint8_t priority, uint8_t irq) {
+    rtos_host_lock();
+    if (num_events == RTOS_HOST_MAX_EVENTS) {
+        rtos_host_unlock();
+        return -1;
+    }
+    events[num_events++] = (rtos_event_t){ handler, priority, irq, false };
+    rtos_host_unlock();
+    return 0;
+}
+
+void RTOS_Launch(void) {
+    rtos_host_lock();
+    launched = true;
+    launch_ns = now_ns();
+    for (uint8_t i = 0; i < num_threads; i++) {
+        rtos_start(&threads[i]);
+    }
+    rtos_dispatch(rtos_pick());
+    rtos_host_unlock();
+
+    // The launching thread becomes the tick and never returns
+    rtos_tick_main(NULL);
+}
+
+void RTOS_InitSemaphore(semaphore_t *s, int32_t value) {
+    rtos_host_lock();
+    *s = value;
+    rtos_host_unlock();
+}
+
+void RTOS_WaitSemaphore(semaphore_t *s) {
+    rtos_host_lock();
+    (*s)--;
+    if (*s < 0 && self) {
+        self->state = THREAD_SEMAPHORE;
+        self->blocked_on = s;
+        rtos_block();
+    } else {
+        rtos_yield_point();
+    }
+    rtos_host_unlock();
+}
+
+void RTOS_SignalSemaphore(semaphore_t *s) {
+    rtos_host_lock();
+    (*s)++;
+    if (*s <= 0) {
+
+        // Wake the highest priority waiter, the oldest one on a tie
+        rtos_thread_t *best = NULL;
+        for (uint8_t i = 0; i < num_threads; i++) {
+            rtos_thread_t *t = &threads[i];
+            if (t->state == THREAD_SEMAPHORE && t->blocked_on == s &&
+                (!best || t->priority < best->priority ||
+                 (t->priority == best->priority && (int32_t)(t->last_run - best->last_run) < 0))) {
+                best = t;
+            }
+        }
+        if (best) {
+            best->blocked_on = NULL;
+            rtos_wake(best);
+        }
+    }
+    rtos_yield_point();
+    rtos_host_unlock();
+}
+
+void sleep(uint32_t ms) {
+    rtos_host_lock();
+    if (self) {
+        self->state = THREAD_SLEEPING;
+        self->wake_ns = now_ns() + (uint64_t)(ms > sleep_min_ms ? ms : sleep_min_ms) * 1000000ull;
+        pthread_cond_signal(&tick_wake);
+        rtos_block();
+    }
+    rtos_host_unlock();
+}
+
+//*************************************Host Functions***************************************/
+
+void rtos_host_lock(void) {
+    pthread_once(&kernel_once, rtos_kernel_init);
+    pthread_mutex_lock(&kernel);
+}
+
+void rtos_host_unlock(void) {
+    pthread_mutex_unlock(&kernel);
+}
+
+void rtos_host_wait(uint8_t event) {
+    if (!self) {
+        return;
+    }
+    self->state = THREAD_EVENT;
+    self->event = event;
+    rtos_block();
+}
+
+void rtos_host_notify(uint8_t event) {
+    rtos_host_lock();
+    for (uint8_t i = 0; i < num_threads; i++) {
+        rtos_thread_t *t = &threads[i];
+        if (t->state == THREAD_EVENT && t->event == event) {
+            rtos_wake(t);
+        }
+    }
+    rtos_yield_point();
+    rtos_host_unlock();
+}
+
+void rtos_host_raise(uint8_t irq) {
+    rtos_host_lock();
+    for (uint8_t i = 0; i < num_events; i++) {
+        if (events[i].irq == irq) {
+            events[i].pending = true;
+        }
+    }
+    pthread_cond_signal(&tick_wake);
+    rtos_host_unlock();
+}
+
+void rtos_host_add_tick_hook(void (*hook)(void)) {
+    if (num_tick_hooks < RTOS_HOST_MAX_TICK_HOOKS) {
+        tick_hooks[num_tick_hooks++] = hook;
+    }
+}
+
+void rtos_host_sleep_min(uint32_t ms) {
+    rtos_host_lock();
+    sleep_min_ms = ms;
+    rtos_host_unlock();
+}
+
+uint32_t rtos_host_millis(void) {
+    return launched ? (uint32_t)((now_ns() - launch_ns) / 1000000ull) : 0;
+}
@@ -0,0 +1,55 @@
+// File: rtos_host.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Hooks of the host RTOS port for the simulated drivers (interrupts, blocking on host events)
+
+#ifndef RTOS_HOST_H_
+#define RTOS_HOST_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Host events a thread can block on
+#define RTOS_HOST_EVENT_UART0   0
+#define RTOS_HOST_EVENTS        4
+
+#define RTOS_HOST_MAX_TICK_HOOKS 4
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+/// @brief Takes the kernel lock, driver state shared with the RTOS threads is guarded by it
+void rtos_host_lock(void);
+
+/// @brief Releases the kernel lock
+void rtos_host_unlock(void);
+
+/// @brief Blocks the calling RTOS thread until the event is notified (kernel lock held once)
+void rtos_host_wait(uint8_t event);
+
+/// @brief Makes every thread blocked on an event ready (any host thread, lock held or not)
+void rtos_host_notify(uint8_t event);
+
+/// @brief Raises an interrupt, its handler runs in interrupt context on the next kernel tick
+void rtos_host_raise(uint8_t irq);
+
+/// @brief Runs a device model every kernel tick (kernel lock held), before the interrupts are handled
+///        Register hooks before RTOS_Launch
+void rtos_host_add_tick_hook(void (*hook)(void));
+
+/// @brief Makes every sleep last at least ms, a phone whose threads wake late (a coarse tick, busier
+///        threads) and so read the UART too slowly at high rates
+void rtos_host_sleep_min(uint32_t ms);
+
+/// @brief Milliseconds since RTOS_Launch
+uint32_t rtos_host_millis(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* RTOS_HOST_H_ */
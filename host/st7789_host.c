@@ -0,0 +1,366 @@
+// File: st7789_host.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Host simulator of the ST7789 driver, keeps a framebuffer and counts the SPI traffic
+//              that would reach the panel
+
+//************************************Includes***************************************/
+
+#include "./st7789_host.h"
+#include "./MultimodDrivers/multimod.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+//*************************************Defines***************************************/
+
+// ST7789 commands used by the driver
+#define ST7789_CASET    0x2A
+#define ST7789_RASET    0x2B
+#define ST7789_RAMWR    0x2C
+
+// Stored deflate blocks hold at most this many bytes
+#define PNG_BLOCK       65535u
+
+//*************************************Variables***************************************/
+
+static uint16_t framebuffer[ST7789_HOST_HEIGHT][ST7789_HOST_WIDTH];
+
+static st7789_stats_t stats;
+static uint32_t spi_hz = ST7789_HOST_SPI_HZ;
+
+// Command decoding
+static uint8_t command = 0;
+static uint8_t params[4];
+static uint8_t num_params = 0;
+
+// Address window and write position
+static uint16_t win_x0 = 0, win_x1 = ST7789_HOST_WIDTH - 1;
+static uint16_t win_y0 = 0, win_y1 = ST7789_HOST_HEIGHT - 1;
+static uint16_t pos_x = 0, pos_y = 0;
+static bool high_byte = true;
+static uint8_t pixel_high;
+
+//*************************************Helper Functions***************************************/
+
+/// @brief Stores one pixel at the write position and advances it through the window
+static void st7789_host_pixel(uint16_t color) {
+    if (pos_x < ST7789_HOST_WIDTH && pos_y < ST7789_HOST_HEIGHT) {
+        framebuffer[pos_y][pos_x] = color;
+    }
+
+    // Columns first, then the next row up, wrapping to the start like the panel
+    if (++pos_x > win_x1) {
+        pos_x = win_x0;
+        if (++pos_y > win_y1) {
+            pos_y = win_y0;
+        }
+    }
+}
+
+/// @brief CRC32 of the PNG chunks
+static uint32_t png_crc(uint32_t crc, const uint8_t *data, uint32_t len) {
+    static uint32_t table[256];
+    static bool ready = false;
+
+    if (!ready) {
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            table[n] = c;
+        }
+        ready = true;
+    }
+
+    crc = ~crc;
+    while (len--) {
+        crc = table[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+/// @brief Writes a big endian 32 bit value
+static void png_u32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+/// @brief Writes one PNG chunk
+static void png_chunk(FILE *f, const char *type, const uint8_t *data, uint32_t len) {
+    uint8_t head[8];
+    uint8_t tail[4];
+
+    png_u32(head, len);
+    for (int i = 0; i < 4; i++) {
+        head[4 + i] = (uint8_t)type[i];
+    }
+    uint32_t crc = png_crc(0, &head[4], 4);
+    crc = png_crc(crc, data, len);
+    png_u32(tail, crc);
+
+    fwrite(head, 1, sizeof(head), f);
+    fwrite(data, 1, len, f);
+    fwrite(tail, 1, sizeof(tail), f);
+}
+
+//*************************************Public Functions***************************************/
+
+void ST7789_Host_ResetStats(void) {
+    stats = (st7789_stats_t){0};
+}
+
+st7789_stats_t ST7789_Host_GetStats(void) {
+    return stats;
+}
+
+void ST7789_Host_SetSpiClock(uint32_t hz) {
+    spi_hz = hz ? hz : ST7789_HOST_SPI_HZ;
+}
+
+uint32_t ST7789_Host_SpiMicros(const st7789_stats_t *s) {
+    uint64_t bits = 8ull * ((uint64_t)s->command_bytes + s->data_bytes);
+    return (uint32_t)((bits * 1000000ull + spi_hz / 2) / spi_hz);
+}
+
+void ST7789_Host_Clear(uint16_t color) {
+    for (int y = 0; y < ST7789_HOST_HEIGHT; y++) {
+        for (int x = 0; x < ST7789_HOST_WIDTH; x++) {
+            framebuffer[y][x] = color;
+        }
+    }
+}
+
+uint16_t ST7789_Host_GetPixel(int16_t x, int16_t y) {
+    if (x < 0 || y < 0 || x >= ST7789_HOST_WIDTH || y >= ST7789_HOST_HEIGHT) {
+        return 0;
+    }
+    return framebuffer[y][x];
+}
+
+void ST7789_Host_Snapshot(uint16_t *out) {
+    memcpy(out, framebuffer, sizeof(framebuffer));
+}
+
+void ST7789_Host_Restore(const uint16_t *in) {
+    memcpy(framebuffer, in, sizeof(framebuffer));
+}
+
+int ST7789_Host_SavePNG(const char *path) {
+    enum { ROW = 1 + 3 * ST7789_HOST_WIDTH, RAW = ROW * ST7789_HOST_HEIGHT };
+    static uint8_t raw[RAW];
+    static uint8_t zlib[2 + RAW + 5 * (RAW / PNG_BLOCK + 1) + 4];
+    uint8_t header[13];
+
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        return -1;
+    }
+
+    // Scanlines, no filter, top of the screen first
+    uint8_t *p = raw;
+    for (int y = ST7789_HOST_HEIGHT - 1; y >= 0; y--) {
+        *p++ = 0;
+        for (int x = 0; x < ST7789_HOST_WIDTH; x++) {
+            uint16_t c = framebuffer[y][x];
+            uint8_t r = (uint8_t)((c >> 11) & 0x1F), g = (uint8_t)((c >> 5) & 0x3F), b = (uint8_t)(c & 0x1F);
+            *p++ = (uint8_t)((r << 3) | (r >> 2));
+            *p++ = (uint8_t)((g << 2) | (g >> 4));
+            *p++ = (uint8_t)((b << 3) | (b >> 2));
+        }
+    }
+
+    // zlib stream of stored deflate blocks
+    uint32_t n = 0, a = 1, b = 0;
+    zlib[n++] = 0x78;
+    zlib[n++] = 0x01;
+    for (uint32_t off = 0; off < RAW; off += PNG_BLOCK) {
+        uint32_t len = RAW - off < PNG_BLOCK ? RAW - off : PNG_BLOCK;
+        zlib[n++] = (off + len == RAW) ? 1 : 0;
+        zlib[n++] = (uint8_t)len;
+        zlib[n++] = (uint8_t)(len >> 8);
+        zlib[n++] = (uint8_t)~len;
+        zlib[n++] = (uint8_t)(~len >> 8);
+        for (uint32_t i = 0; i < len; i++) {
+            zlib[n++] = raw[off + i];
+            a = (a + raw[off + i]) % 65521u;
+            b = (b + a) % 65521u;
+        }
+    }
+    png_u32(&zlib[n], (b << 16) | a);
+    n += 4;
+
+    // 8 bit RGB
+    png_u32(&header[0], ST7789_HOST_WIDTH);
+    png_u32(&header[4], ST7789_HOST_HEIGHT);
+    header[8] = 8;
+    header[9] = 2;
+    header[10] = header[11] = header[12] = 0;
+
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    fwrite(signature, 1, sizeof(signature), f);
+    png_chunk(f, "IHDR", header, sizeof(header));
+    png_chunk(f, "IDAT", zlib, n);
+    png_chunk(f, "IEND", NULL, 0);
+
+    return fclose(f) == 0 ? 0 : -1;
+}
+
+void ST7789_Select(void) {
+}
+
+void ST7789_Deselect(void) {
+}
+
+void ST7789_WriteCommand(uint8_t cmd) {
+    stats.commands++;
+    stats.command_bytes++;
+    command = cmd;
+    num_params = 0;
+
+    // RAMWR starts at the corner of the window
+    if (cmd == ST7789_RAMWR) {
+        pos_x = win_x0;
+        pos_y = win_y0;
+        high_byte = true;
+    }
+}
+
+void ST7789_WriteData(uint8_t data) {
+
+    // Data bytes after RAMWR are pixels, before it they are parameters
+    if (command == ST7789_RAMWR) {
+        stats.data_bytes++;
+        if (high_byte) {
+            pixel_high = data;
+        } else {
+            st7789_host_pixel((uint16_t)((pixel_high << 8) | data));
+        }
+        high_byte = !high_byte;
+        return;
+    }
+
+    stats.command_bytes++;
+    if (num_params < sizeof(params)) {
+        params[num_params++] = data;
+    }
+    if (num_params == 4) {
+        if (command == ST7789_CASET) {
+            win_x0 = (uint16_t)((params[0] << 8) | params[1]);
+            win_x1 = (uint16_t)((params[2] << 8) | params[3]);
+        } else if (command == ST7789_RASET) {
+            win_y0 = (uint16_t)((params[0] << 8) | params[1]);
+            win_y1 = (uint16_t)((params[2] << 8) | params[3]);
+        }
+    }
+}
+
+void ST7789_SetWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+    int16_t x1 = x + w - 1;
+    int16_t y1 = y + h - 1;
+
+    stats.windows++;
+
+    // Column range
+    ST7789_WriteCommand(ST7789_CASET);
+    ST7789_WriteData((uint8_t)(x >> 8));
+    ST7789_WriteData((uint8_t)x);
+    ST7789_WriteData((uint8_t)(x1 >> 8));
+    ST7789_WriteData((uint8_t)x1);
+
+    // Row range
+    ST7789_WriteCommand(ST7789_RASET);
+    ST7789_WriteData((uint8_t)(y >> 8));
+    ST7789_WriteData((uint8_t)y);
+    ST7789_WriteData((uint8_t)(y1 >> 8));
+    ST7789_WriteData((uint8_t)y1);
+
+    // Start memory write
+    ST7789_WriteCommand(ST7789_RAMWR);
+}
+
+void ST7789_DrawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x < 0 || y < 0 || x >= ST7789_HOST_WIDTH || y >= ST7789_HOST_HEIGHT) {
+        return;
+    }
+    ST7789_Select();
+    ST7789_SetWindow(x, y, 1, 1);
+    ST7789_WriteData((uint8_t)(color >> 8));
+    ST7789_WriteData((uint8_t)color);
+    ST7789_Deselect();
+}
+
+void ST7789_DrawRectangle(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+
+    // Clipped to the panel like the driver
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > ST7789_HOST_WIDTH) w = ST7789_HOST_WIDTH - x;
+    if (y + h > ST7789_HOST_HEIGHT) h = ST7789_HOST_HEIGHT - y;
+    if (w <= 0 || h <= 0) {
+        return;
+    }
+
+    uint32_t count = (uint32_t)w * (uint16_t)h;
+
+    ST7789_Select();
+    ST7789_SetWindow(x, y, w, h);
+    while (count--) {
+        ST7789_WriteData((uint8_t)(color >> 8));
+        ST7789_WriteData((uint8_t)color);
+    }
+    ST7789_Deselect();
+}
+
+void ST7789_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    int16_t dx = x1 > x0 ? x1 - x0 : x0 - x1;
+    int16_t dy = y1 > y0 ? y0 - y1 : y1 - y0;
+    int16_t sx = x0 < x1 ? 1 : -1;
+    int16_t sy = y0 < y1 ? 1 : -1;
+    int16_t err = dx + dy;
+
+    // Bresenham, one pixel at a time like the driver
+    while (1) {
+        ST7789_DrawPixel(x0, y0, color);
+        if (x0 == x1 && y0 == y1) {
+            break;
+        }
+        int16_t e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+void ST7789_DrawCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color) {
+    int16_t x = r, y = 0;
+    int16_t err = 1 - r;
+
+    // Midpoint circle, eight symmetric pixels per step
+    while (x >= y) {
+        ST7789_DrawPixel(cx + x, cy + y, color);
+        ST7789_DrawPixel(cx + y, cy + x, color);
+        ST7789_DrawPixel(cx - y, cy + x, color);
+        ST7789_DrawPixel(cx - x, cy + y, color);
+        ST7789_DrawPixel(cx - x, cy - y, color);
+        ST7789_DrawPixel(cx - y, cy - x, color);
+        ST7789_DrawPixel(cx + y, cy - x, color);
+        ST7789_DrawPixel(cx + x, cy - y, color);
+        y++;
+        if (err < 0) {
+            err += 2 * y + 1;
+        } else {
+            x--;
+            err += 2 * (y - x) + 1;
+        }
+    }
+}
@@ -0,0 +1,80 @@
+// File: st7789_host.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Host simulator of the ST7789 driver, keeps a framebuffer and counts the SPI traffic
+//              that would reach the panel
+
+#ifndef ST7789_HOST_H_
+#define ST7789_HOST_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Panel size, row 0 of the framebuffer is the lowest Y (bottom of the screen)
+#define ST7789_HOST_WIDTH       240
+#define ST7789_HOST_HEIGHT      280
+
+// Default SPI clock used for time estimates
+#define ST7789_HOST_SPI_HZ      20000000u
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+// SPI traffic seen by the panel
+typedef struct {
+    uint32_t commands;      // Command opcodes (DC low)
+    uint32_t command_bytes; // Opcodes plus their parameter bytes
+    uint32_t data_bytes;    // Pixel bytes written after RAMWR
+    uint32_t windows;       // Address window changes (CASET + RASET + RAMWR)
+} st7789_stats_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+/// @brief Clears the traffic counters
+void ST7789_Host_ResetStats(void);
+
+/// @brief Reads the traffic counters
+/// @return Copy of the counters since the last reset
+st7789_stats_t ST7789_Host_GetStats(void);
+
+/// @brief Sets the SPI clock used by ST7789_Host_SpiMicros
+/// @param hz SPI clock in Hz
+void ST7789_Host_SetSpiClock(uint32_t hz);
+
+/// @brief Estimates how long the traffic takes on the wire (8 clocks per byte, no gaps)
+/// @param stats Traffic counters
+/// @return Time in microseconds
+uint32_t ST7789_Host_SpiMicros(const st7789_stats_t *stats);
+
+/// @brief Fills the framebuffer without counting any traffic (a known starting picture)
+/// @param color RGB565 color
+void ST7789_Host_Clear(uint16_t color);
+
+/// @brief Reads one framebuffer pixel
+/// @return RGB565 color, 0 outside the panel
+uint16_t ST7789_Host_GetPixel(int16_t x, int16_t y);
+
+/// @brief Copies the framebuffer
+/// @param out ST7789_HOST_WIDTH * ST7789_HOST_HEIGHT pixels, row 0 is the lowest Y
+void ST7789_Host_Snapshot(uint16_t *out);
+
+/// @brief Overwrites the framebuffer without counting any traffic (back to a snapshot)
+/// @param in Pixels as written by ST7789_Host_Snapshot
+void ST7789_Host_Restore(const uint16_t *in);
+
+/// @brief Writes the framebuffer as an RGB PNG, the highest Y is the top row of the image
+/// @param path Output file
+/// @return 0 on success, -1 if the file could not be written
+int ST7789_Host_SavePNG(const char *path);
+
+/********************************Public Functions***********************************/
+
+#endif /* ST7789_HOST_H_ */
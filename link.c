@@ -0,0 +1,484 @@
+// File: link.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: UART0 transport service, one thread owns the link to Camera.py. Apps queue tagged
+//              requests and sleep on their own completion semaphore while the thread sends the frames
+//              and hands each reply to the request whose tag (the frame seq) it carries. The thread also
+//              negotiates the line rate with Camera.py, probing rates above the base one and dropping back
+//              when requests stop getting through
+
+//************************************Includes***************************************/
+
+// Local Files
+#include "./link.h"
+#include "./threads.h"
+#include "./uart_rx.h"
+
+#include <string.h>
+
+// Driverlib
+#include "driverlib/sysctl.h"
+#include "driverlib/uart.h"
+#include "inc/hw_memmap.h"
+
+//*************************************Variables***************************************/
+
+// Requests queued or in flight, in submit order (guarded by UARTSemaphore)
+static link_request_t *queue[LINK_QUEUE];
+static uint8_t queued = 0;
+static uint8_t next_tag = 0;
+
+static link_listener_t listener = NULL;
+static link_stats_t stats;
+
+// Pixel streams: no new request goes out while one is wanted, the transport leaves the receive ring
+// alone while one runs. A stream only starts between two iterations of the transport thread (busy is
+// set and cleared under UARTSemaphore), so no frame read or rate change overlaps it
+static semaphore_t sem_stream;
+static volatile bool stream_wanted = false;
+static volatile bool streaming = false;
+static volatile bool busy = false;
+
+// Line rate, no pixel stream starts while a negotiation runs
+static const uint32_t rates[] = LINK_RATES;
+static uint32_t baud = LINK_BAUD_BASE;
+static uint32_t ceiling = UINT32_MAX;       // Rates from this one up failed their probes
+static uint32_t errors = 0;                 // Timeouts, bad frames, overruns and failed streams in this window
+static uint8_t window = 0;                  // Requests sent in it
+static uint32_t crc_seen = 0;               // proto_stats().crc_errors already counted
+static uint32_t overruns_seen = 0;          // uart_rx_stats().overruns already counted
+static uint8_t proposals_lost = 0;          // Rate proposals in a row the host did not answer
+static volatile bool negotiating = false;
+
+//*************************************Helper Functions***************************************/
+
+/// @brief Writes bytes to UART0, sleeping while the transmit FIFO is full instead of spinning
+static void link_write(const uint8_t *data, uint16_t len) {
+    for (uint16_t i = 0; i < len; i++) {
+        while (!UARTCharPutNonBlocking(UART0_BASE, data[i])) {
+            sleep(LINK_POLL_MS);
+        }
+    }
+}
+
+/// @brief Counts a request frame that went out, errors are counted per window of LINK_FALLBACK_WINDOW
+static void link_sent(void) {
+    stats.requests++;
+    if (++window >= LINK_FALLBACK_WINDOW) {
+        window = 0;
+        errors = 0;
+    }
+}
+
+/// @brief Removes a request from the queue and wakes its owner (UARTSemaphore held)
+static void link_finish(uint8_t i, bool ok) {
+    link_request_t *req = queue[i];
+    memmove(&queue[i], &queue[i + 1], (queued - i - 1) * sizeof(queue[0]));
+    queued--;
+
+    req->ok = ok;
+    req->state = LINK_DONE;
+    if (ok) {
+        stats.replies++;
+    } else {
+        stats.timeouts++;
+        errors++;
+    }
+    RTOS_SignalSemaphore(&req->done);
+}
+
+/// @brief Sends every queued request, in submit order
+static void link_send_queued(void) {
+    uint8_t frame[PROTO_OVERHEAD + LINK_MAX_ARGS];
+
+    while (!stream_wanted) {
+
+        // Tag and encode under the lock, write without it so apps can keep submitting
+        link_request_t *req = NULL;
+        uint8_t in_flight = 0;
+        RTOS_WaitSemaphore(&UARTSemaphore);
+        for (uint8_t i = 0; i < queued; i++) {
+            if (queue[i]->state == LINK_QUEUED && !req) {
+                req = queue[i];
+                req->tag = next_tag++;
+                req->state = LINK_SENT;
+            }
+            in_flight += queue[i]->state == LINK_SENT;
+        }
+        RTOS_SignalSemaphore(&UARTSemaphore);
+        if (!req) {
+            return;
+        }
+
+        link_write(frame, proto_encode(frame, req->type, req->tag, req->args, req->args_len));
+        link_sent();
+        if (in_flight > stats.max_in_flight) {
+            stats.max_in_flight = in_flight;
+        }
+    }
+}
+
+/// @brief Hands a received frame to the request it answers, or to the listener
+static void link_dispatch(const proto_frame_t *frame) {
+    bool matched = false;
+
+    RTOS_WaitSemaphore(&UARTSemaphore);
+    for (uint8_t i = 0; i < queued && !matched; i++) {
+        link_request_t *req = queue[i];
+        if (req->state == LINK_SENT && req->tag == frame->seq && req->type == frame->type) {
+            req->reply_len = frame->len < req->reply_max ? frame->len : req->reply_max;
+            if (req->reply_len) {
+                memcpy(req->reply, frame->payload, req->reply_len);
+            }
+            link_finish(i, true);
+            matched = true;
+        }
+    }
+    RTOS_SignalSemaphore(&UARTSemaphore);
+
+    if (!matched) {
+        stats.unmatched++;
+        if (listener) {
+            listener(frame);
+        }
+    }
+}
+
+/// @brief Counts the time of every request in flight and ends the ones past their deadline
+static void link_expire(uint32_t ms) {
+    RTOS_WaitSemaphore(&UARTSemaphore);
+    for (uint8_t i = 0; i < queued; ) {
+        link_request_t *req = queue[i];
+        if (req->state == LINK_SENT) {
+            req->waited_ms += ms;
+            if (req->waited_ms >= req->timeout_ms) {
+                link_finish(i, false);
+                continue;
+            }
+        }
+        i++;
+    }
+    RTOS_SignalSemaphore(&UARTSemaphore);
+}
+
+/// @brief Switches UART0 to a new rate once the bytes already written are out
+static void link_set_baud(uint32_t rate) {
+    while (UARTBusy(UART0_BASE)) {
+        sleep(LINK_POLL_MS);
+    }
+    UARTConfigSetExpClk(UART0_BASE, SysCtlClockGet(), rate,
+                        UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE | UART_CONFIG_PAR_NONE);
+    baud = rate;
+    stats.baud = rate;
+
+    // Camera.py switches within the guard time, whatever arrived meanwhile is garbage
+    sleep(LINK_SWITCH_MS);
+    uart_rx_flush();
+}
+
+/// @brief Sends a negotiation frame and waits for its echo, other frames are dispatched as usual
+/// @return Reply length, -1 if no reply came within LINK_PROBE_MS
+static int32_t link_exchange(uint8_t type, const uint8_t *payload, uint16_t len, uint8_t *reply,
+                             uint16_t reply_max) {
+    uint8_t frame[PROTO_OVERHEAD + LINK_PROBE_BYTES];
+    proto_frame_t in;
+    uint8_t tag = next_tag++;
+
+    link_write(frame, proto_encode(frame, type, tag, payload, len));
+    for (uint32_t waited = 0; waited < LINK_PROBE_MS; ) {
+        if (!proto_receive(&in, LINK_POLL_MS)) {
+            waited += LINK_POLL_MS;
+            continue;
+        }
+        if (in.type == type && in.seq == tag) {
+            uint16_t n = in.len < reply_max ? in.len : reply_max;
+            memcpy(reply, in.payload, n);
+            return n;
+        }
+        link_dispatch(&in);
+    }
+    return -1;
+}
+
+/// @brief Test pattern of a probe: the sync word, all zeros, all ones and alternating bits, then a counter
+/// from seed that steps through every byte value (tools/proto.py builds the same for bursts)
+static void link_pattern(uint8_t seed, uint8_t *out, uint16_t len) {
+    static const uint8_t head[] = { PROTO_SYNC0, PROTO_SYNC1, 0x00, 0xFF, 0x55, 0xAA };
+    for (uint16_t i = 0; i < len; i++) {
+        out[i] = i < sizeof(head) ? head[i] : (uint8_t)(seed + i * 37u);
+    }
+}
+
+/// @brief Asks for LINK_BURST_FRAMES full frames back to back and reads them as they arrive. The burst is
+/// longer than the receive ring, so a rate the ISR or this reader cannot keep up with loses bytes
+/// @return True if every frame came in whole, in order and without a receive overrun
+static bool link_burst(void) {
+    uint8_t frame[PROTO_OVERHEAD + 1];
+    uint8_t count = LINK_BURST_FRAMES;
+    uint8_t pattern[PROTO_MAX_PAYLOAD];
+    uint32_t overruns = uart_rx_stats().overruns;
+    proto_frame_t in;
+    uint8_t tag = next_tag++;
+    uint8_t got = 0;
+
+    link_write(frame, proto_encode(frame, PROTO_TYPE_BURST, tag, &count, 1));
+    for (uint32_t waited = 0; waited < LINK_PROBE_MS && got < LINK_BURST_FRAMES; ) {
+        if (!proto_receive(&in, LINK_POLL_MS)) {
+            waited += LINK_POLL_MS;
+            continue;
+        }
+        if (in.type != PROTO_TYPE_BURST || in.seq != tag) {
+            link_dispatch(&in);
+            continue;
+        }
+
+        // A frame lost to a bad CRC shows up as the next one out of order
+        link_pattern(got, pattern, PROTO_MAX_PAYLOAD);
+        if (in.len != PROTO_MAX_PAYLOAD || memcmp(in.payload, pattern, PROTO_MAX_PAYLOAD) != 0) {
+            return false;
+        }
+        got++;
+    }
+    return got == LINK_BURST_FRAMES && uart_rx_stats().overruns == overruns;
+}
+
+/// @brief Proposes one rate, probes it and commits it
+/// @return True if the link now runs at rate
+static bool link_try(uint32_t rate) {
+    uint8_t arg[4] = { (uint8_t)(rate >> 24), (uint8_t)(rate >> 16), (uint8_t)(rate >> 8), (uint8_t)rate };
+    uint8_t pattern[LINK_PROBE_BYTES];
+    uint8_t reply[LINK_PROBE_BYTES];
+    uint32_t previous = baud;
+
+    // The host echoes a rate it takes and switches, an empty reply refuses it
+    int32_t n = link_exchange(PROTO_TYPE_BAUD, arg, sizeof(arg), reply, sizeof(reply));
+    proposals_lost = n < 0 ? proposals_lost + 1 : 0;
+    if (n != sizeof(arg) || memcmp(reply, arg, sizeof(arg)) != 0) {
+        return false;
+    }
+    link_set_baud(rate);
+
+    // Every probe must come back whole (its CRC) and unchanged (the pattern), and the burst must be received
+    // at full speed, then the second B commits
+    bool ok = true;
+    for (uint8_t p = 0; p < LINK_PROBES && ok; p++) {
+        link_pattern((uint8_t)(p * LINK_PROBE_BYTES), pattern, LINK_PROBE_BYTES);
+        ok = link_exchange(PROTO_TYPE_PROBE, pattern, LINK_PROBE_BYTES, reply, sizeof(reply)) == LINK_PROBE_BYTES &&
+             memcmp(reply, pattern, LINK_PROBE_BYTES) == 0;
+    }
+    if (ok) {
+        ok = link_burst();
+    }
+    if (ok) {
+        ok = link_exchange(PROTO_TYPE_BAUD, arg, sizeof(arg), reply, sizeof(reply)) == sizeof(arg) &&
+             memcmp(reply, arg, sizeof(arg)) == 0;
+    }
+    if (ok) {
+        return true;
+    }
+
+    // The host drops an uncommitted rate on its own after LINK_TRIAL_MS, wait that out at the old rate
+    stats.probe_errors++;
+    ceiling = rate;
+    link_set_baud(previous);
+    sleep(LINK_TRIAL_MS);
+    uart_rx_flush();
+    return false;
+}
+
+/// @brief Steps the line rate up through LINK_RATES until a rate fails or the host refuses or ignores it
+static void link_negotiate(void) {
+
+    // A pixel stream about to start keeps the line, try again once the host is heard from
+    RTOS_WaitSemaphore(&UARTSemaphore);
+    negotiating = !stream_wanted;
+    RTOS_SignalSemaphore(&UARTSemaphore);
+    if (!negotiating) {
+        proposals_lost = 1;
+        return;
+    }
+
+    stats.negotiations++;
+    for (uint8_t i = 0; i < sizeof(rates) / sizeof(rates[0]) && rates[i] < ceiling; i++) {
+        if (rates[i] > baud && !link_try(rates[i])) {
+            break;
+        }
+    }
+    negotiating = false;
+
+    // Probes of a failed rate are not errors of the one the link settled on
+    errors = 0;
+    window = 0;
+    crc_seen = proto_stats().crc_errors;
+    overruns_seen = uart_rx_stats().overruns;
+}
+
+/// @brief Drops back to the base rate once errors pile up at a negotiated one (Camera.py does the same on the
+/// garbage it reads once the two ends no longer match) and works up again below the rate that failed.
+/// Bytes lost to receive overruns count too, the line has no flow control
+static void link_check_rate(void) {
+    uint32_t crc_errors = proto_stats().crc_errors;
+    uint32_t overruns = uart_rx_stats().overruns;
+    errors += (crc_errors - crc_seen) + (overruns - overruns_seen);
+    crc_seen = crc_errors;
+    overruns_seen = overruns;
+    if (baud == LINK_BAUD_BASE || errors < LINK_FALLBACK_ERRORS) {
+        return;
+    }
+
+    stats.fallbacks++;
+    ceiling = baud;
+    proposals_lost = 0;
+    link_set_baud(LINK_BAUD_BASE);
+    link_negotiate();
+}
+
+//*************************************Public Functions***************************************/
+
+void link_init(void) {
+    RTOS_InitSemaphore(&sem_stream, 1);
+    stats.baud = baud;
+}
+
+void Link_Thread(void) {
+    proto_frame_t frame;
+
+    link_negotiate();
+    while (1) {
+
+        // A pixel stream has the receive ring to itself, otherwise the ring is the transport's until the
+        // iteration ends
+        RTOS_WaitSemaphore(&UARTSemaphore);
+        busy = !streaming;
+        RTOS_SignalSemaphore(&UARTSemaphore);
+        if (!busy) {
+            sleep(LINK_IDLE_MS);
+            continue;
+        }
+
+        link_check_rate();
+        link_send_queued();
+        bool heard = false;
+        while (proto_receive(&frame, 0)) {
+            link_dispatch(&frame);
+            heard = true;
+        }
+
+        // The host was not there for the last proposal (Camera.py started late, or is still at the old rate
+        // after a fallback), propose again once it is heard from. A second lost proposal is a host that does
+        // not negotiate, it stays at the rate it has
+        if (heard && proposals_lost == 1) {
+            link_negotiate();
+        }
+
+        RTOS_WaitSemaphore(&UARTSemaphore);
+        busy = false;
+        RTOS_SignalSemaphore(&UARTSemaphore);
+
+        // Poll fast while a reply is due, slowly while only an unlock could come
+        uint32_t period = queued ? LINK_POLL_MS : LINK_IDLE_MS;
+        sleep(period);
+        link_expire(period);
+    }
+}
+
+void link_listen(link_listener_t fn) {
+    listener = fn;
+}
+
+bool link_submit(link_request_t *req, uint8_t type, const uint8_t *args, uint16_t len, uint8_t *reply,
+                 uint16_t reply_max, uint32_t timeout_ms) {
+    req->type = type;
+    req->args_len = len < LINK_MAX_ARGS ? len : LINK_MAX_ARGS;
+    if (req->args_len) {
+        memcpy(req->args, args, req->args_len);
+    }
+    req->reply = reply;
+    req->reply_max = reply ? reply_max : 0;
+    req->reply_len = 0;
+    req->timeout_ms = timeout_ms;
+    req->waited_ms = 0;
+    req->ok = false;
+    req->state = LINK_QUEUED;
+    RTOS_InitSemaphore(&req->done, 0);
+
+    RTOS_WaitSemaphore(&UARTSemaphore);
+    bool room = queued < LINK_QUEUE;
+    if (room) {
+        queue[queued++] = req;
+    }
+    RTOS_SignalSemaphore(&UARTSemaphore);
+
+    if (!room) {
+        req->state = LINK_DONE;
+        RTOS_SignalSemaphore(&req->done);
+    }
+    return room;
+}
+
+bool link_poll(link_request_t *req) {
+    return req->state == LINK_DONE;
+}
+
+bool link_wait(link_request_t *req) {
+    RTOS_WaitSemaphore(&req->done);
+    return req->ok;
+}
+
+int32_t link_request(uint8_t type, const uint8_t *args, uint16_t len, uint8_t *reply, uint16_t reply_max,
+                     uint32_t timeout_ms) {
+    link_request_t req;
+    link_submit(&req, type, args, len, reply, reply_max, timeout_ms);
+    return link_wait(&req) ? req.reply_len : -1;
+}
+
+void link_stream_begin(void) {
+    RTOS_WaitSemaphore(&sem_stream);
+    stream_wanted = true;
+
+    // Replies still due (or a rate negotiation) would land in the middle of the stream, and the transport
+    // thread may be part way through reading frames or switching the rate
+    while (1) {
+        RTOS_WaitSemaphore(&UARTSemaphore);
+        bool in_flight = false;
+        for (uint8_t i = 0; i < queued; i++) {
+            in_flight |= queue[i]->state == LINK_SENT;
+        }
+        if (!in_flight && !negotiating && !busy) {
+            streaming = true;
+        }
+        RTOS_SignalSemaphore(&UARTSemaphore);
+        if (streaming) {
+            break;
+        }
+        sleep(LINK_POLL_MS);
+    }
+    stats.streams++;
+}
+
+void link_stream_send(uint8_t type, const uint8_t *args, uint16_t len) {
+    uint8_t frame[PROTO_OVERHEAD + LINK_MAX_ARGS];
+    uint8_t tag = next_tag++;
+    link_write(frame, proto_encode(frame, type, tag, args, len < LINK_MAX_ARGS ? len : LINK_MAX_ARGS));
+    link_sent();
+}
+
+void link_stream_end(bool ok) {
+
+    // The transport thread leaves the error count alone until streaming is cleared
+    if (!ok) {
+        stats.failed_streams++;
+        errors++;
+    }
+    streaming = false;
+    stream_wanted = false;
+    RTOS_SignalSemaphore(&sem_stream);
+}
+
+uint32_t link_baud(void) {
+    return baud;
+}
+
+link_stats_t link_stats(void) {
+    return stats;
+}
@@ -0,0 +1,145 @@
+// File: link.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: UART0 transport service, one thread owns the link to Camera.py. Apps queue tagged
+//              requests and sleep on their own completion semaphore while the thread sends the frames
+//              and hands each reply to the request whose tag (the frame seq) it carries. The thread also
+//              negotiates the line rate with Camera.py, probing rates above the base one and dropping back
+//              when requests stop getting through
+
+#ifndef LINK_H_
+#define LINK_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./RTOS/RTOS.h"
+#include "./proto.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define LINK_QUEUE          8       // Requests queued or waiting for their reply at once
+#define LINK_MAX_ARGS       16      // Argument bytes a request carries
+#define LINK_POLL_MS        1       // Transport thread period while anything is in flight
+#define LINK_IDLE_MS        5       // Transport thread period while nothing is
+#define LINK_PRIORITY       1
+
+// Line rate: the link starts at LINK_BAUD_BASE, proposes each faster rate with a B frame, checks it with
+// echoed Q probes and an S burst and commits it with a second B frame at the new rate (see link_negotiate
+// in link.c)
+#define LINK_BAUD_BASE      460800
+#define LINK_RATES          { 921600, 1500000, 2000000, 3000000 }  // Tried in order, must match tools/proto.py
+#define LINK_PROBES         3       // Probe frames echoed per rate
+#define LINK_PROBE_BYTES    64      // Test pattern per probe
+#define LINK_BURST_FRAMES   8       // Full frames of the burst, twice UART_RX_RING_SIZE so it must be read as it arrives
+#define LINK_PROBE_MS       200     // Deadline of each negotiation reply
+#define LINK_SWITCH_MS      10      // Guard time after a rate change, Camera.py switches within it
+#define LINK_TRIAL_MS       1000    // Camera.py goes back to its previous rate unless a trial is committed by then
+#define LINK_FALLBACK_ERRORS 3      // Timeouts, bad frames, overruns or failed streams within a window of requests
+#define LINK_FALLBACK_WINDOW 16     // Requests per window
+
+// Request states
+#define LINK_QUEUED         0
+#define LINK_SENT           1
+#define LINK_DONE           2
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+// One request, owned by the caller until it is done (keep it and its buffers alive until then)
+typedef struct {
+    uint8_t type;               // Frame type, the command letter
+    uint8_t args[LINK_MAX_ARGS];
+    uint16_t args_len;
+    uint8_t *reply;             // Reply payload, cut to reply_max
+    uint16_t reply_max;
+    uint16_t reply_len;
+    uint32_t timeout_ms;        // From the frame going out
+    uint32_t waited_ms;
+    uint8_t tag;                // Sequence number of its frame
+    volatile uint8_t state;
+    bool ok;                    // A reply arrived in time
+    semaphore_t done;           // Signalled once when the request is done
+} link_request_t;
+
+// Frames nobody asked for (the unlock), called on the transport thread
+typedef void (*link_listener_t)(const proto_frame_t *frame);
+
+typedef struct {
+    uint32_t requests;          // Frames sent
+    uint32_t replies;           // Replies matched to a request
+    uint32_t timeouts;          // Requests done without a reply
+    uint32_t unmatched;         // Frames with no request waiting (late replies, unlocks)
+    uint32_t streams;           // Pixel streams handed to a caller
+    uint32_t failed_streams;    // Pixel streams that missed a deadline or came in short
+    uint8_t max_in_flight;      // Most requests in flight at once
+    uint32_t baud;              // Line rate now
+    uint32_t negotiations;      // Rate negotiations started
+    uint32_t probe_errors;      // Probes lost or echoed wrong
+    uint32_t fallbacks;         // Drops back to LINK_BAUD_BASE
+} link_stats_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+/// @brief Sets up the queue (before RTOS_Launch, the thread is added with RTOS_AddThread)
+void link_init(void);
+
+/// @brief Transport thread, the only thread that writes UART0 or reads frames from it
+void Link_Thread(void);
+
+/// @brief Sets the handler of frames that answer no request
+void link_listen(link_listener_t listener);
+
+/// @brief Queues a request and returns at once
+/// @param req Request, owned by the transport until link_poll or link_wait reports it done
+/// @param type Frame type
+/// @param args Arguments (up to LINK_MAX_ARGS bytes, copied)
+/// @param len Argument length
+/// @param reply Reply buffer (may be NULL)
+/// @param reply_max Room in reply
+/// @param timeout_ms Deadline for the reply
+/// @return False if the queue is full (the request is then done and not ok)
+bool link_submit(link_request_t *req, uint8_t type, const uint8_t *args, uint16_t len, uint8_t *reply,
+                 uint16_t reply_max, uint32_t timeout_ms);
+
+/// @brief True once the request is done, never blocks
+bool link_poll(link_request_t *req);
+
+/// @brief Sleeps on the completion semaphore of a request
+/// @return True if its reply arrived in time
+bool link_wait(link_request_t *req);
+
+/// @brief Queues a request and sleeps until it is done
+/// @return Reply length, or -1 if no reply arrived in time
+int32_t link_request(uint8_t type, const uint8_t *args, uint16_t len, uint8_t *reply, uint16_t reply_max,
+                     uint32_t timeout_ms);
+
+// Pixel streams (photos, video) are read by the caller straight from uart_rx:
+//   link_stream_begin(); set up line mode; link_stream_send(cmd, args, len); read; link_stream_end(ok);
+
+/// @brief Waits for the requests in flight to finish and takes the receive side from the transport
+void link_stream_begin(void);
+
+/// @brief Sends the request frame of a stream (between link_stream_begin and link_stream_end)
+void link_stream_send(uint8_t type, const uint8_t *args, uint16_t len);
+
+/// @brief Hands the receive side back to the transport
+/// @param ok False if the stream missed a deadline or came in short, it counts towards dropping the rate back
+void link_stream_end(bool ok);
+
+/// @brief Line rate UART0 runs at now
+uint32_t link_baud(void);
+
+/// @brief Copy of the counters since boot
+link_stats_t link_stats(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* LINK_H_ */
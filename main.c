@@ -14,6 +14,9 @@
 #include "RTOS/RTOS.h"
 #include "MultimodDrivers/multimod.h"
 #include "threads.h"
+#include "heading_bench.h"
+#include "uart_rx.h"
+#include "link.h"
 
 // Driverlib includes
 #include "driverlib/sysctl.h"
@@ -44,6 +47,12 @@ int main(void) {
     // The interrupts will pend until RTOS_Launch enables them.
     multimod_init();
 
+#ifdef HEADING_BENCH
+    // Compass math benchmark, the results stay on the panel (build with HEADING_BENCH defined)
+    heading_bench_show();
+    while (1);
+#endif
+
     // 5. Initialize Semaphores
     RTOS_InitSemaphore(&sem_Button, 0);    // Start Blocked (Waiting for ISR)
     RTOS_InitSemaphore(&sem_Camera, 0);    // Start Blocked
@@ -65,10 +74,18 @@ int main(void) {
     // Handles selection (Enter) and exiting apps
     RTOS_AddThread(Read_Buttons, 2, "Buttons");
 
+    // LINK Thread
+    // Owns UART0, sends the queued host requests and hands out their replies
+    link_init();
+    RTOS_AddThread(Link_Thread, LINK_PRIORITY, "Link");
+
     // 7. Register Interrupts
     // Button Interrupt (Port E)
     RTOS_Add_APeriodicEvent(Button_Handler, 5, INT_GPIOE);
 
+    // UART0 receive interrupt, fills the ring the host replies are read from
+    uart_rx_init();
+
     // 8. Launch OS
     RTOS_Launch();
 
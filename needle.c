@@ -0,0 +1,155 @@
+// File: needle.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Anti-aliased compass needle drawn from a per-angle span table, only the pixels that
+//              differ between the old and the new needle are sent
+
+//************************************Includes***************************************/
+
+// Local Files
+#include "./needle.h"
+#include "./display.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+//*************************************Defines***************************************/
+
+#define NEEDLE_LINE     (2 * NEEDLE_REACH + 1)
+#define NEEDLE_QUARTER  (NEEDLE_ANGLES / 4)
+
+//*************************************Structures***************************************/
+
+// One needle step, the table angle plus the mirrors that turn it into the right quadrant
+typedef struct {
+    bool valid;
+    bool flip_x, flip_y;
+    int8_t dy0;                             // First table row (relative to the center)
+    uint8_t rows;
+    const uint8_t *row[NEEDLE_LINE];        // Start of each table row
+} needle_shape_t;
+
+//*************************************Variables***************************************/
+
+static needle_shape_t old_shape, new_shape;
+
+// Coverage of one screen row, index 0 is NEEDLE_REACH pixels left of the center
+static uint8_t old_line[NEEDLE_LINE];
+static uint8_t new_line[NEEDLE_LINE];
+
+//*************************************Helper Functions***************************************/
+
+/// @brief Blends two RGB565 colors, weight in thirds of the first color
+static uint16_t needle_blend(uint16_t fg, uint16_t bg, uint8_t weight) {
+    uint16_t r = (uint16_t)((((fg >> 11) & 0x1F) * weight + ((bg >> 11) & 0x1F) * (3 - weight)) / 3);
+    uint16_t g = (uint16_t)((((fg >> 5) & 0x3F) * weight + ((bg >> 5) & 0x3F) * (3 - weight)) / 3);
+    uint16_t b = (uint16_t)(((fg & 0x1F) * weight + (bg & 0x1F) * (3 - weight)) / 3);
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+/// @brief Finds the table rows of a needle step
+static void needle_shape(int16_t step, needle_shape_t *s) {
+    s->valid = (step != NEEDLE_NONE);
+    if (!s->valid) {
+        return;
+    }
+
+    // Quadrants 1 and 3 run backwards through the table, 1 and 2 point left, 2 and 3 point down
+    uint8_t quadrant = (uint8_t)(step / NEEDLE_QUARTER);
+    uint8_t index = (uint8_t)(step % NEEDLE_QUARTER);
+    if (quadrant & 1) {
+        index = (uint8_t)(NEEDLE_QUARTER - index);
+    }
+    s->flip_x = (quadrant == 1 || quadrant == 2);
+    s->flip_y = (quadrant >= 2);
+
+    const uint8_t *p = &needle_spans[needle_offsets[index]];
+    s->dy0 = (int8_t)p[0];
+    s->rows = p[1];
+    p += 2;
+    for (uint8_t r = 0; r < s->rows; r++) {
+        s->row[r] = p;
+        p += 2 + (p[1] + 3) / 4;
+    }
+}
+
+/// @brief Fills a line with the coverage of one screen row of a needle
+static void needle_unpack(const needle_shape_t *s, int16_t dy, uint8_t *line) {
+    memset(line, 0, NEEDLE_LINE);
+    if (!s->valid) {
+        return;
+    }
+
+    int16_t r = (int16_t)((s->flip_y ? -dy : dy) - s->dy0);
+    if (r < 0 || r >= s->rows) {
+        return;
+    }
+
+    const uint8_t *row = s->row[r];
+    int8_t x0 = (int8_t)row[0];
+    uint8_t len = row[1];
+    const uint8_t *cov = &row[2];
+    for (uint8_t i = 0; i < len; i++) {
+        int16_t dx = s->flip_x ? -(x0 + i) : (x0 + i);
+        line[dx + NEEDLE_REACH] = (uint8_t)((cov[i / 4] >> (2 * (i % 4))) & 0x03);
+    }
+}
+
+/// @brief Screen rows a needle covers, relative to the center
+static void needle_rows(const needle_shape_t *s, int16_t *lo, int16_t *hi) {
+    if (!s->valid) {
+        return;
+    }
+    int16_t a = s->dy0, b = (int16_t)(s->dy0 + s->rows - 1);
+    if (s->flip_y) {
+        int16_t t = a;
+        a = (int16_t)-b;
+        b = (int16_t)-t;
+    }
+    if (a < *lo) *lo = a;
+    if (b > *hi) *hi = b;
+}
+
+//*************************************Public Functions***************************************/
+
+uint16_t needle_draw(int16_t cx, int16_t cy, int16_t old_step, int16_t new_step, uint16_t fg, uint16_t bg) {
+    uint16_t palette[4];
+    uint16_t sent = 0;
+    int16_t lo = NEEDLE_REACH, hi = -NEEDLE_REACH;
+
+    if (old_step == new_step) {
+        return 0;
+    }
+
+    for (uint8_t i = 0; i < 4; i++) {
+        palette[i] = needle_blend(fg, bg, i);
+    }
+
+    needle_shape(old_step, &old_shape);
+    needle_shape(new_step, &new_shape);
+    needle_rows(&old_shape, &lo, &hi);
+    needle_rows(&new_shape, &lo, &hi);
+
+    for (int16_t dy = lo; dy <= hi; dy++) {
+        needle_unpack(&old_shape, dy, old_line);
+        needle_unpack(&new_shape, dy, new_line);
+
+        // Only the stretch between the first and last changed pixel of the row
+        int16_t first = 0, last = NEEDLE_LINE - 1;
+        while (first < NEEDLE_LINE && old_line[first] == new_line[first]) first++;
+        if (first == NEEDLE_LINE) {
+            continue;
+        }
+        while (old_line[last] == new_line[last]) last--;
+
+        if (display_stream_begin((int16_t)(cx - NEEDLE_REACH + first), (int16_t)(cy + dy), (int16_t)(last - first + 1), 1)) {
+            for (int16_t i = first; i <= last; i++) {
+                display_stream_pixel(palette[new_line[i]]);
+            }
+            display_stream_end();
+            sent += (uint16_t)(last - first + 1);
+        }
+    }
+
+    return sent;
+}
@@ -0,0 +1,58 @@
+// File: needle.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Anti-aliased compass needle drawn from a per-angle span table, only the pixels that
+//              differ between the old and the new needle are sent
+
+#ifndef NEEDLE_H_
+#define NEEDLE_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Needle steps per turn (1.4 degrees, about one pixel at the tip)
+#define NEEDLE_ANGLES           256
+
+// Length baked into needle_table.c (see tools/needle_table.py)
+#define NEEDLE_TABLE_LENGTH     42
+
+// Pixels the anti-aliased needle can reach from its center in any direction
+#define NEEDLE_REACH            (NEEDLE_TABLE_LENGTH + 2)
+
+// No needle on the panel yet / erase the needle
+#define NEEDLE_NONE             (-1)
+
+// Binary angle units (65536 per turn) to the nearest needle step
+#define NEEDLE_STEP(angle)      ((int16_t)((((uint32_t)(angle) + 128u) >> 8) & (NEEDLE_ANGLES - 1)))
+
+/*************************************Defines***************************************/
+
+/***********************************Variables***************************************/
+
+// Tables in needle_table.c
+extern const uint16_t needle_offsets[NEEDLE_ANGLES / 4 + 1];
+extern const uint8_t needle_spans[];
+
+/***********************************Variables***************************************/
+
+/********************************Public Functions***********************************/
+
+/// @brief Moves the needle, each row only sends the pixels between the first and last one that changed
+///        (the needle stays within NEEDLE_REACH pixels of its center, so nothing around it is touched)
+/// @param cx Center X position
+/// @param cy Center Y position
+/// @param old_step Step currently on the panel, NEEDLE_NONE if there is none
+/// @param new_step Step to draw, NEEDLE_NONE to erase the needle
+/// @param fg RGB565 needle color
+/// @param bg RGB565 background color, the edge pixels are blended between the two
+/// @return Number of pixels sent
+uint16_t needle_draw(int16_t cx, int16_t cy, int16_t old_step, int16_t new_step, uint16_t fg, uint16_t bg);
+
+/********************************Public Functions***********************************/
+
+#endif /* NEEDLE_H_ */
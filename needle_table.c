@@ -0,0 +1,411 @@
+// File: needle_table.c
+// Generated by tools/needle_table.py, do not edit
+// Description: Anti-aliased compass needle as row spans for each angle of the first quarter turn
+
+#include "./needle.h"
+
+// Start of each angle in needle_spans
+const uint16_t needle_offsets[NEEDLE_ANGLES / 4 + 1] = {
+       0,   42,   78,  116,  158,  202,  248,  296,
+     348,  399,  455,  516,  572,  632,  696,  764,
+     835,  909,  984, 1060, 1143, 1219, 1294, 1374,
+    1451, 1531, 1614, 1700, 1786, 1875, 1967, 2062,
+    2157, 2255, 2356, 2460, 2564, 2671, 2781, 2891,
+    3004, 3117, 3233, 3349, 3468, 3590, 3712, 3837,
+    3962, 4087, 4215, 4343, 4471, 4602, 4733, 4864,
+    4998, 5132, 5266, 5400, 5534, 5668, 5802, 5939,
+    6076,
+};
+
+// 6213 bytes
+const uint8_t needle_spans[6213] = {
+    0xFF, 0x03, 0x00, 0x2B, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0xFF,
+    0x2D, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x2B, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0xFF, 0x04, 0x00, 0x05, 0x55, 0x01,
+    0xFF, 0x2C, 0xFD, 0xFF, 0xFF, 0xFF, 0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0x56, 0x55, 0x00, 0x2C, 0x55,
+    0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xFA, 0xFF, 0xFF, 0xFF, 0x7F, 0x24, 0x07, 0x55, 0x15, 0xFF, 0x05,
+    0x00, 0x03, 0x15, 0xFF, 0x18, 0xFD, 0xFF, 0xAB, 0xAA, 0x6A, 0x55, 0x00, 0x2B, 0x95, 0xAA, 0xAA,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xAB, 0xAA, 0x5A, 0x15, 0x12, 0x1A, 0x55, 0xA5, 0xAA, 0xEA, 0xFF, 0xFF,
+    0x07, 0x27, 0x04, 0x55, 0xFF, 0x06, 0x00, 0x02, 0x05, 0xFF, 0x11, 0xFD, 0xBF, 0xAA, 0x56, 0x01,
+    0x00, 0x1D, 0x95, 0xAA, 0xFE, 0xFF, 0xBF, 0xAA, 0x5A, 0x01, 0x0C, 0x1E, 0x55, 0xAA, 0xFA, 0xFF,
+    0xFF, 0xAB, 0x6A, 0x05, 0x1A, 0x11, 0x55, 0xAA, 0xFA, 0xFF, 0x03, 0x28, 0x03, 0x15, 0xFF, 0x07,
+    0x00, 0x02, 0x05, 0xFF, 0x0D, 0xFD, 0xAB, 0x5A, 0x01, 0x00, 0x16, 0xA5, 0xEA, 0xFF, 0xBF, 0x6A,
+    0x05, 0x09, 0x17, 0x95, 0xAA, 0xFF, 0xFF, 0xAA, 0x15, 0x14, 0x16, 0xA5, 0xEA, 0xFF, 0xBF, 0xAA,
+    0x05, 0x1E, 0x0D, 0x95, 0xEA, 0xFF, 0x03, 0x28, 0x03, 0x15, 0xFF, 0x08, 0x00, 0x01, 0x01, 0xFF,
+    0x0B, 0xFD, 0xAB, 0x15, 0x00, 0x12, 0xA5, 0xFE, 0xFF, 0x6A, 0x05, 0x08, 0x12, 0xA5, 0xFA, 0xFF,
+    0x6A, 0x05, 0x10, 0x12, 0xA5, 0xFA, 0xFF, 0xAA, 0x05, 0x18, 0x12, 0xA5, 0xFA, 0xFF, 0xAA, 0x05,
+    0x20, 0x0B, 0xA5, 0xFA, 0x3F, 0x28, 0x03, 0x15, 0xFF, 0x09, 0x00, 0x01, 0x01, 0xFF, 0x09, 0xFD,
+    0x6A, 0x01, 0x00, 0x0F, 0xA5, 0xFE, 0xAF, 0x16, 0x06, 0x0F, 0xA5, 0xFE, 0xBF, 0x1A, 0x0D, 0x0F,
+    0xA5, 0xFE, 0xAF, 0x16, 0x14, 0x0F, 0xA5, 0xFE, 0xAF, 0x16, 0x1B, 0x0F, 0xA5, 0xFF, 0xAF, 0x16,
+    0x21, 0x0A, 0xA5, 0xFE, 0x0B, 0x28, 0x03, 0x15, 0xFF, 0x0A, 0x00, 0x01, 0x01, 0xFF, 0x08, 0xFD,
+    0x5A, 0x00, 0x0D, 0xA5, 0xFF, 0x6B, 0x01, 0x06, 0x0C, 0xA9, 0xFF, 0x6A, 0x0B, 0x0D, 0xA5, 0xFF,
+    0xAB, 0x01, 0x11, 0x0D, 0xA5, 0xFF, 0x6B, 0x01, 0x17, 0x0D, 0xA5, 0xFF, 0x6B, 0x01, 0x1D, 0x0D,
+    0xA9, 0xFF, 0x6A, 0x01, 0x22, 0x09, 0xA5, 0xFF, 0x02, 0x28, 0x03, 0x15, 0xFF, 0x0B, 0x00, 0x01,
+    0x01, 0xFF, 0x07, 0xFD, 0x1A, 0x00, 0x0B, 0xE9, 0xFF, 0x1A, 0x05, 0x0B, 0xE9, 0xFF, 0x1A, 0x0A,
+    0x0B, 0xE9, 0xFF, 0x1A, 0x0F, 0x0B, 0xA5, 0xFF, 0x1A, 0x14, 0x0B, 0xA5, 0xFF, 0x1A, 0x19, 0x0B,
+    0xA5, 0xFF, 0x1A, 0x1E, 0x0B, 0xA5, 0xFF, 0x1A, 0x23, 0x08, 0xA5, 0x7F, 0x28, 0x02, 0x05, 0xFF,
+    0x0C, 0x00, 0x01, 0x01, 0xFF, 0x06, 0xBD, 0x06, 0x00, 0x0A, 0xE9, 0xBF, 0x06, 0x04, 0x0A, 0xA5,
+    0xBF, 0x06, 0x09, 0x0A, 0xE9, 0xBF, 0x05, 0x0D, 0x0A, 0xE5, 0xBF, 0x06, 0x12, 0x0A, 0xE9, 0xBF,
+    0x05, 0x16, 0x0A, 0xE5, 0xBF, 0x06, 0x1B, 0x0A, 0xE9, 0xBF, 0x05, 0x1F, 0x0A, 0xE5, 0xBF, 0x06,
+    0x24, 0x07, 0xE9, 0x1F, 0x28, 0x02, 0x05, 0xFF, 0x0D, 0x00, 0x01, 0x01, 0xFF, 0x06, 0xBD, 0x06,
+    0x00, 0x09, 0xE9, 0xAF, 0x01, 0x04, 0x09, 0xE9, 0xAF, 0x01, 0x08, 0x09, 0xE9, 0xAF, 0x01, 0x0C,
+    0x09, 0xE9, 0xAF, 0x01, 0x10, 0x09, 0xE9, 0xAF, 0x01, 0x14, 0x09, 0xE9, 0xAF, 0x01, 0x18, 0x09,
+    0xE9, 0xAF, 0x01, 0x1C, 0x09, 0xE9, 0xAF, 0x01, 0x20, 0x09, 0xE9, 0xAF, 0x01, 0x24, 0x06, 0xE9,
+    0x0F, 0x28, 0x02, 0x05, 0xFF, 0x0E, 0x00, 0x01, 0x01, 0xFF, 0x06, 0xBD, 0x05, 0x00, 0x08, 0xE9,
+    0x6F, 0x04, 0x08, 0xF9, 0x6B, 0x07, 0x08, 0xE9, 0x6F, 0x0B, 0x08, 0xF9, 0x6F, 0x0F, 0x08, 0xF9,
+    0x5B, 0x12, 0x08, 0xE9, 0x6F, 0x16, 0x08, 0xF9, 0x6B, 0x19, 0x08, 0xE5, 0x6F, 0x1D, 0x08, 0xF9,
+    0x6F, 0x21, 0x08, 0xF9, 0x6B, 0x24, 0x06, 0xE9, 0x0B, 0x28, 0x02, 0x05, 0xFF, 0x0F, 0x00, 0x01,
+    0x01, 0xFF, 0x05, 0xBD, 0x01, 0x00, 0x07, 0xF9, 0x1B, 0x03, 0x08, 0xE9, 0x6F, 0x07, 0x07, 0xF9,
+    0x1B, 0x0A, 0x07, 0xF9, 0x1B, 0x0D, 0x08, 0xE9, 0x6B, 0x11, 0x07, 0xF9, 0x1B, 0x14, 0x07, 0xF9,
+    0x1B, 0x17, 0x08, 0xF9, 0x5B, 0x1A, 0x08, 0xE5, 0x6F, 0x1E, 0x07, 0xF9, 0x1B, 0x21, 0x07, 0xF9,
+    0x1B, 0x24, 0x06, 0xE9, 0x07, 0x28, 0x01, 0x01, 0xFF, 0x10, 0x00, 0x01, 0x01, 0xFF, 0x05, 0xBD,
+    0x01, 0x00, 0x07, 0xF9, 0x1B, 0x03, 0x07, 0xF9, 0x1B, 0x06, 0x07, 0xF9, 0x1B, 0x09, 0x07, 0xF9,
+    0x1B, 0x0C, 0x07, 0xF9, 0x1B, 0x0F, 0x07, 0xF9, 0x1B, 0x12, 0x07, 0xF9, 0x1B, 0x15, 0x07, 0xF9,
+    0x1B, 0x18, 0x07, 0xF9, 0x1B, 0x1B, 0x07, 0xF9, 0x1B, 0x1E, 0x07, 0xF9, 0x1B, 0x21, 0x07, 0xF9,
+    0x1B, 0x24, 0x05, 0xF9, 0x03, 0x27, 0x02, 0x05, 0xFF, 0x11, 0x00, 0x01, 0x01, 0xFF, 0x05, 0xBD,
+    0x01, 0x00, 0x06, 0xF9, 0x0B, 0x03, 0x06, 0xF9, 0x06, 0x06, 0x06, 0xF9, 0x06, 0x09, 0x06, 0xFE,
+    0x06, 0x0B, 0x07, 0xF9, 0x1B, 0x0E, 0x06, 0xF9, 0x0B, 0x11, 0x06, 0xF9, 0x06, 0x14, 0x06, 0xF9,
+    0x06, 0x17, 0x06, 0xFE, 0x06, 0x19, 0x07, 0xF9, 0x1B, 0x1C, 0x06, 0xF9, 0x07, 0x1F, 0x06, 0xF9,
+    0x06, 0x22, 0x06, 0xF9, 0x06, 0x24, 0x05, 0xF9, 0x02, 0x27, 0x02, 0x05, 0xFF, 0x12, 0x00, 0x01,
+    0x01, 0xFF, 0x04, 0xBD, 0x00, 0x06, 0xF9, 0x06, 0x03, 0x06, 0xFD, 0x06, 0x05, 0x06, 0xF9, 0x07,
+    0x08, 0x06, 0xF9, 0x06, 0x0B, 0x05, 0xFE, 0x02, 0x0D, 0x06, 0xF9, 0x06, 0x10, 0x06, 0xFD, 0x06,
+    0x12, 0x06, 0xF9, 0x06, 0x15, 0x06, 0xF9, 0x06, 0x17, 0x06, 0xF9, 0x0B, 0x1A, 0x06, 0xF9, 0x06,
+    0x1D, 0x06, 0xFE, 0x06, 0x1F, 0x06, 0xF9, 0x06, 0x22, 0x06, 0xF9, 0x06, 0x24, 0x05, 0xF9, 0x01,
+    0x27, 0x01, 0x01, 0xFF, 0x13, 0x00, 0x01, 0x01, 0xFF, 0x04, 0xBD, 0x00, 0x06, 0xF9, 0x06, 0x03,
+    0x05, 0xFE, 0x01, 0x05, 0x05, 0xF9, 0x02, 0x07, 0x06, 0xF9, 0x06, 0x0A, 0x05, 0xFD, 0x02, 0x0C,
+    0x06, 0xF9, 0x06, 0x0F, 0x05, 0xFE, 0x01, 0x11, 0x06, 0xF9, 0x06, 0x13, 0x06, 0xF9, 0x06, 0x16,
+    0x05, 0xFD, 0x02, 0x18, 0x06, 0xF9, 0x06, 0x1B, 0x05, 0xFE, 0x02, 0x1D, 0x06, 0xF9, 0x06, 0x20,
+    0x05, 0xBE, 0x01, 0x22, 0x05, 0xF9, 0x02, 0x24, 0x04, 0xF9, 0x27, 0x01, 0x01, 0xFF, 0x13, 0x00,
+    0x01, 0x01, 0xFF, 0x04, 0x7D, 0x00, 0x05, 0xF9, 0x02, 0x02, 0x06, 0xF9, 0x06, 0x05, 0x05, 0xBE,
+    0x01, 0x07, 0x05, 0xFD, 0x01, 0x09, 0x05, 0xF9, 0x02, 0x0B, 0x06, 0xF9, 0x06, 0x0E, 0x05, 0xBE,
+    0x01, 0x10, 0x05, 0xFD, 0x01, 0x12, 0x05, 0xF9, 0x02, 0x14, 0x06, 0xF9, 0x06, 0x17, 0x05, 0xBE,
+    0x01, 0x19, 0x05, 0xFD, 0x02, 0x1B, 0x05, 0xF9, 0x02, 0x1E, 0x05, 0xBE, 0x01, 0x20, 0x05, 0xBE,
+    0x01, 0x22, 0x05, 0xFD, 0x02, 0x24, 0x04, 0xB9, 0xFF, 0x14, 0x00, 0x01, 0x01, 0xFF, 0x04, 0x7D,
+    0x00, 0x05, 0xF9, 0x01, 0x02, 0x05, 0xF9, 0x02, 0x04, 0x05, 0xF9, 0x02, 0x07, 0x04, 0xBE, 0x09,
+    0x04, 0xBE, 0x0B, 0x05, 0xBE, 0x01, 0x0D, 0x05, 0xBE, 0x01, 0x0F, 0x05, 0xFD, 0x01, 0x11, 0x05,
+    0xFD, 0x01, 0x13, 0x05, 0xF9, 0x02, 0x15, 0x05, 0xF9, 0x02, 0x17, 0x05, 0xF9, 0x02, 0x1A, 0x04,
+    0xBE, 0x1C, 0x05, 0xBE, 0x01, 0x1E, 0x05, 0xBE, 0x01, 0x20, 0x05, 0xBE, 0x01, 0x22, 0x05, 0xFD,
+    0x01, 0x24, 0x04, 0x7D, 0xFF, 0x15, 0x00, 0x01, 0x01, 0xFF, 0x04, 0x7D, 0x00, 0x05, 0xFD, 0x01,
+    0x02, 0x05, 0xFD, 0x01, 0x04, 0x05, 0xFD, 0x01, 0x06, 0x05, 0xBD, 0x01, 0x08, 0x05, 0xBD, 0x01,
+    0x0A, 0x05, 0xBD, 0x01, 0x0C, 0x05, 0xBD, 0x01, 0x0E, 0x05, 0xBD, 0x01, 0x10, 0x05, 0xBD, 0x01,
+    0x12, 0x05, 0xBD, 0x01, 0x14, 0x05, 0xBD, 0x01, 0x16, 0x05, 0xBD, 0x01, 0x18, 0x05, 0xBD, 0x01,
+    0x1A, 0x05, 0xBD, 0x01, 0x1C, 0x05, 0xBD, 0x01, 0x1E, 0x05, 0xBE, 0x01, 0x20, 0x05, 0xBE, 0x01,
+    0x22, 0x05, 0xBE, 0x01, 0x24, 0x03, 0x2E, 0xFF, 0x16, 0x00, 0x01, 0x01, 0xFF, 0x04, 0x6D, 0x00,
+    0x05, 0xBD, 0x01, 0x02, 0x04, 0xBD, 0x04, 0x04, 0xBE, 0x06, 0x04, 0xBE, 0x08, 0x04, 0xBE, 0x0A,
+    0x04, 0x7E, 0x0B, 0x05, 0xF9, 0x01, 0x0D, 0x05, 0xBD, 0x01, 0x0F, 0x05, 0xBD, 0x01, 0x11, 0x04,
+    0xBD, 0x13, 0x04, 0xBE, 0x15, 0x04, 0xBE, 0x17, 0x04, 0xBE, 0x18, 0x05, 0xF9, 0x01, 0x1A, 0x05,
+    0xF9, 0x01, 0x1C, 0x05, 0xBD, 0x01, 0x1E, 0x05, 0xBD, 0x01, 0x20, 0x04, 0xBE, 0x22, 0x04, 0xBE,
+    0x24, 0x03, 0x1E, 0xFF, 0x17, 0x00, 0x01, 0x01, 0xFF, 0x04, 0x6D, 0x00, 0x04, 0xBD, 0x02, 0x04,
+    0xBE, 0x04, 0x04, 0x7E, 0x05, 0x05, 0xB9, 0x01, 0x07, 0x04, 0xBD, 0x09, 0x04, 0xBE, 0x0B, 0x04,
+    0x7E, 0x0D, 0x04, 0x7E, 0x0E, 0x05, 0xBD, 0x01, 0x10, 0x04, 0xBD, 0x12, 0x04, 0xBE, 0x14, 0x04,
+    0x7E, 0x15, 0x05, 0xB9, 0x01, 0x17, 0x04, 0xBD, 0x19, 0x04, 0xBE, 0x1B, 0x04, 0x7E, 0x1C, 0x05,
+    0xB9, 0x01, 0x1E, 0x04, 0xBD, 0x20, 0x04, 0xBE, 0x22, 0x04, 0x7E, 0x23, 0x03, 0x29, 0xFF, 0x18,
+    0x00, 0x01, 0x01, 0xFF, 0x04, 0x6D, 0x00, 0x04, 0xBD, 0x02, 0x04, 0x7E, 0x03, 0x05, 0xB9, 0x01,
+    0x05, 0x04, 0xBD, 0x07, 0x04, 0x7E, 0x08, 0x05, 0xB9, 0x01, 0x0A, 0x04, 0xBD, 0x0C, 0x04, 0x7E,
+    0x0D, 0x05, 0xB9, 0x01, 0x0F, 0x04, 0xBD, 0x11, 0x04, 0x7E, 0x12, 0x05, 0xB9, 0x01, 0x14, 0x04,
+    0xBD, 0x16, 0x04, 0x7E, 0x17, 0x05, 0xB9, 0x01, 0x19, 0x04, 0xBD, 0x1B, 0x04, 0x7E, 0x1C, 0x05,
+    0xB9, 0x01, 0x1E, 0x04, 0xBD, 0x20, 0x04, 0x7E, 0x21, 0x04, 0xB9, 0x23, 0x02, 0x09, 0xFF, 0x19,
+    0x00, 0x01, 0x01, 0xFF, 0x03, 0x2D, 0x00, 0x04, 0xBD, 0x02, 0x04, 0x6E, 0x03, 0x04, 0xBD, 0x05,
+    0x04, 0x7E, 0x06, 0x04, 0xB9, 0x08, 0x04, 0x7D, 0x0A, 0x04, 0x6E, 0x0B, 0x04, 0xBD, 0x0D, 0x04,
+    0x7E, 0x0E, 0x04, 0xBD, 0x10, 0x04, 0x7E, 0x11, 0x04, 0xB9, 0x13, 0x04, 0xBD, 0x15, 0x04, 0x6E,
+    0x16, 0x04, 0xBD, 0x18, 0x04, 0x7E, 0x19, 0x04, 0xB9, 0x1B, 0x04, 0x7E, 0x1D, 0x03, 0x2E, 0x1E,
+    0x04, 0xBD, 0x20, 0x04, 0x6E, 0x21, 0x04, 0xBD, 0x23, 0x02, 0x06, 0xFF, 0x1A, 0x00, 0x01, 0x01,
+    0xFF, 0x03, 0x2D, 0x00, 0x04, 0x7D, 0x02, 0x03, 0x2E, 0x03, 0x04, 0x7D, 0x05, 0x03, 0x2E, 0x06,
+    0x04, 0x7D, 0x08, 0x03, 0x2E, 0x09, 0x04, 0x7D, 0x0B, 0x03, 0x2E, 0x0C, 0x04, 0x7D, 0x0E, 0x03,
+    0x2E, 0x0F, 0x04, 0x7D, 0x11, 0x03, 0x2E, 0x12, 0x04, 0x7D, 0x14, 0x03, 0x2E, 0x15, 0x04, 0x7D,
+    0x17, 0x03, 0x2E, 0x18, 0x04, 0x7D, 0x1A, 0x03, 0x2E, 0x1B, 0x04, 0x7D, 0x1D, 0x03, 0x2E, 0x1E,
+    0x04, 0x7D, 0x20, 0x03, 0x2E, 0x21, 0x03, 0x3D, 0x23, 0x01, 0x02, 0xFF, 0x1B, 0x00, 0x01, 0x01,
+    0xFF, 0x03, 0x2D, 0x00, 0x04, 0x7D, 0x01, 0x04, 0xB9, 0x03, 0x04, 0x7E, 0x04, 0x04, 0xBD, 0x06,
+    0x03, 0x2E, 0x07, 0x04, 0x7D, 0x09, 0x03, 0x2E, 0x0A, 0x04, 0x7D, 0x0B, 0x04, 0xB9, 0x0D, 0x04,
+    0x6E, 0x0E, 0x04, 0x7D, 0x10, 0x03, 0x2E, 0x11, 0x04, 0x7D, 0x13, 0x03, 0x2E, 0x14, 0x04, 0x7E,
+    0x15, 0x04, 0xBD, 0x17, 0x03, 0x2E, 0x18, 0x04, 0x7D, 0x1A, 0x03, 0x2E, 0x1B, 0x04, 0x7D, 0x1C,
+    0x04, 0xB9, 0x1E, 0x04, 0x6E, 0x1F, 0x04, 0xBD, 0x21, 0x03, 0x1E, 0x22, 0x02, 0x05, 0xFF, 0x1C,
+    0x00, 0x01, 0x01, 0xFF, 0x03, 0x2D, 0x00, 0x04, 0x7D, 0x01, 0x04, 0x7D, 0x03, 0x03, 0x2E, 0x04,
+    0x04, 0x7D, 0x05, 0x04, 0xB9, 0x07, 0x03, 0x2E, 0x08, 0x04, 0x7D, 0x09, 0x04, 0xB9, 0x0B, 0x03,
+    0x2E, 0x0C, 0x04, 0x7D, 0x0E, 0x03, 0x2E, 0x0F, 0x03, 0x2E, 0x10, 0x04, 0x7D, 0x12, 0x03, 0x2E,
+    0x13, 0x04, 0x6E, 0x14, 0x04, 0x7D, 0x16, 0x03, 0x2E, 0x17, 0x04, 0x6E, 0x18, 0x04, 0x7D, 0x1A,
+    0x03, 0x2E, 0x1B, 0x04, 0x7D, 0x1C, 0x04, 0x7D, 0x1E, 0x03, 0x2E, 0x1F, 0x04, 0x7D, 0x20, 0x03,
+    0x3D, 0x22, 0x01, 0x01, 0xFF, 0x1C, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x2D, 0x00, 0x04, 0x6D, 0x01,
+    0x04, 0x7D, 0x03, 0x03, 0x2E, 0x04, 0x03, 0x2E, 0x05, 0x04, 0x7D, 0x06, 0x04, 0x79, 0x08, 0x03,
+    0x2E, 0x09, 0x04, 0x6E, 0x0A, 0x04, 0x7D, 0x0C, 0x03, 0x2E, 0x0D, 0x03, 0x2E, 0x0E, 0x04, 0x7D,
+    0x0F, 0x04, 0x7D, 0x11, 0x03, 0x2E, 0x12, 0x03, 0x2E, 0x13, 0x04, 0x7D, 0x15, 0x03, 0x2E, 0x16,
+    0x03, 0x2E, 0x17, 0x04, 0x7D, 0x18, 0x04, 0x7D, 0x1A, 0x03, 0x2E, 0x1B, 0x03, 0x2E, 0x1C, 0x04,
+    0x7D, 0x1D, 0x04, 0xB9, 0x1F, 0x03, 0x2E, 0x20, 0x03, 0x1D, 0xFF, 0x1D, 0x00, 0x01, 0x01, 0xFF,
+    0x03, 0x2D, 0x00, 0x03, 0x2D, 0x01, 0x04, 0x7D, 0x02, 0x04, 0x79, 0x04, 0x03, 0x2E, 0x05, 0x03,
+    0x2E, 0x06, 0x04, 0x6D, 0x07, 0x04, 0x7D, 0x09, 0x03, 0x1E, 0x0A, 0x03, 0x2E, 0x0B, 0x03, 0x2E,
+    0x0C, 0x04, 0x7D, 0x0D, 0x04, 0x7D, 0x0F, 0x03, 0x2E, 0x10, 0x03, 0x2E, 0x11, 0x03, 0x2D, 0x12,
+    0x04, 0x7D, 0x14, 0x03, 0x1E, 0x15, 0x03, 0x2E, 0x16, 0x03, 0x2E, 0x17, 0x04, 0x7D, 0x18, 0x04,
+    0x7D, 0x1A, 0x03, 0x2E, 0x1B, 0x03, 0x2E, 0x1C, 0x03, 0x2D, 0x1D, 0x04, 0x7D, 0x1E, 0x04, 0x79,
+    0x20, 0x02, 0x0A, 0xFF, 0x1E, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x2D, 0x00, 0x03, 0x2E, 0x01, 0x03,
+    0x2D, 0x02, 0x04, 0x7D, 0x03, 0x04, 0x79, 0x05, 0x03, 0x1E, 0x06, 0x03, 0x2E, 0x07, 0x03, 0x2E,
+    0x08, 0x03, 0x2D, 0x09, 0x04, 0x7D, 0x0A, 0x04, 0x7D, 0x0C, 0x03, 0x1E, 0x0D, 0x03, 0x2E, 0x0E,
+    0x03, 0x2E, 0x0F, 0x03, 0x2D, 0x10, 0x04, 0x7D, 0x11, 0x04, 0x7D, 0x13, 0x03, 0x1E, 0x14, 0x03,
+    0x2E, 0x15, 0x03, 0x2E, 0x16, 0x03, 0x2D, 0x17, 0x04, 0x6D, 0x18, 0x04, 0x7D, 0x19, 0x04, 0x79,
+    0x1B, 0x03, 0x1E, 0x1C, 0x03, 0x2E, 0x1D, 0x03, 0x2E, 0x1E, 0x03, 0x2D, 0x1F, 0x02, 0x09, 0xFF,
+    0x1F, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x2D, 0x00, 0x03, 0x2E, 0x01, 0x03, 0x2D, 0x02, 0x03, 0x2D,
+    0x03, 0x04, 0x7D, 0x04, 0x04, 0x7D, 0x05, 0x04, 0x79, 0x07, 0x03, 0x1E, 0x08, 0x03, 0x1E, 0x09,
+    0x03, 0x2E, 0x0A, 0x03, 0x2E, 0x0B, 0x03, 0x2D, 0x0C, 0x03, 0x2D, 0x0D, 0x03, 0x2D, 0x0E, 0x04,
+    0x7D, 0x0F, 0x04, 0x7D, 0x11, 0x03, 0x1E, 0x12, 0x03, 0x1E, 0x13, 0x03, 0x1E, 0x14, 0x03, 0x2E,
+    0x15, 0x03, 0x2E, 0x16, 0x03, 0x2D, 0x17, 0x03, 0x2D, 0x18, 0x04, 0x6D, 0x19, 0x04, 0x7D, 0x1A,
+    0x04, 0x7D, 0x1C, 0x03, 0x1E, 0x1D, 0x03, 0x1E, 0x1E, 0x03, 0x1E, 0x1F, 0x01, 0x01, 0xFF, 0x1F,
+    0x00, 0x01, 0x01, 0xFF, 0x03, 0x2D, 0x00, 0x03, 0x2E, 0x01, 0x03, 0x2D, 0x02, 0x03, 0x2D, 0x03,
+    0x03, 0x2D, 0x04, 0x03, 0x2D, 0x05, 0x03, 0x2D, 0x06, 0x03, 0x2D, 0x07, 0x03, 0x2D, 0x08, 0x04,
+    0x7D, 0x09, 0x04, 0x7D, 0x0A, 0x04, 0x7D, 0x0C, 0x03, 0x1E, 0x0D, 0x03, 0x1E, 0x0E, 0x03, 0x1E,
+    0x0F, 0x03, 0x1E, 0x10, 0x03, 0x1E, 0x11, 0x03, 0x1E, 0x12, 0x03, 0x1E, 0x13, 0x03, 0x2E, 0x14,
+    0x03, 0x2E, 0x15, 0x03, 0x2E, 0x16, 0x03, 0x2D, 0x17, 0x03, 0x2D, 0x18, 0x03, 0x2D, 0x19, 0x03,
+    0x2D, 0x1A, 0x03, 0x2D, 0x1B, 0x03, 0x2D, 0x1C, 0x04, 0x6D, 0x1D, 0x03, 0x2D, 0xFF, 0x20, 0x00,
+    0x01, 0x01, 0xFF, 0x03, 0x2D, 0x00, 0x03, 0x2E, 0x01, 0x03, 0x2E, 0x02, 0x03, 0x2E, 0x03, 0x03,
+    0x2E, 0x04, 0x03, 0x2E, 0x05, 0x03, 0x2E, 0x06, 0x03, 0x2E, 0x07, 0x03, 0x2E, 0x08, 0x03, 0x2E,
+    0x09, 0x03, 0x2E, 0x0A, 0x03, 0x2E, 0x0B, 0x03, 0x2E, 0x0C, 0x03, 0x2E, 0x0D, 0x03, 0x2E, 0x0E,
+    0x03, 0x2E, 0x0F, 0x03, 0x2E, 0x10, 0x03, 0x2E, 0x11, 0x03, 0x2E, 0x12, 0x03, 0x2E, 0x13, 0x03,
+    0x2E, 0x14, 0x03, 0x2E, 0x15, 0x03, 0x2E, 0x16, 0x03, 0x2E, 0x17, 0x03, 0x2E, 0x18, 0x03, 0x2E,
+    0x19, 0x03, 0x2E, 0x1A, 0x03, 0x2E, 0x1B, 0x03, 0x2E, 0x1C, 0x03, 0x2E, 0x1D, 0x02, 0x0A, 0xFF,
+    0x21, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x2D, 0x00, 0x03, 0x1E, 0x01, 0x03, 0x1E, 0x02, 0x03, 0x1E,
+    0x03, 0x03, 0x1E, 0x04, 0x03, 0x1E, 0x05, 0x03, 0x1E, 0x06, 0x03, 0x1E, 0x07, 0x03, 0x1E, 0x08,
+    0x03, 0x1E, 0x09, 0x03, 0x1F, 0x09, 0x03, 0x3D, 0x0A, 0x03, 0x2D, 0x0B, 0x03, 0x2D, 0x0C, 0x03,
+    0x2D, 0x0D, 0x03, 0x2D, 0x0E, 0x03, 0x2D, 0x0F, 0x03, 0x2D, 0x10, 0x03, 0x2D, 0x11, 0x03, 0x2D,
+    0x12, 0x03, 0x2D, 0x13, 0x03, 0x2E, 0x14, 0x03, 0x1E, 0x15, 0x03, 0x1E, 0x16, 0x03, 0x1E, 0x17,
+    0x03, 0x1E, 0x18, 0x03, 0x1E, 0x19, 0x03, 0x1E, 0x1A, 0x03, 0x1E, 0x1B, 0x03, 0x1E, 0x1C, 0x02,
+    0x0E, 0x1C, 0x02, 0x09, 0xFF, 0x22, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x2D, 0x00, 0x03, 0x1E, 0x01,
+    0x03, 0x1E, 0x02, 0x03, 0x1E, 0x03, 0x03, 0x1E, 0x04, 0x03, 0x1F, 0x04, 0x03, 0x2D, 0x05, 0x03,
+    0x2D, 0x06, 0x03, 0x2D, 0x07, 0x03, 0x2D, 0x08, 0x03, 0x2D, 0x09, 0x03, 0x1E, 0x0A, 0x03, 0x1E,
+    0x0B, 0x03, 0x1E, 0x0C, 0x03, 0x1E, 0x0D, 0x03, 0x1E, 0x0E, 0x02, 0x0F, 0x0E, 0x03, 0x2D, 0x0F,
+    0x03, 0x2D, 0x10, 0x03, 0x2D, 0x11, 0x03, 0x2D, 0x12, 0x03, 0x2D, 0x13, 0x03, 0x1E, 0x14, 0x03,
+    0x1E, 0x15, 0x03, 0x1E, 0x16, 0x03, 0x1E, 0x17, 0x03, 0x1E, 0x17, 0x03, 0x3D, 0x18, 0x03, 0x2D,
+    0x19, 0x03, 0x2D, 0x1A, 0x03, 0x2D, 0x1B, 0x03, 0x1D, 0x1C, 0x01, 0x01, 0xFF, 0x22, 0x00, 0x01,
+    0x01, 0xFF, 0x03, 0x2D, 0x00, 0x03, 0x1E, 0x01, 0x03, 0x1E, 0x02, 0x03, 0x1E, 0x03, 0x02, 0x0B,
+    0x03, 0x03, 0x2D, 0x04, 0x03, 0x2D, 0x05, 0x03, 0x2D, 0x06, 0x03, 0x1E, 0x07, 0x03, 0x1E, 0x08,
+    0x03, 0x1E, 0x09, 0x02, 0x0F, 0x09, 0x03, 0x2D, 0x0A, 0x03, 0x2D, 0x0B, 0x03, 0x2D, 0x0C, 0x03,
+    0x1E, 0x0D, 0x03, 0x1E, 0x0E, 0x03, 0x1E, 0x0F, 0x02, 0x0F, 0x0F, 0x03, 0x2D, 0x10, 0x03, 0x2D,
+    0x11, 0x03, 0x2D, 0x12, 0x03, 0x1E, 0x13, 0x03, 0x1E, 0x14, 0x03, 0x1E, 0x15, 0x03, 0x1E, 0x15,
+    0x03, 0x2D, 0x16, 0x03, 0x2D, 0x17, 0x03, 0x2D, 0x18, 0x03, 0x2D, 0x19, 0x03, 0x1E, 0x1A, 0x03,
+    0x1E, 0x1B, 0x02, 0x0A, 0xFF, 0x23, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x1D, 0x00, 0x03, 0x1E, 0x01,
+    0x03, 0x1E, 0x02, 0x02, 0x0B, 0x02, 0x03, 0x2D, 0x03, 0x03, 0x2D, 0x04, 0x03, 0x1E, 0x05, 0x03,
+    0x1E, 0x06, 0x02, 0x0E, 0x06, 0x03, 0x2D, 0x07, 0x03, 0x2D, 0x08, 0x03, 0x2D, 0x09, 0x03, 0x1E,
+    0x0A, 0x03, 0x1E, 0x0B, 0x02, 0x0F, 0x0B, 0x03, 0x2D, 0x0C, 0x03, 0x2D, 0x0D, 0x03, 0x1E, 0x0E,
+    0x03, 0x1E, 0x0F, 0x02, 0x0E, 0x10, 0x02, 0x0B, 0x10, 0x03, 0x2D, 0x11, 0x03, 0x2D, 0x12, 0x03,
+    0x1E, 0x13, 0x03, 0x1E, 0x14, 0x02, 0x0F, 0x14, 0x03, 0x2D, 0x15, 0x03, 0x2D, 0x16, 0x03, 0x1E,
+    0x17, 0x03, 0x1E, 0x18, 0x03, 0x1E, 0x19, 0x02, 0x0B, 0x19, 0x03, 0x2D, 0x1A, 0x02, 0x09, 0xFF,
+    0x24, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x1D, 0x00, 0x03, 0x1E, 0x01, 0x02, 0x0E, 0x01, 0x03, 0x2D,
+    0x02, 0x03, 0x2D, 0x03, 0x03, 0x1E, 0x04, 0x03, 0x1E, 0x05, 0x02, 0x0B, 0x05, 0x03, 0x2D, 0x06,
+    0x03, 0x2D, 0x07, 0x03, 0x1E, 0x08, 0x02, 0x0E, 0x08, 0x03, 0x2D, 0x09, 0x03, 0x2D, 0x0A, 0x03,
+    0x1E, 0x0B, 0x03, 0x1E, 0x0C, 0x02, 0x0F, 0x0C, 0x03, 0x2D, 0x0D, 0x03, 0x2D, 0x0E, 0x03, 0x1E,
+    0x0F, 0x02, 0x0E, 0x10, 0x02, 0x0B, 0x10, 0x03, 0x2D, 0x11, 0x03, 0x1E, 0x12, 0x03, 0x1E, 0x13,
+    0x02, 0x0F, 0x13, 0x03, 0x2D, 0x14, 0x03, 0x2D, 0x15, 0x03, 0x1E, 0x16, 0x03, 0x1E, 0x17, 0x02,
+    0x0B, 0x17, 0x03, 0x2D, 0x18, 0x03, 0x1E, 0x19, 0x02, 0x0E, 0x1A, 0x01, 0x01, 0xFF, 0x24, 0x00,
+    0x01, 0x01, 0xFF, 0x03, 0x1D, 0x00, 0x03, 0x1E, 0x01, 0x02, 0x0F, 0x01, 0x03, 0x2D, 0x02, 0x03,
+    0x1D, 0x03, 0x03, 0x1E, 0x04, 0x02, 0x0B, 0x04, 0x03, 0x2D, 0x05, 0x03, 0x1E, 0x06, 0x03, 0x1E,
+    0x07, 0x02, 0x0B, 0x07, 0x03, 0x2D, 0x08, 0x03, 0x1E, 0x09, 0x02, 0x0E, 0x0A, 0x02, 0x0B, 0x0A,
+    0x03, 0x2D, 0x0B, 0x03, 0x1E, 0x0C, 0x02, 0x0E, 0x0D, 0x02, 0x0B, 0x0D, 0x03, 0x2D, 0x0E, 0x03,
+    0x1E, 0x0F, 0x02, 0x0E, 0x0F, 0x03, 0x2D, 0x10, 0x03, 0x2D, 0x11, 0x03, 0x1E, 0x12, 0x02, 0x0E,
+    0x12, 0x03, 0x2D, 0x13, 0x03, 0x1D, 0x14, 0x03, 0x1E, 0x15, 0x02, 0x0F, 0x15, 0x03, 0x2D, 0x16,
+    0x03, 0x1D, 0x17, 0x03, 0x1E, 0x18, 0x02, 0x0F, 0x18, 0x03, 0x1D, 0xFF, 0x25, 0x00, 0x01, 0x01,
+    0xFF, 0x03, 0x1D, 0x00, 0x03, 0x1E, 0x01, 0x02, 0x0B, 0x01, 0x03, 0x2D, 0x02, 0x03, 0x1E, 0x03,
+    0x02, 0x0F, 0x03, 0x03, 0x2D, 0x04, 0x03, 0x1E, 0x05, 0x02, 0x0E, 0x06, 0x02, 0x0B, 0x06, 0x03,
+    0x1D, 0x07, 0x03, 0x1E, 0x08, 0x02, 0x0B, 0x08, 0x03, 0x2D, 0x09, 0x03, 0x1E, 0x0A, 0x02, 0x0E,
+    0x0A, 0x03, 0x2D, 0x0B, 0x03, 0x1D, 0x0C, 0x02, 0x0E, 0x0D, 0x02, 0x0B, 0x0D, 0x03, 0x2D, 0x0E,
+    0x03, 0x1E, 0x0F, 0x02, 0x0F, 0x0F, 0x03, 0x2D, 0x10, 0x03, 0x1E, 0x11, 0x02, 0x0E, 0x12, 0x02,
+    0x0B, 0x12, 0x03, 0x1D, 0x13, 0x03, 0x1E, 0x14, 0x02, 0x0B, 0x14, 0x03, 0x2D, 0x15, 0x03, 0x1E,
+    0x16, 0x02, 0x0E, 0x16, 0x03, 0x2D, 0x17, 0x03, 0x1E, 0x18, 0x02, 0x05, 0xFF, 0x25, 0x00, 0x01,
+    0x01, 0xFF, 0x03, 0x1D, 0x00, 0x02, 0x0E, 0x01, 0x02, 0x0B, 0x01, 0x03, 0x1D, 0x02, 0x02, 0x0E,
+    0x03, 0x02, 0x0B, 0x03, 0x03, 0x1D, 0x04, 0x02, 0x0E, 0x05, 0x02, 0x0B, 0x05, 0x03, 0x1D, 0x06,
+    0x02, 0x0E, 0x07, 0x02, 0x0B, 0x07, 0x03, 0x1D, 0x08, 0x02, 0x0E, 0x09, 0x02, 0x0B, 0x09, 0x03,
+    0x1D, 0x0A, 0x02, 0x0E, 0x0B, 0x02, 0x0B, 0x0B, 0x03, 0x1D, 0x0C, 0x02, 0x0E, 0x0D, 0x02, 0x0B,
+    0x0D, 0x03, 0x1D, 0x0E, 0x02, 0x0E, 0x0F, 0x02, 0x0B, 0x0F, 0x03, 0x1D, 0x10, 0x02, 0x0E, 0x11,
+    0x02, 0x0B, 0x11, 0x03, 0x1D, 0x12, 0x02, 0x0E, 0x13, 0x02, 0x0B, 0x13, 0x03, 0x1D, 0x14, 0x02,
+    0x0E, 0x15, 0x02, 0x0B, 0x15, 0x03, 0x1D, 0x16, 0x02, 0x0E, 0x17, 0x02, 0x0B, 0xFF, 0x26, 0x00,
+    0x01, 0x01, 0xFF, 0x03, 0x1D, 0x00, 0x02, 0x0E, 0x01, 0x02, 0x0B, 0x01, 0x03, 0x1E, 0x02, 0x02,
+    0x0E, 0x02, 0x03, 0x2D, 0x03, 0x03, 0x1E, 0x04, 0x02, 0x0B, 0x04, 0x03, 0x1D, 0x05, 0x02, 0x0E,
+    0x06, 0x02, 0x0B, 0x06, 0x03, 0x1D, 0x07, 0x02, 0x0E, 0x07, 0x03, 0x2D, 0x08, 0x03, 0x1E, 0x09,
+    0x02, 0x0F, 0x09, 0x03, 0x2D, 0x0A, 0x03, 0x1E, 0x0B, 0x02, 0x0B, 0x0B, 0x03, 0x1D, 0x0C, 0x02,
+    0x0E, 0x0D, 0x02, 0x0B, 0x0D, 0x03, 0x1E, 0x0E, 0x02, 0x0E, 0x0E, 0x03, 0x2D, 0x0F, 0x03, 0x1E,
+    0x10, 0x02, 0x0B, 0x10, 0x03, 0x2D, 0x11, 0x02, 0x0E, 0x12, 0x02, 0x0B, 0x12, 0x03, 0x1D, 0x13,
+    0x02, 0x0E, 0x14, 0x02, 0x0B, 0x14, 0x03, 0x1E, 0x15, 0x02, 0x0E, 0x15, 0x03, 0x2D, 0x16, 0x02,
+    0x06, 0xFF, 0x26, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x1D, 0x00, 0x02, 0x0E, 0x00, 0x03, 0x2D, 0x01,
+    0x03, 0x1E, 0x02, 0x02, 0x0B, 0x02, 0x03, 0x1D, 0x03, 0x02, 0x0E, 0x03, 0x03, 0x2D, 0x04, 0x03,
+    0x1E, 0x05, 0x02, 0x0B, 0x05, 0x03, 0x1D, 0x06, 0x02, 0x0E, 0x06, 0x03, 0x2D, 0x07, 0x03, 0x1E,
+    0x08, 0x02, 0x0B, 0x08, 0x03, 0x1D, 0x09, 0x02, 0x0E, 0x09, 0x03, 0x2D, 0x0A, 0x03, 0x1E, 0x0B,
+    0x02, 0x0B, 0x0B, 0x03, 0x1D, 0x0C, 0x02, 0x0E, 0x0C, 0x03, 0x2D, 0x0D, 0x03, 0x1E, 0x0E, 0x02,
+    0x0B, 0x0E, 0x03, 0x1D, 0x0F, 0x02, 0x0E, 0x0F, 0x03, 0x2D, 0x10, 0x03, 0x1E, 0x11, 0x02, 0x0B,
+    0x11, 0x03, 0x1D, 0x12, 0x02, 0x0E, 0x12, 0x03, 0x2D, 0x13, 0x03, 0x1E, 0x14, 0x02, 0x0B, 0x14,
+    0x03, 0x1D, 0x15, 0x02, 0x0A, 0xFF, 0x27, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x1D, 0x00, 0x02, 0x0E,
+    0x00, 0x03, 0x2D, 0x01, 0x02, 0x0E, 0x02, 0x02, 0x0B, 0x02, 0x03, 0x1E, 0x03, 0x02, 0x0B, 0x03,
+    0x03, 0x1D, 0x04, 0x02, 0x0E, 0x04, 0x03, 0x2D, 0x05, 0x02, 0x0E, 0x06, 0x02, 0x0B, 0x06, 0x02,
+    0x0E, 0x07, 0x02, 0x0B, 0x07, 0x03, 0x1D, 0x08, 0x02, 0x0F, 0x08, 0x03, 0x1D, 0x09, 0x02, 0x0E,
+    0x09, 0x03, 0x2D, 0x0A, 0x02, 0x0E, 0x0B, 0x02, 0x0B, 0x0B, 0x03, 0x1E, 0x0C, 0x02, 0x0B, 0x0C,
+    0x03, 0x1D, 0x0D, 0x02, 0x0E, 0x0D, 0x03, 0x2D, 0x0E, 0x02, 0x0E, 0x0F, 0x02, 0x0B, 0x0F, 0x03,
+    0x1E, 0x10, 0x02, 0x0B, 0x10, 0x03, 0x1D, 0x11, 0x02, 0x0E, 0x11, 0x03, 0x2D, 0x12, 0x02, 0x0E,
+    0x13, 0x02, 0x0B, 0x13, 0x03, 0x1E, 0x14, 0x02, 0x0B, 0x14, 0x02, 0x09, 0xFF, 0x28, 0x00, 0x01,
+    0x01, 0xFF, 0x03, 0x1D, 0x00, 0x02, 0x0E, 0x00, 0x03, 0x1D, 0x01, 0x02, 0x0E, 0x01, 0x03, 0x2D,
+    0x02, 0x02, 0x0E, 0x03, 0x02, 0x0B, 0x03, 0x02, 0x0E, 0x04, 0x02, 0x0B, 0x04, 0x02, 0x0E, 0x05,
+    0x02, 0x0B, 0x05, 0x03, 0x1E, 0x06, 0x02, 0x0B, 0x06, 0x03, 0x1D, 0x07, 0x02, 0x0F, 0x07, 0x03,
+    0x1D, 0x08, 0x02, 0x0E, 0x08, 0x03, 0x1D, 0x09, 0x02, 0x0E, 0x09, 0x03, 0x2D, 0x0A, 0x02, 0x0E,
+    0x0B, 0x02, 0x0B, 0x0B, 0x02, 0x0E, 0x0C, 0x02, 0x0B, 0x0C, 0x03, 0x1E, 0x0D, 0x02, 0x0B, 0x0D,
+    0x03, 0x1E, 0x0E, 0x02, 0x0B, 0x0E, 0x03, 0x1D, 0x0F, 0x02, 0x0F, 0x0F, 0x03, 0x1D, 0x10, 0x02,
+    0x0E, 0x10, 0x03, 0x2D, 0x11, 0x02, 0x0E, 0x11, 0x03, 0x2D, 0x12, 0x02, 0x0E, 0x13, 0x02, 0x0B,
+    0x13, 0x02, 0x0E, 0x14, 0x01, 0x01, 0xFF, 0x28, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x1D, 0x00, 0x02,
+    0x0F, 0x00, 0x03, 0x1D, 0x01, 0x02, 0x0F, 0x01, 0x03, 0x1D, 0x02, 0x02, 0x0F, 0x02, 0x03, 0x1D,
+    0x03, 0x02, 0x0F, 0x03, 0x03, 0x1D, 0x04, 0x02, 0x0E, 0x04, 0x03, 0x1D, 0x05, 0x02, 0x0E, 0x05,
+    0x03, 0x1D, 0x06, 0x02, 0x0E, 0x06, 0x03, 0x1D, 0x07, 0x02, 0x0E, 0x07, 0x03, 0x1D, 0x08, 0x02,
+    0x0E, 0x08, 0x03, 0x1D, 0x09, 0x02, 0x0E, 0x09, 0x03, 0x1D, 0x0A, 0x02, 0x0E, 0x0A, 0x03, 0x1D,
+    0x0B, 0x02, 0x0E, 0x0B, 0x03, 0x1D, 0x0C, 0x02, 0x0E, 0x0C, 0x03, 0x1D, 0x0D, 0x02, 0x0E, 0x0D,
+    0x03, 0x1D, 0x0E, 0x02, 0x0E, 0x0E, 0x03, 0x2D, 0x0F, 0x02, 0x0E, 0x0F, 0x03, 0x2D, 0x10, 0x02,
+    0x0E, 0x10, 0x03, 0x2D, 0x11, 0x02, 0x0E, 0x11, 0x03, 0x2D, 0x12, 0x02, 0x0E, 0x12, 0x02, 0x09,
+    0xFF, 0x29, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x1D, 0x00, 0x02, 0x0B, 0x00, 0x03, 0x1D, 0x01, 0x02,
+    0x0B, 0x01, 0x03, 0x1D, 0x02, 0x02, 0x0B, 0x02, 0x02, 0x0E, 0x03, 0x02, 0x0B, 0x03, 0x02, 0x0E,
+    0x04, 0x02, 0x0B, 0x04, 0x02, 0x0E, 0x05, 0x02, 0x0B, 0x05, 0x02, 0x0E, 0x06, 0x02, 0x0B, 0x06,
+    0x02, 0x0E, 0x06, 0x03, 0x1D, 0x07, 0x02, 0x0E, 0x07, 0x03, 0x1D, 0x08, 0x02, 0x0F, 0x08, 0x03,
+    0x1D, 0x09, 0x02, 0x0B, 0x09, 0x03, 0x1D, 0x0A, 0x02, 0x0B, 0x0A, 0x03, 0x1E, 0x0B, 0x02, 0x0B,
+    0x0B, 0x02, 0x0E, 0x0C, 0x02, 0x0B, 0x0C, 0x02, 0x0E, 0x0D, 0x02, 0x0B, 0x0D, 0x02, 0x0E, 0x0E,
+    0x02, 0x0B, 0x0E, 0x02, 0x0E, 0x0E, 0x03, 0x2D, 0x0F, 0x02, 0x0E, 0x0F, 0x03, 0x1D, 0x10, 0x02,
+    0x0E, 0x10, 0x03, 0x1D, 0x11, 0x02, 0x0F, 0x11, 0x02, 0x0D, 0x12, 0x01, 0x01, 0xFF, 0x29, 0x00,
+    0x01, 0x01, 0xFF, 0x03, 0x1D, 0x00, 0x02, 0x0B, 0x00, 0x03, 0x1D, 0x01, 0x02, 0x0B, 0x01, 0x02,
+    0x0E, 0x02, 0x02, 0x0B, 0x02, 0x02, 0x0E, 0x02, 0x03, 0x1D, 0x03, 0x02, 0x0E, 0x03, 0x03, 0x1D,
+    0x04, 0x02, 0x0B, 0x04, 0x03, 0x1D, 0x05, 0x02, 0x0B, 0x05, 0x02, 0x0E, 0x06, 0x02, 0x0B, 0x06,
+    0x02, 0x0E, 0x06, 0x03, 0x1D, 0x07, 0x02, 0x0E, 0x07, 0x03, 0x1D, 0x08, 0x02, 0x0B, 0x08, 0x03,
+    0x1D, 0x09, 0x02, 0x0B, 0x09, 0x02, 0x0E, 0x0A, 0x02, 0x0B, 0x0A, 0x02, 0x0E, 0x0A, 0x03, 0x1D,
+    0x0B, 0x02, 0x0E, 0x0B, 0x03, 0x1D, 0x0C, 0x02, 0x0B, 0x0C, 0x02, 0x0E, 0x0D, 0x02, 0x0B, 0x0D,
+    0x02, 0x0E, 0x0E, 0x02, 0x0B, 0x0E, 0x02, 0x0E, 0x0E, 0x03, 0x1D, 0x0F, 0x02, 0x0E, 0x0F, 0x03,
+    0x1D, 0x10, 0x02, 0x0B, 0x10, 0x02, 0x0E, 0x11, 0x01, 0x02, 0xFF, 0x29, 0x00, 0x01, 0x01, 0xFF,
+    0x03, 0x1D, 0x00, 0x02, 0x0B, 0x00, 0x02, 0x0E, 0x01, 0x02, 0x0B, 0x01, 0x02, 0x0E, 0x01, 0x03,
+    0x1D, 0x02, 0x02, 0x0B, 0x02, 0x03, 0x1D, 0x03, 0x02, 0x0B, 0x03, 0x02, 0x0E, 0x04, 0x02, 0x07,
+    0x04, 0x02, 0x0E, 0x04, 0x03, 0x1D, 0x05, 0x02, 0x0B, 0x05, 0x02, 0x0E, 0x06, 0x02, 0x0B, 0x06,
+    0x02, 0x0E, 0x06, 0x03, 0x1D, 0x07, 0x02, 0x0B, 0x07, 0x03, 0x1D, 0x08, 0x02, 0x0B, 0x08, 0x02,
+    0x0E, 0x08, 0x03, 0x1D, 0x09, 0x02, 0x0E, 0x09, 0x03, 0x1D, 0x0A, 0x02, 0x0B, 0x0A, 0x02, 0x0E,
+    0x0B, 0x02, 0x0B, 0x0B, 0x02, 0x0E, 0x0B, 0x03, 0x1D, 0x0C, 0x02, 0x0B, 0x0C, 0x02, 0x0E, 0x0D,
+    0x02, 0x0B, 0x0D, 0x02, 0x0E, 0x0D, 0x03, 0x1D, 0x0E, 0x02, 0x0A, 0x0E, 0x03, 0x1D, 0x0F, 0x02,
+    0x0B, 0x0F, 0x02, 0x0E, 0x10, 0x02, 0x07, 0xFF, 0x2A, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x1D, 0x00,
+    0x02, 0x0B, 0x00, 0x02, 0x0E, 0x01, 0x02, 0x07, 0x01, 0x02, 0x0E, 0x01, 0x03, 0x1D, 0x02, 0x02,
+    0x0B, 0x02, 0x02, 0x0E, 0x02, 0x03, 0x1D, 0x03, 0x02, 0x0B, 0x03, 0x02, 0x0D, 0x04, 0x02, 0x0B,
+    0x04, 0x02, 0x0E, 0x04, 0x03, 0x1D, 0x05, 0x02, 0x0B, 0x05, 0x02, 0x0E, 0x06, 0x02, 0x07, 0x06,
+    0x02, 0x0E, 0x06, 0x03, 0x1D, 0x07, 0x02, 0x0B, 0x07, 0x02, 0x0E, 0x07, 0x03, 0x1D, 0x08, 0x02,
+    0x0A, 0x08, 0x03, 0x1D, 0x09, 0x02, 0x0B, 0x09, 0x02, 0x0E, 0x09, 0x03, 0x1D, 0x0A, 0x02, 0x0B,
+    0x0A, 0x02, 0x0E, 0x0B, 0x02, 0x0B, 0x0B, 0x02, 0x0E, 0x0B, 0x03, 0x1D, 0x0C, 0x02, 0x0B, 0x0C,
+    0x02, 0x0E, 0x0C, 0x03, 0x1D, 0x0D, 0x02, 0x0A, 0x0D, 0x03, 0x1D, 0x0E, 0x02, 0x0B, 0x0E, 0x02,
+    0x0E, 0x0E, 0x03, 0x1D, 0x0F, 0x01, 0x01, 0xFF, 0x2A, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x1D, 0x00,
+    0x02, 0x0B, 0x00, 0x02, 0x0E, 0x00, 0x03, 0x1D, 0x01, 0x02, 0x0B, 0x01, 0x02, 0x0E, 0x02, 0x02,
+    0x07, 0x02, 0x02, 0x0A, 0x02, 0x02, 0x0D, 0x03, 0x02, 0x0B, 0x03, 0x02, 0x0E, 0x03, 0x03, 0x1D,
+    0x04, 0x02, 0x0B, 0x04, 0x02, 0x0E, 0x04, 0x03, 0x1D, 0x05, 0x02, 0x0B, 0x05, 0x02, 0x0E, 0x05,
+    0x03, 0x1D, 0x06, 0x02, 0x0B, 0x06, 0x02, 0x0E, 0x07, 0x02, 0x07, 0x07, 0x02, 0x0A, 0x07, 0x02,
+    0x0D, 0x08, 0x02, 0x0B, 0x08, 0x02, 0x0E, 0x08, 0x03, 0x1D, 0x09, 0x02, 0x0B, 0x09, 0x02, 0x0E,
+    0x09, 0x03, 0x1D, 0x0A, 0x02, 0x0B, 0x0A, 0x02, 0x0E, 0x0A, 0x03, 0x1D, 0x0B, 0x02, 0x0B, 0x0B,
+    0x02, 0x0D, 0x0C, 0x02, 0x07, 0x0C, 0x02, 0x0A, 0x0C, 0x03, 0x1D, 0x0D, 0x02, 0x0B, 0x0D, 0x02,
+    0x0E, 0x0D, 0x03, 0x1D, 0x0E, 0x02, 0x06, 0xFF, 0x2A, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x1D, 0x00,
+    0x02, 0x0B, 0x00, 0x02, 0x0E, 0x00, 0x03, 0x1D, 0x01, 0x02, 0x0B, 0x01, 0x02, 0x0E, 0x01, 0x03,
+    0x1D, 0x02, 0x02, 0x0B, 0x02, 0x02, 0x0E, 0x02, 0x03, 0x1D, 0x03, 0x02, 0x0B, 0x03, 0x02, 0x0E,
+    0x03, 0x03, 0x1D, 0x04, 0x02, 0x0B, 0x04, 0x02, 0x0E, 0x04, 0x03, 0x1D, 0x05, 0x02, 0x0B, 0x05,
+    0x02, 0x0E, 0x05, 0x03, 0x1D, 0x06, 0x02, 0x0B, 0x06, 0x02, 0x0E, 0x06, 0x03, 0x1D, 0x07, 0x02,
+    0x0B, 0x07, 0x02, 0x0E, 0x07, 0x03, 0x1D, 0x08, 0x02, 0x0B, 0x08, 0x02, 0x0E, 0x08, 0x03, 0x1D,
+    0x09, 0x02, 0x0B, 0x09, 0x02, 0x0E, 0x09, 0x03, 0x1D, 0x0A, 0x02, 0x0B, 0x0A, 0x02, 0x0E, 0x0A,
+    0x03, 0x1D, 0x0B, 0x02, 0x0B, 0x0B, 0x02, 0x0E, 0x0B, 0x03, 0x1D, 0x0C, 0x02, 0x0B, 0x0C, 0x02,
+    0x0E, 0x0C, 0x03, 0x1D, 0x0D, 0x02, 0x07, 0xFF, 0x2B, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x1D, 0x00,
+    0x02, 0x0B, 0x00, 0x02, 0x0E, 0x00, 0x03, 0x1D, 0x01, 0x02, 0x0B, 0x01, 0x02, 0x0A, 0x01, 0x02,
+    0x0D, 0x02, 0x02, 0x07, 0x02, 0x02, 0x0B, 0x02, 0x02, 0x0E, 0x02, 0x03, 0x1D, 0x03, 0x02, 0x0B,
+    0x03, 0x02, 0x0E, 0x03, 0x03, 0x1D, 0x04, 0x02, 0x0B, 0x04, 0x02, 0x0A, 0x04, 0x02, 0x0D, 0x05,
+    0x02, 0x07, 0x05, 0x02, 0x0A, 0x05, 0x02, 0x0E, 0x05, 0x03, 0x1D, 0x06, 0x02, 0x0B, 0x06, 0x02,
+    0x0E, 0x06, 0x03, 0x1D, 0x07, 0x02, 0x0B, 0x07, 0x02, 0x0E, 0x07, 0x03, 0x1D, 0x08, 0x02, 0x07,
+    0x08, 0x02, 0x0A, 0x08, 0x02, 0x0D, 0x08, 0x03, 0x1D, 0x09, 0x02, 0x0B, 0x09, 0x02, 0x0E, 0x09,
+    0x03, 0x1D, 0x0A, 0x02, 0x0B, 0x0A, 0x02, 0x0E, 0x0A, 0x03, 0x1D, 0x0B, 0x02, 0x0B, 0x0B, 0x02,
+    0x0A, 0x0B, 0x02, 0x0D, 0x0C, 0x02, 0x07, 0x0C, 0x01, 0x01, 0xFF, 0x2B, 0x00, 0x01, 0x01, 0xFF,
+    0x03, 0x1D, 0x00, 0x02, 0x0B, 0x00, 0x02, 0x0A, 0x00, 0x02, 0x0D, 0x00, 0x03, 0x1D, 0x01, 0x02,
+    0x0B, 0x01, 0x02, 0x0E, 0x01, 0x03, 0x1D, 0x02, 0x02, 0x0B, 0x02, 0x02, 0x0A, 0x02, 0x02, 0x0E,
+    0x02, 0x03, 0x1D, 0x03, 0x02, 0x0B, 0x03, 0x02, 0x0E, 0x03, 0x02, 0x0D, 0x04, 0x02, 0x07, 0x04,
+    0x02, 0x0B, 0x04, 0x02, 0x0E, 0x04, 0x03, 0x1D, 0x05, 0x02, 0x0B, 0x05, 0x02, 0x0A, 0x05, 0x02,
+    0x0D, 0x05, 0x03, 0x1D, 0x06, 0x02, 0x0B, 0x06, 0x02, 0x0E, 0x06, 0x03, 0x1D, 0x07, 0x02, 0x07,
+    0x07, 0x02, 0x0A, 0x07, 0x02, 0x0E, 0x07, 0x03, 0x1D, 0x08, 0x02, 0x0B, 0x08, 0x02, 0x0E, 0x08,
+    0x02, 0x0D, 0x09, 0x02, 0x07, 0x09, 0x02, 0x0B, 0x09, 0x02, 0x0E, 0x09, 0x03, 0x1D, 0x0A, 0x02,
+    0x0B, 0x0A, 0x02, 0x0A, 0x0A, 0x02, 0x0E, 0x0A, 0x03, 0x1D, 0x0B, 0x02, 0x06, 0xFF, 0x2B, 0x00,
+    0x01, 0x01, 0xFF, 0x03, 0x1D, 0x00, 0x02, 0x0B, 0x00, 0x02, 0x0A, 0x00, 0x02, 0x0E, 0x00, 0x03,
+    0x1D, 0x01, 0x02, 0x0B, 0x01, 0x02, 0x0A, 0x01, 0x02, 0x0E, 0x01, 0x03, 0x1D, 0x02, 0x02, 0x0B,
+    0x02, 0x02, 0x0A, 0x02, 0x02, 0x0E, 0x02, 0x03, 0x1D, 0x03, 0x02, 0x0B, 0x03, 0x02, 0x0A, 0x03,
+    0x02, 0x0E, 0x03, 0x03, 0x1D, 0x04, 0x02, 0x0B, 0x04, 0x02, 0x0A, 0x04, 0x02, 0x0E, 0x04, 0x03,
+    0x1D, 0x05, 0x02, 0x0B, 0x05, 0x02, 0x0A, 0x05, 0x02, 0x0E, 0x05, 0x03, 0x1D, 0x06, 0x02, 0x0B,
+    0x06, 0x02, 0x0A, 0x06, 0x02, 0x0E, 0x06, 0x03, 0x1D, 0x07, 0x02, 0x0B, 0x07, 0x02, 0x0A, 0x07,
+    0x02, 0x0E, 0x07, 0x03, 0x1D, 0x08, 0x02, 0x0B, 0x08, 0x02, 0x0A, 0x08, 0x02, 0x0E, 0x08, 0x03,
+    0x1D, 0x09, 0x02, 0x0B, 0x09, 0x02, 0x0A, 0x09, 0x02, 0x0E, 0x09, 0x03, 0x1D, 0x0A, 0x02, 0x07,
+    0xFF, 0x2C, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x1D, 0x00, 0x02, 0x0B, 0x00, 0x02, 0x0A, 0x00, 0x02,
+    0x0E, 0x00, 0x03, 0x1D, 0x01, 0x02, 0x07, 0x01, 0x02, 0x0B, 0x01, 0x02, 0x0A, 0x01, 0x02, 0x0E,
+    0x01, 0x03, 0x1D, 0x02, 0x02, 0x0B, 0x02, 0x02, 0x0A, 0x02, 0x02, 0x0E, 0x02, 0x03, 0x1D, 0x03,
+    0x02, 0x07, 0x03, 0x02, 0x0B, 0x03, 0x02, 0x0E, 0x03, 0x02, 0x0D, 0x03, 0x03, 0x1D, 0x04, 0x02,
+    0x0B, 0x04, 0x02, 0x0A, 0x04, 0x02, 0x0E, 0x04, 0x03, 0x1D, 0x05, 0x02, 0x07, 0x05, 0x02, 0x0B,
+    0x05, 0x02, 0x0E, 0x05, 0x02, 0x0D, 0x05, 0x03, 0x1D, 0x06, 0x02, 0x0B, 0x06, 0x02, 0x0A, 0x06,
+    0x02, 0x0E, 0x06, 0x03, 0x1D, 0x07, 0x02, 0x07, 0x07, 0x02, 0x0B, 0x07, 0x02, 0x0E, 0x07, 0x02,
+    0x0D, 0x07, 0x03, 0x1D, 0x08, 0x02, 0x0B, 0x08, 0x02, 0x0A, 0x08, 0x02, 0x0E, 0x08, 0x03, 0x1D,
+    0x09, 0x02, 0x07, 0x09, 0x01, 0x01, 0xFF, 0x2C, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x1D, 0x00, 0x02,
+    0x0B, 0x00, 0x02, 0x0B, 0x00, 0x02, 0x0E, 0x00, 0x02, 0x0E, 0x00, 0x03, 0x1D, 0x01, 0x02, 0x0B,
+    0x01, 0x02, 0x0B, 0x01, 0x02, 0x0E, 0x01, 0x02, 0x0E, 0x01, 0x03, 0x1D, 0x02, 0x02, 0x0B, 0x02,
+    0x02, 0x0B, 0x02, 0x02, 0x0E, 0x02, 0x02, 0x0E, 0x02, 0x03, 0x1D, 0x03, 0x02, 0x07, 0x03, 0x02,
+    0x0B, 0x03, 0x02, 0x0A, 0x03, 0x02, 0x0E, 0x03, 0x03, 0x1D, 0x04, 0x02, 0x07, 0x04, 0x02, 0x0B,
+    0x04, 0x02, 0x0A, 0x04, 0x02, 0x0E, 0x04, 0x03, 0x1D, 0x05, 0x02, 0x07, 0x05, 0x02, 0x0B, 0x05,
+    0x02, 0x0A, 0x05, 0x02, 0x0E, 0x05, 0x03, 0x1D, 0x06, 0x02, 0x07, 0x06, 0x02, 0x0B, 0x06, 0x02,
+    0x0A, 0x06, 0x02, 0x0E, 0x06, 0x03, 0x1D, 0x07, 0x02, 0x07, 0x07, 0x02, 0x0B, 0x07, 0x02, 0x0A,
+    0x07, 0x02, 0x0E, 0x07, 0x03, 0x1D, 0x08, 0x02, 0x07, 0x08, 0x01, 0x01, 0xFF, 0x2C, 0x00, 0x01,
+    0x01, 0xFF, 0x03, 0x1D, 0x00, 0x02, 0x07, 0x00, 0x02, 0x0B, 0x00, 0x02, 0x0A, 0x00, 0x02, 0x0E,
+    0x00, 0x02, 0x0D, 0x00, 0x03, 0x1D, 0x01, 0x02, 0x0B, 0x01, 0x02, 0x0B, 0x01, 0x02, 0x0A, 0x01,
+    0x02, 0x0E, 0x01, 0x03, 0x1D, 0x01, 0x03, 0x1D, 0x02, 0x02, 0x0B, 0x02, 0x02, 0x0A, 0x02, 0x02,
+    0x0E, 0x02, 0x02, 0x0E, 0x02, 0x03, 0x1D, 0x03, 0x02, 0x07, 0x03, 0x02, 0x0B, 0x03, 0x02, 0x0A,
+    0x03, 0x02, 0x0E, 0x03, 0x02, 0x0E, 0x03, 0x03, 0x1D, 0x04, 0x02, 0x07, 0x04, 0x02, 0x0B, 0x04,
+    0x02, 0x0A, 0x04, 0x02, 0x0E, 0x04, 0x02, 0x0D, 0x04, 0x03, 0x1D, 0x05, 0x02, 0x0B, 0x05, 0x02,
+    0x0B, 0x05, 0x02, 0x0A, 0x05, 0x02, 0x0E, 0x05, 0x03, 0x1D, 0x05, 0x03, 0x1D, 0x06, 0x02, 0x0B,
+    0x06, 0x02, 0x0A, 0x06, 0x02, 0x0E, 0x06, 0x02, 0x0E, 0x06, 0x03, 0x1D, 0x06, 0x03, 0x1D, 0x07,
+    0x02, 0x06, 0xFF, 0x2C, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x1D, 0x00, 0x02, 0x07, 0x00, 0x02, 0x0B,
+    0x00, 0x02, 0x0A, 0x00, 0x02, 0x0A, 0x00, 0x02, 0x0E, 0x00, 0x03, 0x1D, 0x00, 0x03, 0x1D, 0x01,
+    0x02, 0x0B, 0x01, 0x02, 0x0B, 0x01, 0x02, 0x0A, 0x01, 0x02, 0x0E, 0x01, 0x02, 0x0E, 0x01, 0x03,
+    0x1D, 0x01, 0x03, 0x1D, 0x02, 0x02, 0x0B, 0x02, 0x02, 0x0B, 0x02, 0x02, 0x0A, 0x02, 0x02, 0x0E,
+    0x02, 0x02, 0x0E, 0x02, 0x03, 0x1D, 0x03, 0x02, 0x07, 0x03, 0x02, 0x0B, 0x03, 0x02, 0x0A, 0x03,
+    0x02, 0x0A, 0x03, 0x02, 0x0E, 0x03, 0x02, 0x0D, 0x03, 0x03, 0x1D, 0x04, 0x02, 0x07, 0x04, 0x02,
+    0x0B, 0x04, 0x02, 0x0A, 0x04, 0x02, 0x0E, 0x04, 0x02, 0x0E, 0x04, 0x03, 0x1D, 0x04, 0x03, 0x1D,
+    0x05, 0x02, 0x0B, 0x05, 0x02, 0x0B, 0x05, 0x02, 0x0A, 0x05, 0x02, 0x0E, 0x05, 0x02, 0x0E, 0x05,
+    0x03, 0x1D, 0x05, 0x03, 0x1D, 0x06, 0x02, 0x06, 0xFF, 0x2C, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x1D,
+    0x00, 0x02, 0x07, 0x00, 0x02, 0x0B, 0x00, 0x02, 0x0B, 0x00, 0x02, 0x0A, 0x00, 0x02, 0x0E, 0x00,
+    0x02, 0x0E, 0x00, 0x02, 0x0D, 0x00, 0x03, 0x1D, 0x00, 0x03, 0x1D, 0x01, 0x02, 0x0B, 0x01, 0x02,
+    0x0B, 0x01, 0x02, 0x0A, 0x01, 0x02, 0x0A, 0x01, 0x02, 0x0E, 0x01, 0x02, 0x0D, 0x01, 0x03, 0x1D,
+    0x01, 0x03, 0x1D, 0x02, 0x02, 0x0B, 0x02, 0x02, 0x0B, 0x02, 0x02, 0x0A, 0x02, 0x02, 0x0A, 0x02,
+    0x02, 0x0E, 0x02, 0x02, 0x0D, 0x02, 0x03, 0x1D, 0x02, 0x03, 0x1D, 0x03, 0x02, 0x0B, 0x03, 0x02,
+    0x0B, 0x03, 0x02, 0x0A, 0x03, 0x02, 0x0A, 0x03, 0x02, 0x0E, 0x03, 0x02, 0x0E, 0x03, 0x03, 0x1D,
+    0x03, 0x03, 0x1D, 0x04, 0x02, 0x0B, 0x04, 0x02, 0x0B, 0x04, 0x02, 0x0A, 0x04, 0x02, 0x0A, 0x04,
+    0x02, 0x0E, 0x04, 0x02, 0x0E, 0x04, 0x03, 0x1D, 0x04, 0x03, 0x1D, 0x05, 0x02, 0x07, 0xFF, 0x2C,
+    0x00, 0x01, 0x01, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0x00, 0x02, 0x0B, 0x00, 0x02, 0x0B, 0x00,
+    0x02, 0x0A, 0x00, 0x02, 0x0A, 0x00, 0x02, 0x0A, 0x00, 0x02, 0x0E, 0x00, 0x02, 0x0E, 0x00, 0x03,
+    0x1D, 0x00, 0x03, 0x1D, 0x00, 0x03, 0x1D, 0x01, 0x02, 0x0B, 0x01, 0x02, 0x0B, 0x01, 0x02, 0x0B,
+    0x01, 0x02, 0x0A, 0x01, 0x02, 0x0A, 0x01, 0x02, 0x0E, 0x01, 0x02, 0x0E, 0x01, 0x02, 0x0D, 0x01,
+    0x03, 0x1D, 0x01, 0x03, 0x1D, 0x02, 0x02, 0x0B, 0x02, 0x02, 0x0B, 0x02, 0x02, 0x0B, 0x02, 0x02,
+    0x0A, 0x02, 0x02, 0x0A, 0x02, 0x02, 0x0E, 0x02, 0x02, 0x0E, 0x02, 0x02, 0x0D, 0x02, 0x03, 0x1D,
+    0x02, 0x03, 0x1D, 0x03, 0x02, 0x07, 0x03, 0x02, 0x0B, 0x03, 0x02, 0x0B, 0x03, 0x02, 0x0A, 0x03,
+    0x02, 0x0A, 0x03, 0x02, 0x0E, 0x03, 0x02, 0x0E, 0x03, 0x02, 0x0E, 0x03, 0x03, 0x1D, 0x03, 0x03,
+    0x1D, 0x04, 0x02, 0x07, 0xFF, 0x2C, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0x00,
+    0x02, 0x07, 0x00, 0x02, 0x0B, 0x00, 0x02, 0x0B, 0x00, 0x02, 0x0B, 0x00, 0x02, 0x0A, 0x00, 0x02,
+    0x0A, 0x00, 0x02, 0x0A, 0x00, 0x02, 0x0E, 0x00, 0x02, 0x0E, 0x00, 0x02, 0x0E, 0x00, 0x03, 0x1D,
+    0x00, 0x03, 0x1D, 0x00, 0x03, 0x1D, 0x00, 0x03, 0x1D, 0x01, 0x02, 0x0B, 0x01, 0x02, 0x0B, 0x01,
+    0x02, 0x0B, 0x01, 0x02, 0x0A, 0x01, 0x02, 0x0A, 0x01, 0x02, 0x0A, 0x01, 0x02, 0x0E, 0x01, 0x02,
+    0x0E, 0x01, 0x02, 0x0E, 0x01, 0x02, 0x0E, 0x01, 0x03, 0x1D, 0x01, 0x03, 0x1D, 0x01, 0x03, 0x1D,
+    0x02, 0x02, 0x07, 0x02, 0x02, 0x0B, 0x02, 0x02, 0x0B, 0x02, 0x02, 0x0B, 0x02, 0x02, 0x0A, 0x02,
+    0x02, 0x0A, 0x02, 0x02, 0x0A, 0x02, 0x02, 0x0E, 0x02, 0x02, 0x0E, 0x02, 0x02, 0x0E, 0x02, 0x02,
+    0x0D, 0x02, 0x03, 0x1D, 0x02, 0x03, 0x1D, 0x03, 0x02, 0x07, 0xFF, 0x2D, 0x00, 0x01, 0x01, 0xFF,
+    0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0x00, 0x02, 0x0B, 0x00, 0x02, 0x0B, 0x00, 0x02,
+    0x0B, 0x00, 0x02, 0x0B, 0x00, 0x02, 0x0B, 0x00, 0x02, 0x0A, 0x00, 0x02, 0x0A, 0x00, 0x02, 0x0A,
+    0x00, 0x02, 0x0A, 0x00, 0x02, 0x0A, 0x00, 0x02, 0x0E, 0x00, 0x02, 0x0E, 0x00, 0x02, 0x0E, 0x00,
+    0x02, 0x0E, 0x00, 0x02, 0x0E, 0x00, 0x03, 0x1D, 0x00, 0x03, 0x1D, 0x00, 0x03, 0x1D, 0x00, 0x03,
+    0x1D, 0x00, 0x03, 0x1D, 0x01, 0x02, 0x07, 0x01, 0x02, 0x0B, 0x01, 0x02, 0x0B, 0x01, 0x02, 0x0B,
+    0x01, 0x02, 0x0B, 0x01, 0x02, 0x0B, 0x01, 0x02, 0x0A, 0x01, 0x02, 0x0A, 0x01, 0x02, 0x0A, 0x01,
+    0x02, 0x0A, 0x01, 0x02, 0x0E, 0x01, 0x02, 0x0E, 0x01, 0x02, 0x0E, 0x01, 0x02, 0x0E, 0x01, 0x02,
+    0x0E, 0x01, 0x02, 0x0D, 0x01, 0x03, 0x1D, 0x01, 0x03, 0x1D, 0x01, 0x03, 0x1D, 0x01, 0x03, 0x1D,
+    0x02, 0x01, 0x01, 0xFF, 0x2D, 0x00, 0x01, 0x01, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03,
+    0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0x00, 0x02, 0x07, 0x00, 0x02, 0x0B, 0x00, 0x02, 0x0B,
+    0x00, 0x02, 0x0B, 0x00, 0x02, 0x0B, 0x00, 0x02, 0x0B, 0x00, 0x02, 0x0B, 0x00, 0x02, 0x0B, 0x00,
+    0x02, 0x0B, 0x00, 0x02, 0x0B, 0x00, 0x02, 0x0B, 0x00, 0x02, 0x0A, 0x00, 0x02, 0x0A, 0x00, 0x02,
+    0x0A, 0x00, 0x02, 0x0A, 0x00, 0x02, 0x0A, 0x00, 0x02, 0x0A, 0x00, 0x02, 0x0A, 0x00, 0x02, 0x0A,
+    0x00, 0x02, 0x0A, 0x00, 0x02, 0x0A, 0x00, 0x02, 0x0E, 0x00, 0x02, 0x0E, 0x00, 0x02, 0x0E, 0x00,
+    0x02, 0x0E, 0x00, 0x02, 0x0E, 0x00, 0x02, 0x0E, 0x00, 0x02, 0x0E, 0x00, 0x02, 0x0E, 0x00, 0x02,
+    0x0E, 0x00, 0x02, 0x0E, 0x00, 0x03, 0x1D, 0x00, 0x03, 0x1D, 0x00, 0x03, 0x1D, 0x00, 0x03, 0x1D,
+    0x00, 0x03, 0x1D, 0x00, 0x03, 0x1D, 0x00, 0x03, 0x1D, 0x01, 0x01, 0x01, 0xFF, 0x2D, 0x00, 0x01,
+    0x01, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D,
+    0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF,
+    0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03,
+    0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D,
+    0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF,
+    0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03,
+    0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D,
+    0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF, 0x03, 0x1D, 0xFF,
+    0x03, 0x1D, 0x00, 0x01, 0x01,
+};
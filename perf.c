@@ -0,0 +1,49 @@
+// File: perf.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Free running tick counter for benchmarks, CPU cycles on target and nanoseconds on the host
+
+//************************************Includes***************************************/
+
+#ifdef HOST_BUILD
+#define _POSIX_C_SOURCE 199309L
+#include <time.h>
+#endif
+
+// Local Files
+#include "./perf.h"
+
+//*************************************Defines***************************************/
+
+// Cortex-M4 debug registers
+#define PERF_DEMCR          (*(volatile uint32_t *)0xE000EDFC)
+#define PERF_DEMCR_TRCENA   (1u << 24)
+#define PERF_DWT_CTRL       (*(volatile uint32_t *)0xE0001000)
+#define PERF_DWT_CYCCNTENA  (1u << 0)
+#define PERF_DWT_CYCCNT     (*(volatile uint32_t *)0xE0001004)
+
+//*************************************Public Functions***************************************/
+
+#ifdef HOST_BUILD
+
+void perf_init(void) {
+}
+
+uint32_t perf_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+}
+
+#else
+
+void perf_init(void) {
+    PERF_DEMCR |= PERF_DEMCR_TRCENA;
+    PERF_DWT_CTRL |= PERF_DWT_CYCCNTENA;
+}
+
+uint32_t perf_now(void) {
+    return PERF_DWT_CYCCNT;
+}
+
+#endif
@@ -0,0 +1,39 @@
+// File: perf.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Free running tick counter for benchmarks, CPU cycles on target and nanoseconds on the host
+
+#ifndef PERF_H_
+#define PERF_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Unit of perf_now (host builds define HOST_BUILD)
+#ifdef HOST_BUILD
+#define PERF_UNIT           "ns"
+#define PERF_TICKS_PER_MS   1000000u
+#else
+#define PERF_UNIT           "cycles"
+#define PERF_TICKS_PER_MS   80000u      // 80 MHz system clock (main.c)
+#endif
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+/// @brief Starts the counter (DWT cycle counter on target), safe to call more than once
+void perf_init(void);
+
+/// @brief Returns the counter, differences of two readings wrap correctly
+/// @return Ticks in PERF_UNIT
+uint32_t perf_now(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* PERF_H_ */
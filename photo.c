@@ -0,0 +1,338 @@
+// File: photo.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Streaming photo receiver, the UART ISR fills one row buffer while the other is sent
+//              to the panel, so a photo takes about as long as its bytes take on the wire. Photos can
+//              also arrive packed (codec.c) or progressively, coarse blocks first
+
+//************************************Includes***************************************/
+
+// Local Files
+#include "./photo.h"
+#include "./uart_rx.h"
+#include "./display.h"
+#include "./perf.h"
+#include "./codec.h"
+#include "./link.h"
+
+#include <stdio.h>
+#include <string.h>
+
+//*************************************Variables***************************************/
+
+// Row buffers, owned by the UART ISR between uart_rx_lines_begin and uart_rx_lines_end
+static uint8_t rows[PHOTO_LINES][PHOTO_ROW_BYTES];
+
+// Packed photos, decoded from the receive ring a chunk at a time
+static codec_t codec;
+static uint8_t chunk_buf[PHOTO_CHUNK];
+
+//*************************************Public Functions***************************************/
+
+bool photo_receive(char cmd, int16_t x, int16_t y, uint32_t first_timeout_ms, uint32_t row_timeout_ms,
+                   photo_stats_t *stats) {
+    uint64_t blit_ticks = 0;
+    uint64_t first_ticks = 0;
+    uint64_t total_ticks = 0;
+    uint32_t row = 0;
+
+    perf_init();
+
+    // Row buffers first, so the first bytes of the reply already land in them
+    link_stream_begin();
+    uart_rx_lines_begin(&rows[0][0], PHOTO_LINES, PHOTO_ROW_BYTES);
+    uint32_t start = perf_now();
+    uint32_t last = start;
+    link_stream_send((uint8_t)cmd, NULL, 0);
+
+    for (row = 0; row < PHOTO_SIZE; row++) {
+        const uint8_t *line = uart_rx_line_wait(row ? row_timeout_ms : first_timeout_ms);
+        if (!line) {
+            break;
+        }
+
+        uint32_t ready = perf_now();
+        total_ticks += (uint32_t)(ready - last);
+        if (row == 0) {
+            first_ticks = total_ticks;
+        }
+
+        // Rows arrive top first and the window fills from the lowest Y, so each row gets its own window
+        // The ISR keeps receiving the next row into the other buffer meanwhile
+        if (display_stream_begin(x, (int16_t)(y + PHOTO_SIZE - 1 - row), PHOTO_SIZE, 1)) {
+            display_stream_write(line, PHOTO_ROW_BYTES);
+            display_stream_end();
+        }
+        uart_rx_line_release();
+
+        last = perf_now();
+        blit_ticks += (uint32_t)(last - ready);
+        total_ticks += (uint32_t)(last - ready);
+    }
+    uart_rx_lines_end();
+    link_stream_end(row == PHOTO_SIZE);
+
+    if (stats) {
+        stats->rows = row;
+        stats->bytes = row * PHOTO_ROW_BYTES;
+        stats->pixel_bytes = stats->bytes;
+        stats->decode_per_px = 0;
+        stats->first_row_ms = (uint32_t)(first_ticks / PERF_TICKS_PER_MS);
+        stats->total_ms = (uint32_t)(total_ticks / PERF_TICKS_PER_MS);
+        stats->blit_ms = (uint32_t)(blit_ticks / PERF_TICKS_PER_MS);
+
+        // Throughput of the transfer itself, the capture time before the first row is left out
+        uint32_t transfer_ms = stats->total_ms - stats->first_row_ms;
+        stats->bytes_per_s = transfer_ms ? (uint32_t)((uint64_t)stats->bytes * 1000u / transfer_ms) : 0;
+        stats->complete = row == PHOTO_SIZE;
+        stats->format = PHOTO_RAW;
+    }
+    return row == PHOTO_SIZE;
+}
+
+/// @brief Decodes a packed reply of w x h pixels into panel rows, the request has already been sent
+/// @param start perf_now before the request
+static bool photo_packed_rows(int16_t x, int16_t y, uint16_t w, uint16_t h, uint32_t start,
+                              uint32_t first_timeout_ms, uint32_t chunk_timeout_ms, photo_stats_t *stats) {
+    uint8_t header[CODEC_HEADER_BYTES];
+    uint64_t blit_ticks = 0;
+    uint64_t decode_ticks = 0;
+    uint64_t first_ticks = 0;
+    uint64_t total_ticks = 0;
+    uint32_t row = 0;
+    uint32_t chunk = 0;
+    uint32_t chunk_pos = 0;
+    uint32_t remaining = 0;
+
+    uint32_t last = start;
+
+    // Payload length first, it arrives after the host has captured and encoded the frame
+    bool ok = uart_rx_read(header, sizeof(header), first_timeout_ms) == sizeof(header);
+    if (ok) {
+        remaining = ((uint32_t)header[0] << 24) | ((uint32_t)header[1] << 16) |
+                    ((uint32_t)header[2] << 8) | header[3];
+    }
+    uint32_t payload = remaining;
+    codec_init(&codec);
+
+    for (row = 0; ok && row < h; row++) {
+
+        // Decode one row, the ISR keeps filling the ring meanwhile
+        uint32_t filled = 0;
+        while (filled < w) {
+            if (chunk_pos == chunk) {
+                chunk = remaining < PHOTO_CHUNK ? remaining : PHOTO_CHUNK;
+                if (chunk == 0 || uart_rx_read(chunk_buf, chunk, chunk_timeout_ms) < chunk) {
+                    ok = false;
+                    break;
+                }
+                remaining -= chunk;
+                chunk_pos = 0;
+            }
+
+            uint32_t used;
+            uint32_t t = perf_now();
+            filled += codec_decode(&codec, &chunk_buf[chunk_pos], chunk - chunk_pos, &rows[0][filled * 2],
+                                   w - filled, &used);
+            decode_ticks += (uint32_t)(perf_now() - t);
+            chunk_pos += used;
+            if (codec.error) {
+                ok = false;
+                break;
+            }
+        }
+        if (!ok) {
+            break;
+        }
+
+        uint32_t ready = perf_now();
+        total_ticks += (uint32_t)(ready - last);
+        if (row == 0) {
+            first_ticks = total_ticks;
+        }
+
+        if (display_stream_begin(x, (int16_t)(y + h - 1 - row), (int16_t)w, 1)) {
+            display_stream_write(rows[0], w * 2u);
+            display_stream_end();
+        }
+
+        last = perf_now();
+        blit_ticks += (uint32_t)(last - ready);
+        total_ticks += (uint32_t)(last - ready);
+    }
+
+    // A short, broken or oversized stream leaves bytes behind that would be read as the next reply
+    if (!ok || remaining || chunk_pos != chunk) {
+        uart_rx_flush();
+    }
+
+    if (stats) {
+        stats->rows = row;
+        stats->bytes = CODEC_HEADER_BYTES + payload - remaining - (chunk - chunk_pos);
+        stats->pixel_bytes = row * w * 2u;
+        stats->decode_per_px = row ? (uint32_t)(decode_ticks / (row * w)) : 0;
+        stats->first_row_ms = (uint32_t)(first_ticks / PERF_TICKS_PER_MS);
+        stats->total_ms = (uint32_t)(total_ticks / PERF_TICKS_PER_MS);
+        stats->blit_ms = (uint32_t)(blit_ticks / PERF_TICKS_PER_MS);
+
+        uint32_t transfer_ms = stats->total_ms - stats->first_row_ms;
+        stats->bytes_per_s = transfer_ms ? (uint32_t)((uint64_t)stats->bytes * 1000u / transfer_ms) : 0;
+        stats->complete = row == h;
+        stats->format = PHOTO_PACKED;
+    }
+    return row == h;
+}
+
+bool photo_receive_packed(char cmd, int16_t x, int16_t y, uint32_t first_timeout_ms, uint32_t chunk_timeout_ms,
+                          photo_stats_t *stats) {
+    perf_init();
+    link_stream_begin();
+    uart_rx_flush();
+    uint32_t start = perf_now();
+    link_stream_send((uint8_t)cmd, NULL, 0);
+
+    bool ok = photo_packed_rows(x, y, PHOTO_SIZE, PHOTO_SIZE, start, first_timeout_ms, chunk_timeout_ms, stats);
+    link_stream_end(ok);
+    return ok;
+}
+
+bool photo_receive_tile(uint8_t zoom, uint16_t vx, uint16_t vy, uint16_t w, uint16_t h, int16_t x, int16_t y,
+                        uint32_t first_timeout_ms, uint32_t chunk_timeout_ms, photo_stats_t *stats) {
+    uint8_t args[PHOTO_TILE_ARGS] = {
+        zoom, (uint8_t)(vx >> 8), (uint8_t)vx, (uint8_t)(vy >> 8), (uint8_t)vy,
+        (uint8_t)(w >> 8), (uint8_t)w, (uint8_t)(h >> 8), (uint8_t)h
+    };
+    if (w == 0 || h == 0 || w > PHOTO_SIZE || zoom == 0 || zoom > PHOTO_ZOOM_MAX) {
+        return false;
+    }
+
+    perf_init();
+    link_stream_begin();
+    uart_rx_flush();
+    uint32_t start = perf_now();
+    link_stream_send(PHOTO_CMD_TILE, args, sizeof(args));
+
+    bool ok = photo_packed_rows(x, y, w, h, start, first_timeout_ms, chunk_timeout_ms, stats);
+    link_stream_end(ok);
+    return ok;
+}
+
+bool photo_receive_progressive(char cmd, int16_t x, int16_t y, uint32_t first_timeout_ms, uint32_t row_timeout_ms,
+                               photo_stats_t *stats) {
+    uint64_t blit_ticks = 0;
+    uint32_t pass_ms[PHOTO_PASSES] = { 0 };
+    uint32_t bytes = 0;
+    uint8_t pass = 0;
+    bool ok = true;
+
+    perf_init();
+    link_stream_begin();
+    uart_rx_flush();
+    uint32_t start = perf_now();
+    link_stream_send((uint8_t)cmd, NULL, 0);
+
+    for (uint16_t h = PHOTO_COARSE_STEP; ok && h >= 1; h /= 2) {
+        for (uint16_t row = 0; row < PHOTO_SIZE; row += h) {
+
+            // Rows drawn by an earlier pass only get the blocks between its pixels
+            bool drawn = h < PHOTO_COARSE_STEP && row % (h * 2) == 0;
+            uint16_t x0 = drawn ? h : 0;
+            uint16_t step = drawn ? h * 2 : h;
+            uint16_t count = (uint16_t)((PHOTO_SIZE - x0 + step - 1) / step);
+
+            if (uart_rx_read(rows[0], count * 2u, bytes ? row_timeout_ms : first_timeout_ms) < count * 2u) {
+                ok = false;
+                break;
+            }
+            bytes += count * 2u;
+
+            uint32_t ready = perf_now();
+            int16_t py = (int16_t)(y + PHOTO_SIZE - row - h);
+            if (!drawn) {
+
+                // New row, each pixel repeated across its block, then the row repeated down (one window)
+                uint8_t *out = rows[1];
+                for (uint16_t i = 0; i < count; i++) {
+                    for (uint16_t k = 0; k < h; k++) {
+                        *out++ = rows[0][2 * i];
+                        *out++ = rows[0][2 * i + 1];
+                    }
+                }
+                if (display_stream_begin(x, py, PHOTO_SIZE, (int16_t)h)) {
+                    for (uint16_t k = 0; k < h; k++) {
+                        display_stream_write(rows[1], PHOTO_ROW_BYTES);
+                    }
+                    display_stream_end();
+                }
+            } else {
+
+                // Every other block of a drawn row, one window each
+                for (uint16_t i = 0; i < count; i++) {
+                    uint16_t color = (uint16_t)((rows[0][2 * i] << 8) | rows[0][2 * i + 1]);
+                    if (display_stream_begin((int16_t)(x + x0 + i * step), py, (int16_t)h, (int16_t)h)) {
+                        for (uint16_t k = 0; k < h * h; k++) {
+                            display_stream_pixel(color);
+                        }
+                        display_stream_end();
+                    }
+                }
+            }
+            blit_ticks += (uint32_t)(perf_now() - ready);
+        }
+
+        if (ok) {
+            pass_ms[pass++] = (perf_now() - start) / PERF_TICKS_PER_MS;
+        }
+    }
+
+    // A pass that stopped short leaves the rest of the reply on the wire
+    if (!ok) {
+        uart_rx_flush();
+    }
+    link_stream_end(ok);
+
+    if (stats) {
+        memcpy(stats->pass_ms, pass_ms, sizeof(pass_ms));
+        stats->rows = pass ? PHOTO_SIZE : 0;
+        stats->bytes = bytes;
+        stats->pixel_bytes = bytes;
+        stats->decode_per_px = 0;
+        stats->first_row_ms = stats->pass_ms[0];
+        stats->total_ms = (perf_now() - start) / PERF_TICKS_PER_MS;
+        stats->blit_ms = (uint32_t)(blit_ticks / PERF_TICKS_PER_MS);
+
+        uint32_t transfer_ms = stats->total_ms - stats->first_row_ms;
+        stats->bytes_per_s = transfer_ms ? (uint32_t)((uint64_t)stats->bytes * 1000u / transfer_ms) : 0;
+        stats->complete = ok;
+        stats->format = PHOTO_PROGRESSIVE;
+    }
+    return ok;
+}
+
+void photo_stats_line(const photo_stats_t *stats, char *buf) {
+    uint32_t wire_ms = PHOTO_WIRE_MS(stats->bytes, link_baud());
+    uint32_t transfer_ms = stats->total_ms - stats->first_row_ms;
+
+    // Progressive photos show when each pass was on the panel
+    if (stats->format == PHOTO_PROGRESSIVE) {
+        snprintf(buf, PHOTO_STATS_LINE, "passes %lu/%lu/%lu/%lu ms",
+                 (unsigned long)stats->pass_ms[0], (unsigned long)stats->pass_ms[1],
+                 (unsigned long)stats->pass_ms[2], (unsigned long)stats->pass_ms[3]);
+        return;
+    }
+
+    // Packed photos show the compression ratio and decode cost instead
+    if (stats->format == PHOTO_PACKED) {
+        uint32_t ratio10 = stats->bytes ? (uint32_t)((uint64_t)stats->pixel_bytes * 10u / stats->bytes) : 0;
+        snprintf(buf, PHOTO_STATS_LINE, "%lu ms %lu.%lu:1 decode %lu %s/px",
+                 (unsigned long)stats->total_ms, (unsigned long)(ratio10 / 10), (unsigned long)(ratio10 % 10),
+                 (unsigned long)stats->decode_per_px, PERF_UNIT);
+        return;
+    }
+
+    // Transfer time against the wire time of the same bytes (100% = bound by the baud rate)
+    snprintf(buf, PHOTO_STATS_LINE, "%lu ms %lu B/s wire %lu%% blit %lu ms",
+             (unsigned long)stats->total_ms, (unsigned long)stats->bytes_per_s,
+             (unsigned long)(transfer_ms ? wire_ms * 100u / transfer_ms : 0),
+             (unsigned long)stats->blit_ms);
+}
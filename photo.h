@@ -0,0 +1,128 @@
+// File: photo.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Streaming photo receiver, the UART ISR fills one row buffer while the other is sent
+//              to the panel, so a photo takes about as long as its bytes take on the wire. Photos can
+//              also arrive packed (codec.c) or progressively, coarse blocks first
+
+#ifndef PHOTO_H_
+#define PHOTO_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Photo sent by Camera.py, big endian RGB565 rows, top row first
+#define PHOTO_SIZE          240
+#define PHOTO_ROW_BYTES     (PHOTO_SIZE * 2)
+#define PHOTO_LINES         2       // Row buffers (double buffered)
+#define PHOTO_CHUNK         64      // Packed photo bytes taken from the receive ring per read
+
+// Progressive photos: a pass of one pixel per 8x8 block (30x30), then each pass halves the block size.
+// A pass sends, row by row from the top, every pixel on its grid that an earlier pass did not send:
+// all of a row between earlier rows, every other pixel of a row an earlier pass already drew.
+// Each pixel is drawn as a block of the pass's size, so later passes refine the earlier ones
+#define PHOTO_COARSE_STEP   8
+#define PHOTO_PASSES        4       // Steps 8, 4, 2 and 1
+
+// Tiles of the last photo, which the host keeps at webcam resolution. At zoom Z the photo is a view of
+// (240 * Z)^2 pixels, a tile is any rectangle of that view sent packed (codec.c), top row first.
+// Request: a 'G' frame of zoom, then view x, view y, width, height (u16 big endian each)
+#define PHOTO_CMD_TILE      'G'
+#define PHOTO_TILE_ARGS     9
+#define PHOTO_ZOOM_MAX      4
+
+// Formats
+#define PHOTO_RAW           0
+#define PHOTO_PACKED        1
+#define PHOTO_PROGRESSIVE   2
+
+// UART link, 10 bits per byte on the wire at the negotiated rate (link_baud)
+#define PHOTO_WIRE_MS(bytes, baud) ((uint32_t)(((uint64_t)(bytes) * 10000u) / (baud)))
+
+#define PHOTO_STATS_LINE    80
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    uint32_t rows;          // Rows on the panel
+    uint32_t bytes;         // Bytes received
+    uint32_t pixel_bytes;   // Pixel bytes on the panel
+    uint32_t decode_per_px; // Decode time per pixel in PERF_UNIT (packed photos)
+    uint32_t first_row_ms;  // Request to first complete row (capture time on the host)
+    uint32_t total_ms;      // Request to last row on the panel
+    uint32_t blit_ms;       // Time spent sending rows to the panel (overlaps the receive)
+    uint32_t bytes_per_s;   // Throughput from the first row to the last
+    uint32_t pass_ms[PHOTO_PASSES]; // Request to the end of each pass (progressive photos)
+    bool complete;          // False if a row missed its deadline
+    uint8_t format;         // PHOTO_RAW, PHOTO_PACKED or PHOTO_PROGRESSIVE
+} photo_stats_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+/// @brief Requests a photo and draws each row as soon as it arrives (hold sem_Display)
+/// @param cmd Request byte sent to the host
+/// @param x X position of the photo
+/// @param y Y position of the bottom row of the photo
+/// @param first_timeout_ms Deadline for the first row (the host captures and converts first)
+/// @param row_timeout_ms Deadline for every other row
+/// @param stats Filled with the timings of this frame (may be NULL)
+/// @return True if every row arrived in time
+bool photo_receive(char cmd, int16_t x, int16_t y, uint32_t first_timeout_ms, uint32_t row_timeout_ms,
+                   photo_stats_t *stats);
+
+/// @brief Requests a photo packed with tools/codec.py and decodes it into panel rows (hold sem_Display)
+/// @param cmd Request byte sent to the host
+/// @param x X position of the photo
+/// @param y Y position of the bottom row of the photo
+/// @param first_timeout_ms Deadline for the length header (the host captures and encodes first)
+/// @param chunk_timeout_ms Deadline for every PHOTO_CHUNK bytes after it
+/// @param stats Filled with the timings of this frame (may be NULL)
+/// @return True if every row was decoded
+bool photo_receive_packed(char cmd, int16_t x, int16_t y, uint32_t first_timeout_ms, uint32_t chunk_timeout_ms,
+                          photo_stats_t *stats);
+
+/// @brief Requests a rectangle of the last photo at a zoom and draws it row by row (hold sem_Display)
+/// @param zoom View scale, 1 to PHOTO_ZOOM_MAX (1 is the photo as it was shown)
+/// @param vx Left edge in the view
+/// @param vy Top edge in the view
+/// @param w Width (at most PHOTO_SIZE)
+/// @param h Height
+/// @param x X position on the panel
+/// @param y Y position of the bottom row on the panel
+/// @param first_timeout_ms Deadline for the length header (the host scales the photo first)
+/// @param chunk_timeout_ms Deadline for every PHOTO_CHUNK bytes after it
+/// @param stats Filled with the timings of this tile (may be NULL)
+/// @return True if every row was decoded
+bool photo_receive_tile(uint8_t zoom, uint16_t vx, uint16_t vy, uint16_t w, uint16_t h, int16_t x, int16_t y,
+                        uint32_t first_timeout_ms, uint32_t chunk_timeout_ms, photo_stats_t *stats);
+
+/// @brief Requests a progressive photo and draws each pass as blocks the next pass refines (hold sem_Display)
+/// @param cmd Request byte sent to the host
+/// @param x X position of the photo
+/// @param y Y position of the bottom row of the photo
+/// @param first_timeout_ms Deadline for the first row of the coarse pass (the host captures first)
+/// @param row_timeout_ms Deadline for every other row
+/// @param stats Filled with the timings of this frame and of each pass (may be NULL)
+/// @return True if every pass arrived in time
+bool photo_receive_progressive(char cmd, int16_t x, int16_t y, uint32_t first_timeout_ms, uint32_t row_timeout_ms,
+                               photo_stats_t *stats);
+
+/// @brief Formats the timings of a frame for the panel
+/// @param stats Timings from photo_receive
+/// @param buf Output of at least PHOTO_STATS_LINE bytes
+void photo_stats_line(const photo_stats_t *stats, char *buf);
+
+/********************************Public Functions***********************************/
+
+#endif /* PHOTO_H_ */
@@ -0,0 +1,172 @@
+// File: proto.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Framed command protocol between the phone and Camera.py, every request and text reply
+//              travels as a frame with a sync word, type, sequence number, length and CRC, so a lost or
+//              corrupted byte costs one frame and the receiver finds the next sync word on its own
+
+//************************************Includes***************************************/
+
+// Local Files
+#include "./proto.h"
+#include "./uart_rx.h"
+#include "./RTOS/RTOS.h"
+
+#include <string.h>
+
+//*************************************Variables***************************************/
+
+// CRC-16/CCITT-FALSE a nibble at a time, 32 bytes of table instead of 512
+static const uint16_t crc_nibble[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+// UART0 receiver (read by the transport thread, link.c)
+static proto_rx_t uart_frames;
+static uint32_t idle_ms = 0;        // Since the last byte fed to the receiver
+
+//*************************************Helper Functions***************************************/
+
+/// @brief Drops the first count bytes of the window
+static void proto_drop(proto_rx_t *rx, uint16_t count) {
+    rx->have -= count;
+    memmove(rx->buf, rx->buf + count, rx->have);
+}
+
+/// @brief Checks the window from its start until a good frame is found or more bytes are needed.
+/// A bad frame only gives up its first byte, so a sync word inside it (the start of the next good
+/// frame) is still found.
+/// @return True if the window starts with a good frame
+static bool proto_scan(proto_rx_t *rx, proto_frame_t *frame) {
+    while (rx->have) {
+        if (rx->buf[0] != PROTO_SYNC0 || (rx->have > 1 && rx->buf[1] != PROTO_SYNC1)) {
+            uint16_t skip = 1;
+            while (skip < rx->have && rx->buf[skip] != PROTO_SYNC0) {
+                skip++;
+            }
+            rx->stats.skipped += skip;
+            proto_drop(rx, skip);
+            continue;
+        }
+        if (rx->have < PROTO_HEADER) {
+            return false;
+        }
+
+        uint16_t len = (uint16_t)((rx->buf[4] << 8) | rx->buf[5]);
+        uint16_t size = (uint16_t)(len + PROTO_OVERHEAD);
+        if (len <= PROTO_MAX_PAYLOAD && rx->have < size) {
+            return false;
+        }
+        if (len <= PROTO_MAX_PAYLOAD) {
+            uint16_t crc = (uint16_t)((rx->buf[PROTO_HEADER + len] << 8) | rx->buf[PROTO_HEADER + len + 1]);
+            if (proto_crc(rx->buf + 2, PROTO_HEADER - 2 + len, 0xFFFF) == crc) {
+                frame->type = rx->buf[2];
+                frame->seq = rx->buf[3];
+                frame->len = len;
+                frame->payload = rx->buf + PROTO_HEADER;
+                rx->done = size;
+                rx->stats.frames++;
+                return true;
+            }
+        }
+
+        // Corrupted length or CRC, look for the next sync word after this one
+        rx->stats.crc_errors++;
+        rx->stats.skipped++;
+        proto_drop(rx, 1);
+    }
+    return false;
+}
+
+//*************************************Public Functions***************************************/
+
+uint16_t proto_crc(const uint8_t *data, uint32_t len, uint16_t crc) {
+    while (len--) {
+        crc ^= (uint16_t)(*data++ << 8);
+        crc = (uint16_t)((crc << 4) ^ crc_nibble[crc >> 12]);
+        crc = (uint16_t)((crc << 4) ^ crc_nibble[crc >> 12]);
+    }
+    return crc;
+}
+
+uint16_t proto_encode(uint8_t *out, uint8_t type, uint8_t seq, const uint8_t *payload, uint16_t len) {
+    out[0] = PROTO_SYNC0;
+    out[1] = PROTO_SYNC1;
+    out[2] = type;
+    out[3] = seq;
+    out[4] = (uint8_t)(len >> 8);
+    out[5] = (uint8_t)len;
+    if (len) {
+        memcpy(out + PROTO_HEADER, payload, len);
+    }
+    uint16_t crc = proto_crc(out + 2, PROTO_HEADER - 2 + len, 0xFFFF);
+    out[PROTO_HEADER + len] = (uint8_t)(crc >> 8);
+    out[PROTO_HEADER + len + 1] = (uint8_t)crc;
+    return (uint16_t)(len + PROTO_OVERHEAD);
+}
+
+void proto_rx_init(proto_rx_t *rx) {
+    memset(rx, 0, sizeof(*rx));
+}
+
+bool proto_parse(proto_rx_t *rx, uint8_t byte, proto_frame_t *frame) {
+
+    // The frame handed out last is no longer needed
+    if (rx->done) {
+        proto_drop(rx, rx->done);
+        rx->done = 0;
+    }
+    rx->buf[rx->have++] = byte;
+    return proto_scan(rx, frame);
+}
+
+bool proto_idle(proto_rx_t *rx, proto_frame_t *frame) {
+    if (rx->done) {
+        proto_drop(rx, rx->done);
+        rx->done = 0;
+    }
+
+    // Nothing more is coming for what is left, so it cannot complete
+    while (rx->have) {
+        rx->stats.crc_errors++;
+        rx->stats.skipped++;
+        proto_drop(rx, 1);
+        if (proto_scan(rx, frame)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool proto_receive(proto_frame_t *frame, uint32_t timeout_ms) {
+    uint32_t waited = 0;
+
+    while (1) {
+
+        // Feed whatever is waiting, one frame at a time
+        while (uart_rx_available()) {
+            idle_ms = 0;
+            if (proto_parse(&uart_frames, (uint8_t)uart_rx_getc(0), frame)) {
+                return true;
+            }
+        }
+
+        // A partial frame the line went quiet on is a cut off one (or a length that was corrupted)
+        if (idle_ms >= PROTO_IDLE_MS && proto_idle(&uart_frames, frame)) {
+            return true;
+        }
+        if (waited >= timeout_ms) {
+            return false;
+        }
+
+        // Let every other thread run while the frame is on the wire
+        sleep(UART_RX_POLL_MS);
+        waited += UART_RX_POLL_MS;
+        idle_ms += UART_RX_POLL_MS;
+    }
+}
+
+proto_stats_t proto_stats(void) {
+    return uart_frames.stats;
+}
@@ -0,0 +1,116 @@
+// File: proto.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Framed command protocol between the phone and Camera.py, every request and text reply
+//              travels as a frame with a sync word, type, sequence number, length and CRC, so a lost or
+//              corrupted byte costs one frame and the receiver finds the next sync word on its own
+
+#ifndef PROTO_H_
+#define PROTO_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Frame: A5 5A, type, seq, length (u16 big endian), payload, CRC (u16 big endian).
+// The CRC is CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) over type, seq, length and payload.
+// The type is the command letter of the request ('T', 'W', 'G', ...), replies echo type and seq.
+// Pixel streams (photos, video) follow their request frame unframed, straight into the row buffers.
+#define PROTO_SYNC0         0xA5
+#define PROTO_SYNC1         0x5A
+#define PROTO_HEADER        6       // Sync word, type, seq, length
+#define PROTO_CRC_BYTES     2
+#define PROTO_OVERHEAD      (PROTO_HEADER + PROTO_CRC_BYTES)
+#define PROTO_MAX_PAYLOAD   256     // Longer lengths are taken as corruption
+#define PROTO_MAX_FRAME     (PROTO_OVERHEAD + PROTO_MAX_PAYLOAD)
+
+// A partial frame is dropped once the line has been quiet this long (frames are sent in one go)
+#define PROTO_IDLE_MS       20
+
+// Frame types the host sends on its own
+#define PROTO_TYPE_UNLOCK   'U'
+
+// Frame types of the link itself, line rate proposal / commit (u32 big endian rate), rate probe and
+// probe burst (a count, answered with that many full frames back to back)
+#define PROTO_TYPE_BAUD     'B'
+#define PROTO_TYPE_PROBE    'Q'
+#define PROTO_TYPE_BURST    'S'
+
+// Text replies served from the host cache end in this separator and the age of the data in decimal seconds
+#define PROTO_AGE_SEP       0x1E
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+// A received frame, payload points into the receiver and stays valid until its next byte
+typedef struct {
+    uint8_t type;
+    uint8_t seq;
+    uint16_t len;
+    const uint8_t *payload;
+} proto_frame_t;
+
+typedef struct {
+    uint32_t frames;        // Good frames
+    uint32_t crc_errors;    // Frames dropped for their CRC or length
+    uint32_t skipped;       // Bytes dropped while looking for a sync word
+} proto_stats_t;
+
+// Receiver, a window of the bytes that may still start a frame
+typedef struct {
+    uint8_t buf[PROTO_MAX_FRAME];
+    uint16_t have;          // Bytes in buf
+    uint16_t done;          // Bytes of the frame handed out last, dropped on the next byte
+    proto_stats_t stats;
+} proto_rx_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+/// @brief CRC-16/CCITT-FALSE, continued from crc (start with 0xFFFF)
+uint16_t proto_crc(const uint8_t *data, uint32_t len, uint16_t crc);
+
+/// @brief Builds a frame
+/// @param out At least len + PROTO_OVERHEAD bytes
+/// @param type Frame type
+/// @param seq Sequence number
+/// @param payload Payload (may be NULL if len is 0)
+/// @param len Payload length, at most PROTO_MAX_PAYLOAD
+/// @return Frame length
+uint16_t proto_encode(uint8_t *out, uint8_t type, uint8_t seq, const uint8_t *payload, uint16_t len);
+
+/// @brief Resets a receiver (its counters too)
+void proto_rx_init(proto_rx_t *rx);
+
+/// @brief Feeds one received byte to the resync state machine
+/// @param rx Receiver
+/// @param byte Next byte off the wire
+/// @param frame Filled when a frame completes
+/// @return True if the byte completed a good frame
+bool proto_parse(proto_rx_t *rx, uint8_t byte, proto_frame_t *frame);
+
+/// @brief Drops a partial frame that will not complete, the line went quiet during it
+/// @param rx Receiver
+/// @param frame Filled if a good frame was waiting behind the partial one
+/// @return True if a good frame was found
+bool proto_idle(proto_rx_t *rx, proto_frame_t *frame);
+
+/// @brief Waits for the next good frame from UART0, sleeping while none is waiting
+/// @param frame Filled with the frame, its payload is valid until the next call
+/// @param timeout_ms Time to wait (at least, in sleeps of UART_RX_POLL_MS), 0 never waits
+/// @return True if a frame arrived in time
+bool proto_receive(proto_frame_t *frame, uint32_t timeout_ms);
+
+/// @brief Counters of the UART0 receiver since boot
+proto_stats_t proto_stats(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* PROTO_H_ */
@@ -0,0 +1,222 @@
+// File: sprite.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Scanline sprite renderer for lane based games, composites each lane in a RAM line
+//              buffer and only pushes the columns that changed since the last frame
+
+//************************************Includes***************************************/
+
+// Local Files
+#include "./sprite.h"
+
+#include <string.h>
+
+//*************************************Structures***************************************/
+
+typedef struct {
+    int16_t x, y, w, h;
+    uint16_t color;
+    bool active;
+} sprite_t;
+
+// Half open column span [start, end)
+typedef struct {
+    int16_t start;
+    int16_t end;
+} sprite_span_t;
+
+//*************************************Variables***************************************/
+
+// Lane layout
+static const uint16_t *lane_bg;
+static uint8_t lanes = 0;
+static uint8_t lane_h = 0;
+static int16_t lane_w = 0;
+
+// Sprites on the panel and sprites of the frame being built
+static sprite_t shown[SPRITE_MAX];
+static sprite_t next[SPRITE_MAX];
+
+// Damaged spans per lane
+static sprite_span_t spans[SPRITE_MAX_LANES][SPRITE_MAX_SPANS];
+static uint8_t num_spans[SPRITE_MAX_LANES];
+
+// Lane line buffer
+static uint16_t line[DISPLAY_WIDTH];
+
+//*************************************Helper Functions***************************************/
+
+/// @brief Adds a damaged column span to a lane, merging it with spans it touches
+static void sprite_damage(int16_t lane, int16_t start, int16_t end) {
+    if (lane < 0 || lane >= lanes) {
+        return;
+    }
+
+    // Clip to the lane
+    if (start < 0) start = 0;
+    if (end > lane_w) end = lane_w;
+    if (start >= end) {
+        return;
+    }
+
+    sprite_span_t *list = spans[lane];
+    uint8_t n = num_spans[lane];
+
+    // Absorb every span that overlaps or touches the new one
+    for (uint8_t i = 0; i < n; ) {
+        if (list[i].start <= end && start <= list[i].end) {
+            if (list[i].start < start) start = list[i].start;
+            if (list[i].end > end) end = list[i].end;
+            list[i] = list[--n];
+        } else {
+            i++;
+        }
+    }
+
+    // Out of slots, fold everything into one span
+    if (n == SPRITE_MAX_SPANS) {
+        for (uint8_t i = 0; i < n; i++) {
+            if (list[i].start < start) start = list[i].start;
+            if (list[i].end > end) end = list[i].end;
+        }
+        n = 0;
+    }
+
+    list[n++] = (sprite_span_t){ start, end };
+    num_spans[lane] = n;
+}
+
+/// @brief Damages the columns that differ between the shown and the next state of one sprite
+static void sprite_diff(const sprite_t *old, const sprite_t *cur) {
+    int16_t old_lane = old->active ? (int16_t)(old->y / lane_h) : -1;
+    int16_t cur_lane = cur->active ? (int16_t)(cur->y / lane_h) : -1;
+
+    // Same sprite moved sideways, only the leading and trailing edges changed
+    if (old->active && cur->active && old_lane == cur_lane &&
+        old->y == cur->y && old->w == cur->w && old->h == cur->h && old->color == cur->color) {
+        if (old->x != cur->x) {
+            int16_t a = old->x < cur->x ? old->x : cur->x;
+            int16_t b = old->x < cur->x ? cur->x : old->x;
+            sprite_damage(cur_lane, a, b);
+            sprite_damage(cur_lane, (int16_t)(a + cur->w), (int16_t)(b + cur->w));
+        }
+        return;
+    }
+
+    // Anything else repaints both footprints
+    if (old->active) {
+        sprite_damage(old_lane, old->x, (int16_t)(old->x + old->w));
+    }
+    if (cur->active) {
+        sprite_damage(cur_lane, cur->x, (int16_t)(cur->x + cur->w));
+    }
+}
+
+/// @brief Composites one row of a lane span into the line buffer
+/// @param lane Lane index
+/// @param row Row inside the lane (0 is the lowest Y)
+/// @param start First column
+/// @param end Last column (exclusive)
+static void sprite_compose(uint8_t lane, int16_t row, int16_t start, int16_t end) {
+    int16_t y = (int16_t)(lane * lane_h + row);
+
+    // Lane background
+    for (int16_t x = start; x < end; x++) {
+        line[x] = lane_bg[lane];
+    }
+
+    // Sprites in ID order
+    for (uint8_t i = 0; i < SPRITE_MAX; i++) {
+        const sprite_t *s = &next[i];
+        if (!s->active || y < s->y || y >= s->y + s->h) {
+            continue;
+        }
+        int16_t a = s->x > start ? s->x : start;
+        int16_t b = (s->x + s->w) < end ? (int16_t)(s->x + s->w) : end;
+        for (int16_t x = a; x < b; x++) {
+            line[x] = s->color;
+        }
+    }
+}
+
+/// @brief Returns a mask of the sprites that cover a row of a span (rows with equal masks share a line)
+static uint32_t sprite_row_mask(uint8_t lane, int16_t row, int16_t start, int16_t end) {
+    int16_t y = (int16_t)(lane * lane_h + row);
+    uint32_t mask = 0;
+    for (uint8_t i = 0; i < SPRITE_MAX; i++) {
+        const sprite_t *s = &next[i];
+        if (s->active && y >= s->y && y < s->y + s->h && s->x < end && s->x + s->w > start) {
+            mask |= (1u << i);
+        }
+    }
+    return mask;
+}
+
+//*************************************Public Functions***************************************/
+
+void sprite_init(const uint16_t *lane_colors, uint8_t num_lanes, uint8_t lane_height, int16_t width) {
+    lane_bg = lane_colors;
+    lanes = num_lanes > SPRITE_MAX_LANES ? SPRITE_MAX_LANES : num_lanes;
+    lane_h = lane_height;
+    lane_w = width > DISPLAY_WIDTH ? DISPLAY_WIDTH : width;
+
+    memset(shown, 0, sizeof(shown));
+    memset(next, 0, sizeof(next));
+    sprite_invalidate();
+}
+
+void sprite_invalidate(void) {
+    for (uint8_t lane = 0; lane < lanes; lane++) {
+        spans[lane][0] = (sprite_span_t){ 0, lane_w };
+        num_spans[lane] = 1;
+    }
+}
+
+void sprite_begin_frame(void) {
+    for (uint8_t i = 0; i < SPRITE_MAX; i++) {
+        next[i].active = false;
+    }
+}
+
+void sprite_add(uint8_t id, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (id >= SPRITE_MAX || w <= 0 || h <= 0) {
+        return;
+    }
+    next[id] = (sprite_t){ x, y, w, h, color, true };
+}
+
+void sprite_end_frame(void) {
+
+    // Work out which columns changed
+    for (uint8_t i = 0; i < SPRITE_MAX; i++) {
+        sprite_diff(&shown[i], &next[i]);
+    }
+
+    // Push each damaged span of each lane as one window
+    for (uint8_t lane = 0; lane < lanes; lane++) {
+        for (uint8_t s = 0; s < num_spans[lane]; s++) {
+            int16_t start = spans[lane][s].start;
+            int16_t end = spans[lane][s].end;
+            uint32_t prev_mask = 0;
+
+            display_stream_begin(start, (int16_t)(lane * lane_h), (int16_t)(end - start), lane_h);
+            for (int16_t row = 0; row < lane_h; row++) {
+
+                // Rows covered by the same sprites reuse the line buffer
+                uint32_t mask = sprite_row_mask(lane, row, start, end);
+                if (row == 0 || mask != prev_mask) {
+                    sprite_compose(lane, row, start, end);
+                    prev_mask = mask;
+                }
+                for (int16_t x = start; x < end; x++) {
+                    display_stream_pixel(line[x]);
+                }
+            }
+            display_stream_end();
+        }
+        num_spans[lane] = 0;
+    }
+
+    // The new frame is now on the panel
+    memcpy(shown, next, sizeof(shown));
+}
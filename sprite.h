@@ -0,0 +1,63 @@
+// File: sprite.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Scanline sprite renderer for lane based games, composites each lane in a RAM line
+//              buffer and only pushes the columns that changed since the last frame
+
+#ifndef SPRITE_H_
+#define SPRITE_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./display.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Sprite slots, the ID also sets the draw order (higher IDs are drawn on top)
+#define SPRITE_MAX          32
+
+// Lane limits
+#define SPRITE_MAX_LANES    16
+#define SPRITE_MAX_SPANS    8   // Damaged column spans tracked per lane before they are merged
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+// Usage (hold sem_Display around sprite_end_frame):
+//   sprite_init(LANE_COLORS, NUM_LANES, GRID_SIZE, GAME_WIDTH);
+//   every frame: sprite_begin_frame(); sprite_add(...) for each visible sprite; sprite_end_frame();
+
+/// @brief Sets the lane backgrounds and forces a full repaint on the next frame
+/// @param lane_colors Background color of each lane (lane 0 starts at Y = 0)
+/// @param num_lanes Number of lanes (at most SPRITE_MAX_LANES)
+/// @param lane_height Height of each lane in pixels
+/// @param width Width of the lanes in pixels (at most DISPLAY_WIDTH)
+void sprite_init(const uint16_t *lane_colors, uint8_t num_lanes, uint8_t lane_height, int16_t width);
+
+/// @brief Forces every lane to be repainted on the next frame (after something else drew over them)
+void sprite_invalidate(void);
+
+/// @brief Starts a new frame, every sprite not added again before sprite_end_frame is erased
+void sprite_begin_frame(void);
+
+/// @brief Adds a sprite to the current frame, a sprite must stay within one lane
+/// @param id Sprite slot (0 to SPRITE_MAX - 1)
+/// @param x X position (may be partly off screen)
+/// @param y Y position
+/// @param w Width
+/// @param h Height
+/// @param color RGB565 color
+void sprite_add(uint8_t id, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+/// @brief Pushes every changed column span of every lane, one window per span
+void sprite_end_frame(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* SPRITE_H_ */
@@ -0,0 +1,124 @@
+// File: text.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Batched text runs, a whole string is rendered with an opaque background from the
+//              glyph atlas into a line buffer and sent as one burst
+
+//************************************Includes***************************************/
+
+// Local Files
+#include "./text.h"
+#include "./display.h"
+#include "./font5x7.h"
+#include "./glyph_atlas.h"
+
+//*************************************Variables***************************************/
+
+// One screen row of the run
+static uint16_t line[DISPLAY_WIDTH];
+
+//*************************************Public Functions***************************************/
+
+uint32_t text_glyph_row(char c, uint8_t row, uint8_t size) {
+    if (c < FONT_FIRST_CHAR || c > FONT_LAST_CHAR) {
+        c = '?';
+    }
+    uint8_t g = (uint8_t)(c - FONT_FIRST_CHAR);
+
+    // Pre-scaled sizes
+    switch (size) {
+        case 1: return glyph_atlas_1[g][row];
+        case 2: return glyph_atlas_2[g][row];
+        case 4: return glyph_atlas_4[g][row];
+        case 5: return glyph_atlas_5[g][row];
+        default: break;
+    }
+
+    // Other sizes are scaled from the font
+    uint32_t bits = 0;
+    for (uint8_t col = 0; col < FONT_GLYPH_COLS; col++) {
+        if (font5x7[g][col] & (1 << row)) {
+            bits |= ((1u << size) - 1) << (col * size);
+        }
+    }
+    return bits;
+}
+
+void text_draw(int16_t x, int16_t y, const char *str, uint8_t size, uint16_t fg, uint16_t bg, int16_t width) {
+    if (size == 0) {
+        return;
+    }
+    if (size > TEXT_MAX_SIZE) {
+        size = TEXT_MAX_SIZE;
+    }
+
+    // Length of the run
+    uint16_t len = 0;
+    while (str[len] && str[len] != '\n') {
+        len++;
+    }
+
+    int16_t cell = (int16_t)(TEXT_CELL_WIDTH * size);
+    int16_t height = (int16_t)(TEXT_CELL_HEIGHT * size);
+    int32_t total = (int32_t)len * cell;
+    if (total < width) {
+        total = width;
+    }
+
+    // Visible part of the run
+    int32_t x0 = x, x1 = (int32_t)x + total;
+    int32_t y0 = (int32_t)y - height + 1, y1 = (int32_t)y + 1;
+    if (x0 < 0) x0 = 0;
+    if (x1 > DISPLAY_WIDTH) x1 = DISPLAY_WIDTH;
+    if (y0 < 0) y0 = 0;
+    if (y1 > DISPLAY_HEIGHT) y1 = DISPLAY_HEIGHT;
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+    int16_t vis_w = (int16_t)(x1 - x0);
+
+    // Characters that touch the visible columns
+    uint16_t first = (uint16_t)((x0 - x) / cell);
+    uint16_t last = (uint16_t)((x1 - 1 - x) / cell + 1);
+    if (last > len) {
+        last = len;
+    }
+
+    display_stream_begin((int16_t)x0, (int16_t)y0, vis_w, (int16_t)(y1 - y0));
+
+    // The window fills from the lowest Y, so the bottom glyph row goes first
+    for (int8_t row = TEXT_CELL_HEIGHT - 1; row >= 0; row--) {
+
+        // Screen rows covered by this glyph row
+        int32_t row_lo = (int32_t)y - (row + 1) * size + 1;
+        int32_t row_hi = row_lo + size;
+        if (row_lo < y0) row_lo = y0;
+        if (row_hi > y1) row_hi = y1;
+        if (row_lo >= row_hi) {
+            continue;
+        }
+
+        // Render the whole run for this row into the line buffer
+        for (int16_t i = 0; i < vis_w; i++) {
+            line[i] = bg;
+        }
+        for (uint16_t c = first; c < last; c++) {
+            uint32_t bits = text_glyph_row(str[c], (uint8_t)row, size);
+            int32_t px = (int32_t)x + (int32_t)c * cell - x0;
+            for (; bits; bits >>= 1, px++) {
+                if ((bits & 1) && px >= 0 && px < vis_w) {
+                    line[px] = fg;
+                }
+            }
+        }
+
+        // Send the line once for each screen row it covers
+        for (int32_t r = row_lo; r < row_hi; r++) {
+            for (int16_t i = 0; i < vis_w; i++) {
+                display_stream_pixel(line[i]);
+            }
+        }
+    }
+
+    display_stream_end();
+}
@@ -0,0 +1,50 @@
+// File: text.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Batched text runs, a whole string is rendered with an opaque background from the
+//              glyph atlas into a line buffer and sent as one burst
+
+#ifndef TEXT_H_
+#define TEXT_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Cell of one character at size 1
+#define TEXT_CELL_WIDTH     6
+#define TEXT_CELL_HEIGHT    8
+
+// Largest size whose scaled cell row fits in 32 bits, larger sizes are drawn at this size
+#define TEXT_MAX_SIZE       5
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+/// @brief Draws a string with an opaque background in one address window
+///        (works for every size, unlike the GFX library background logic for size > 1)
+/// @param x Cursor X position
+/// @param y Cursor Y position (glyphs extend towards lower Y, like display_setCursor)
+/// @param str String to print (stops at a newline)
+/// @param size Text size, 1, 2, 4 and 5 come from the pre-scaled atlas
+/// @param fg RGB565 text color
+/// @param bg RGB565 background color
+/// @param width Minimum width in pixels, the run is padded with background so a shorter string
+///              replaces a longer one without a separate clear (0 for no padding)
+void text_draw(int16_t x, int16_t y, const char *str, uint8_t size, uint16_t fg, uint16_t bg, int16_t width);
+
+/// @brief Returns one scaled row of a glyph cell (spacing column included, bit 0 is the leftmost pixel)
+/// @param c Character
+/// @param row Glyph row, 0 is the top row
+/// @param size Text size (at most 5)
+/// @return Row bits, TEXT_CELL_WIDTH * size bits wide
+uint32_t text_glyph_row(char c, uint8_t row, uint8_t size);
+
+/********************************Public Functions***********************************/
+
+#endif /* TEXT_H_ */
@@ -16,19 +16,32 @@
 #include "./threads.h"
 #include "./MultimodDrivers/multimod.h"
 #include "./MultimodDrivers/GFX_Library.h"
-
-// Photos
-#include "Frogger.h"
-#include "Compass.h"
-#include "Weather.h"
-#include "Camera.h"
+#include "./display.h"
+#include "./compositor.h"
+#include "./sprite.h"
+#include "./text.h"
+#include "./widget.h"
+#include "./heading.h"
+#include "./needle.h"
+#include "./uart_rx.h"
+#include "./photo.h"
+#include "./video.h"
+#include "./link.h"
+#include "./perf.h"
+
+// Photos (generated by tools/asset_convert.py, already in panel order)
+#include "./asset.h"
+#include "Frogger_asset.h"
+#include "Compass_asset.h"
+#include "Weather_asset.h"
+#include "Camera_asset.h"
 
 // General Includes
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
-#include <math.h>
 #include <stdlib.h>
+#include <stdio.h>
 
 // Driverlib
 #include "driverlib/sysctl.h"
@@ -42,6 +55,24 @@
 #define UART_BASE       UART0_BASE
 #define LOCATION_BUF_SIZE 128
 
+// Host reply deadlines (Camera.py gives its web requests 2 seconds)
+#define HOST_REPLY_TIMEOUT_MS   3000
+#define PHOTO_ROW_TIMEOUT_MS    1000
+#define VIDEO_STATS_MS          1000    // Frame rate readout period
+
+// Cached host data only shows its age (in whole minutes) once it is older than the TTL Camera.py refreshes
+// it within, so a working cache repaints nothing
+#define WEATHER_STALE_S         600     // WEATHER_TTL_S
+#define LOCATION_STALE_S        3600    // LOCATION_TTL_S
+
+// Zoom and pan over the photo the host holds on to
+#define CAMERA_PAN_STEP         60      // Screen pixels per joystick move
+#define CAMERA_JOY_CENTER       2048
+#define CAMERA_JOY_DEAD         1000
+
+// BTN1 held at least this long in the camera app picks the next photo format instead of snapping
+#define CAMERA_LONG_PRESS_MS    600
+
 // Screen Dimensions
 #define MAX_SCREEN_X    240
 #define MAX_SCREEN_Y    280
@@ -69,6 +100,7 @@
 #define FROG_OFFSET     2
 #define MAX_ENTITIES    30
 #define SPAWN_RATE      25
+#define FROG_SPRITE_ID  MAX_ENTITIES // Drawn after every entity
 
 // Colors
 #define COLOR_BG        0x0000
@@ -99,10 +131,17 @@ const uint16_t LANE_COLORS[NUM_LANES] = {
 #define COMPASS_CENTER_X  120
 #define COMPASS_CENTER_Y  140
 #define COMPASS_RADIUS    50
-#define NEEDLE_LENGTH     45
 #define COLOR_CIRCLE      0xFFFF
 #define COLOR_NEEDLE      0xF800
-#define M_PI              3.14159265358979323846
+
+// The needle (NEEDLE_REACH long) must stay clear of the tick so the dial is never repainted
+#if NEEDLE_REACH >= COMPASS_RADIUS - 5
+#error "Compass needle reaches the dial tick"
+#endif
+
+// Magnetometer samples at 30 Hz, the app reads it at the same rate
+#define COMPASS_SAMPLE_MS       33
+#define COMPASS_LOCATION_SAMPLES (2000 / COMPASS_SAMPLE_MS) // Location every 2 seconds
 
 // Magnetometer Constants
 #define INTERFERANCE_CONFIGURATION_REGISTER 0x6B
@@ -113,6 +152,7 @@ const uint16_t LANE_COLORS[NUM_LANES] = {
 
 #define MAGNETOMETER_OPERATIONAL_MODE 0x4C
 #define MAGNETOMETER_NORMAL_OPERATION 0x00
+#define MAGNETOMETER_ODR_30HZ 0x38
 
 #define MAGNETOMETER_X_Y_REPITIONS 0x51
 #define MAGNETOMETER_X_Y_9_REPITIONS 0x04
@@ -128,11 +168,12 @@ const uint16_t LANE_COLORS[NUM_LANES] = {
 // Buttons
 #define BUTTON_SELECT_MASK  0x02
 #define BUTTON_HOME_MASK    0x10
+#define BUTTON_VIDEO_MASK   0x04
+#define BUTTON_ZOOM_MASK    0x08
 
 // Frogger Entity Structure
 typedef struct {
     float x;
-    float prev_x;
     uint16_t y;
     float speed;
     uint8_t width_pixels;
@@ -146,41 +187,100 @@ volatile bool is_unlocked = false;
 volatile uint8_t current_app = APP_NONE;
 volatile uint8_t selected_icon_idx = 0;
 volatile bool take_photo_flag = false;
+volatile bool video_flag = false;
+volatile bool zoom_flag = false;
+volatile bool photo_mode_flag = false;
 
 volatile Entity_t frogger_entities[MAX_ENTITIES];
 
+// Retained widgets, each one only repaints the glyph cells (or needle) that changed
+static widget_t lock_time;
+static widget_t compass_location, compass_needle;
+static widget_t weather_temp, weather_cond, weather_city, weather_country, weather_detail, weather_loading, weather_age;
+
 //*************************************Helper Functions***************************************/
 
-/// @brief Displays a photo to the ST7789 Screen
-/// @param x_pos X position to print the photo
-/// @param y_pos Y position to print the photo
-/// @param bitmap pointer to a bitmap array of RGB565 hexadecimal values representing the phtoo
-/// @param w Width of the photo
-/// @param h Height of the photo
-void display_photo(uint16_t x_pos, uint16_t y_pos, const uint8_t *bitmap, uint16_t w, uint16_t h) {
-    uint16_t color;
-    uint32_t index = 0;
+/// @brief Sends a request to the host and sleeps until its text reply (or the deadline)
+/// @param cmd Request type
+/// @param reply Reply buffer, NUL terminated on success (longer replies are cut short)
+/// @param len Reply buffer size
+/// @return True if the reply arrived before HOST_REPLY_TIMEOUT_MS
+static bool Host_Request(char cmd, char *reply, uint32_t len) {
+    int32_t n = link_request((uint8_t)cmd, NULL, 0, (uint8_t *)reply, (uint16_t)(len - 1), HOST_REPLY_TIMEOUT_MS);
+    if (n < 0) {
+        return false;
+    }
+    reply[n] = '\0';
+    return true;
+}
 
-    // Loop through all pixels
-    for (uint16_t y = 0; y < h; y++) {
-        for (uint16_t x = 0; x < w; x++) {
+/// @brief Splits the data age off a reply the host answered from its cache (PROTO_AGE_SEP then seconds)
+/// @param reply NUL terminated reply, cut at the separator
+/// @return Age of the data in seconds, -1 if the reply carries none
+static int32_t Host_Reply_Age(char *reply) {
+    char *sep = strchr(reply, PROTO_AGE_SEP);
+    if (sep == NULL) {
+        return -1;
+    }
+    *sep = '\0';
+    return (int32_t)strtol(sep + 1, NULL, 10);
+}
 
-            // Fix X and Y positions to not print off the screen
-            if ((x_pos + x >= MAX_SCREEN_X) || (y_pos + y >= MAX_SCREEN_Y)) { 
-                index += 2;
-                continue;
-            }
+/// @brief Formats the age of a cached reply once it is stale
+/// @param age Age in seconds from Host_Reply_Age (-1 for none)
+/// @param stale_s Age from which the data is stale
+/// @param fmt printf format taking the age in whole minutes
+/// @param buf Output
+/// @param len Output size
+/// @return True if the age is to be shown
+static bool Host_Stale_Text(int32_t age, int32_t stale_s, const char *fmt, char *buf, size_t len) {
+    if (age < stale_s) {
+        return false;
+    }
+    snprintf(buf, len, fmt, (long)(age / 60));
+    return true;
+}
 
-            // Little Endian Printing
-            uint8_t low_byte  = bitmap[index];
-            uint8_t high_byte = bitmap[index + 1];
-            color = (uint16_t)((high_byte << 8) | low_byte);
+/// @brief Frames the host sends on its own, called on the transport thread
+static void Host_Frame(const proto_frame_t *frame) {
+    if (frame->type == PROTO_TYPE_UNLOCK) {
+        is_unlocked = true;
+    }
+}
 
-            // Print to Screen
-            ST7789_DrawPixel(x_pos + x, y_pos + (h - 1 - y), color);
-            index += 2;
-        }
+/// @brief Snaps a photo in one of the formats the host serves (hold sem_Display)
+/// @param format PHOTO_PROGRESSIVE ('R'), PHOTO_RAW ('P') or PHOTO_PACKED ('Z')
+/// @param stats Filled with the timings of the photo
+/// @return True if the whole photo arrived
+static bool Camera_Snap(uint8_t format, photo_stats_t *stats) {
+    if (format == PHOTO_RAW) {
+        return photo_receive('P', 0, 0, HOST_REPLY_TIMEOUT_MS, PHOTO_ROW_TIMEOUT_MS, stats);
+    }
+    if (format == PHOTO_PACKED) {
+        return photo_receive_packed('Z', 0, 0, HOST_REPLY_TIMEOUT_MS, PHOTO_ROW_TIMEOUT_MS, stats);
     }
+    return photo_receive_progressive('R', 0, 0, HOST_REPLY_TIMEOUT_MS, PHOTO_ROW_TIMEOUT_MS, stats);
+}
+
+/// @brief Name of a photo format as shown above the photo
+/// @param format PHOTO_RAW, PHOTO_PACKED or PHOTO_PROGRESSIVE
+static const char *Camera_Format_Name(uint8_t format) {
+    if (format == PHOTO_RAW) {
+        return "FORMAT RAW";
+    }
+    if (format == PHOTO_PACKED) {
+        return "FORMAT PACKED";
+    }
+    return "FORMAT PROGRESSIVE";
+}
+
+/// @brief Keeps one edge of the screen inside a zoomed photo
+/// @param v Left or top edge within the view
+/// @param zoom View scale
+/// @return v clamped to 0 .. PHOTO_SIZE * (zoom - 1)
+static int32_t Camera_Clamp_View(int32_t v, uint8_t zoom) {
+    int32_t max_view = PHOTO_SIZE * (zoom - 1);
+    return v < 0 ? 0 : v > max_view ? max_view : v;
 }
 
 /// @brief Check the entity collision state for the frog and an entity
@@ -198,40 +298,47 @@ bool CheckCollision(float fx, float fy, float ex, float ey, float ew) {
 }
 
 /// @brief Drawing the compass as a background function
-/// @param heading_deg The degree to draw the compass needle at
-void DrawCompass(double heading_deg) {
-    // Inital state
-    static int16_t prev_tip_x = COMPASS_CENTER_X;
-    static int16_t prev_tip_y = COMPASS_CENTER_Y;
+/// @param heading The heading to draw the compass needle at (binary angle units)
+void DrawCompass(uint16_t heading) {
 
-    // Convert degrees to radians
-    double angle_rad = (heading_deg * (M_PI / 180.0)) + M_PI;
+    // The needle points at (180 - heading) degrees, mirrored so it turns against the board
+    uint16_t angle = (uint16_t)(0x8000 - heading);
 
-    // Calculate position of the end of the compass
-    int16_t tip_x = COMPASS_CENTER_X + (int16_t)(cos(angle_rad) * NEEDLE_LENGTH);
-    int16_t tip_y = COMPASS_CENTER_Y - (int16_t)(sin(angle_rad) * NEEDLE_LENGTH);
+    // Most samples land on the same needle step, the display is not needed for those
+    if (!widget_needle_moved(&compass_needle, angle)) {
+        return;
+    }
 
     // Wait for display
     RTOS_WaitSemaphore(&sem_Display);
 
-    // Clear previous needle
-    ST7789_DrawLine(COMPASS_CENTER_X, COMPASS_CENTER_Y, prev_tip_x, prev_tip_y, COLOR_BG);
+    // Needle for North direction, only the pixels that changed are sent (never the dial)
+    widget_set_needle(&compass_needle, angle);
+
+    // Release display
+    RTOS_SignalSemaphore(&sem_Display);
+}
+
+/// @brief Draws the compass dial, the needle is shorter than the dial so it is only drawn once
+void DrawCompass_Dial(void) {
 
     // Draw outer circle
     ST7789_DrawCircle(COMPASS_CENTER_X, COMPASS_CENTER_Y, COMPASS_RADIUS, COLOR_CIRCLE);
 
     // Draw centerline at bottom of compass
     ST7789_DrawLine(COMPASS_CENTER_X, COMPASS_CENTER_Y - COMPASS_RADIUS, COMPASS_CENTER_X, COMPASS_CENTER_Y - COMPASS_RADIUS + 5, COLOR_CIRCLE);
-    
-    // Draw line for North direction
-    ST7789_DrawLine(COMPASS_CENTER_X, COMPASS_CENTER_Y, tip_x, tip_y, COLOR_NEEDLE);
+}
 
-    // Release display
-    RTOS_SignalSemaphore(&sem_Display);
+/// @brief Draws a text line padded with background to the right edge (one opaque run, no flicker)
+/// @param x Cursor X position
+/// @param y Cursor Y position
+/// @param str String to print, NULL clears the line only
+/// @param size Text size
+/// @param color Text color
+void DrawText_Line(int16_t x, int16_t y, const char *str, uint8_t size, uint16_t color) {
 
-    // Update previous / current state
-    prev_tip_x = tip_x;
-    prev_tip_y = tip_y;
+    // The padding replaces whatever a longer previous string left behind
+    text_draw(x, y, str ? str : "", size, color, COLOR_BG, MAX_SCREEN_X - x);
 }
 
 /// @brief Function for printing home screen
@@ -242,17 +349,22 @@ void DrawHome_Static(void) {
     char *labels[4] = {"Camera", "Compass", "Weather", "Frogger"};
 
     // Reset screen
-    ST7789_DrawRectangle(0, 0, MAX_SCREEN_X, MAX_SCREEN_Y, COLOR_BG);
+    comp_rect(0, 0, MAX_SCREEN_X, MAX_SCREEN_Y, COLOR_BG);
 
     // Title
-    display_setCursor(80, 260);
-    // Use Transparent Text (GFX Lib has bug in Bg logic for Size > 1)
-    display_setTextColor(COLOR_TEXT);
-    display_setTextSize(1);
-    char *title = "HOME MENU";
-    while(*title) display_print(*title++);
-
-    // Loop for printing app icons and text
+    comp_text(80, 260, "HOME MENU", 1, COLOR_TEXT);
+
+    // Add label underneath each photo
+    for(int i = 0; i < 4; i++) {
+        x = START_X + (i % 2) * (BOX_WIDTH + BOX_GAP);
+        y = START_Y + (i / 2) * (BOX_HEIGHT + BOX_GAP);
+        comp_text(x + 10, y - 10, labels[i], 1, COLOR_TEXT);
+    }
+
+    // Send background and text in one pass
+    comp_flush();
+
+    // Loop for printing app icons
     for(int i = 0; i < 4; i++) {
 
         // Initalize Variables
@@ -264,60 +376,99 @@ void DrawHome_Static(void) {
         y = START_Y + row * (BOX_HEIGHT + BOX_GAP);
 
         // Display photos
-        if (i == 0) display_photo(x, y, Camera_map, Camera_PHOTO_WIDTH, Camera_PHOTO_HEIGHT);
-        else if (i == 1) display_photo(x, y, Compass_map, Compass_PHOTO_WIDTH, Compass_PHOTO_HEIGHT);
-        else if (i == 2) display_photo(x, y, Weather_map, Weather_PHOTO_WIDTH, Weather_PHOTO_HEIGHT);
-        else if (i == 3) display_photo(x, y, Frogger_map, Frogger_PHOTO_WIDTH, Frogger_PHOTO_HEIGHT);
-
-        // Add label underneath each photo
-        display_setCursor(x + 10, y - 10);
-        char *ptr = labels[i];
-        while(*ptr) display_print(*ptr++);
+        if (i == 0) asset_draw(x, y, &Camera_asset);
+        else if (i == 1) asset_draw(x, y, &Compass_asset);
+        else if (i == 2) asset_draw(x, y, &Weather_asset);
+        else if (i == 3) asset_draw(x, y, &Frogger_asset);
     }
 }
 
+/// @brief Records the 2 pixel cursor frame around an app icon
+/// @param idx App icon index
+/// @param color Frame color
+void DrawHome_Frame(uint8_t idx, uint16_t color) {
+
+    int row = idx / 2; // Integer division, either 0 or 1
+    int col = idx % 2; // Alternates between 0 and 1
+
+    // Printing logic
+    int16_t x = START_X + col * (BOX_WIDTH + BOX_GAP) - 2;
+    int16_t y = START_Y + row * (BOX_HEIGHT + BOX_GAP) - 2;
+
+    // Only the frame is drawn, the icon inside is never touched
+    comp_rect(x, y, BOX_WIDTH + 4, 2, color);                  // Bottom
+    comp_rect(x, y + BOX_HEIGHT + 2, BOX_WIDTH + 4, 2, color); // Top
+    comp_rect(x, y + 2, 2, BOX_HEIGHT, color);                 // Left
+    comp_rect(x + BOX_WIDTH + 2, y + 2, 2, BOX_HEIGHT, color); // Right
+}
+
 /// @brief Updates the cursor for which app is selected
 /// @param prev_idx Previous cursor location
 /// @param curr_idx Current cursor location
 void UpdateHome_Cursor(uint8_t prev_idx, uint8_t curr_idx) {
-    
-    uint16_t x, y; // Cursor X and Y position
-
 
+    // Clear cursor
     if (prev_idx != 255) {
+        DrawHome_Frame(prev_idx, COLOR_BG);
+    }
 
-        int row = prev_idx / 2; // Integer division, either 0 or 1
-        int col = prev_idx % 2; // Alternates between 0 and 1
+    // Draw cursor
+    DrawHome_Frame(curr_idx, COLOR_SELECT);
+    comp_flush();
+}
 
-        // Printing logic
-        x = START_X + col * (BOX_WIDTH + BOX_GAP);
-        y = START_Y + row * (BOX_HEIGHT + BOX_GAP);
+/// @brief Streams video until video mode is toggled off or the app is left, block deltas at full
+///        resolution while the link keeps up and upscaled 120x120 or 80x80 frames when it does not
+void Camera_Video(void) {
 
-        // Clear cursor
-        ST7789_DrawRectangle(x - 2, y - 2, BOX_WIDTH + 4, BOX_HEIGHT + 4, COLOR_BG);
+    // Local variables
+    video_stats_t stats = { 0 };        // Frames since the last readout
+    video_adapt_t adapt;                // Resolution picked from the frame times
+    char stats_line[VIDEO_STATS_LINE];  // Frame rate as shown above the video
+    char cmd = VIDEO_CMD_KEY;           // The first frame repaints every block
+    bool ok;
 
-        // Redraw app
-        if (prev_idx == 0) display_photo(x, y, Camera_map, Camera_PHOTO_WIDTH, Camera_PHOTO_HEIGHT);
-        else if (prev_idx == 1) display_photo(x, y, Compass_map, Compass_PHOTO_WIDTH, Compass_PHOTO_HEIGHT);
-        else if (prev_idx == 2) display_photo(x, y, Weather_map, Weather_PHOTO_WIDTH, Weather_PHOTO_HEIGHT);
-        else if (prev_idx == 3) display_photo(x, y, Frogger_map, Frogger_PHOTO_WIDTH, Frogger_PHOTO_HEIGHT);
-    }
+    video_stats_reset(&stats);
+    video_adapt_init(&adapt, 1);
+    while (video_flag && current_app == APP_CAMERA) {
 
-    int row = curr_idx / 2; // Integer division, either 0 or 1
-    int col = curr_idx % 2; // Alternates between 0 and 1
+        // Wait on semaphore
+        RTOS_WaitSemaphore(&sem_Display);
 
-    // Printing logic
-    x = START_X + col * (BOX_WIDTH + BOX_GAP);
-    y = START_Y + row * (BOX_HEIGHT + BOX_GAP);
+        // Decode one frame, at full resolution only the blocks that changed are sent
+        if (adapt.scale == 1) {
+            ok = video_frame(cmd, 0, 0, HOST_REPLY_TIMEOUT_MS, &stats);
+        } else {
+            ok = video_frame_scaled(adapt.scale, 0, 0, HOST_REPLY_TIMEOUT_MS, &stats);
+        }
 
-    // Draw cursor
-    ST7789_DrawRectangle(x - 2, y - 2, BOX_WIDTH + 4, BOX_HEIGHT + 4, COLOR_SELECT);
+        // Frame rate readout
+        if (!ok) {
+            DrawText_Line(0, 270, "NO HOST REPLY", 1, COLOR_SELECT);
+        } else if (video_stats_ms(&stats) >= VIDEO_STATS_MS) {
+            video_stats_line(&stats, stats_line);
+            DrawText_Line(0, 270, stats_line, 1, COLOR_TEXT);
+            video_stats_reset(&stats);
+        }
+
+        // Release semaphore
+        RTOS_SignalSemaphore(&sem_Display);
+
+        // Key frames are a one off cost and do not count towards the resolution choice
+        bool key = adapt.scale == 1 && cmd == VIDEO_CMD_KEY;
+        if (ok && !key && video_adapt(&adapt, stats.last_ms)) {
 
-    // Redraw app
-    if (curr_idx == 0) display_photo(x, y, Camera_map, Camera_PHOTO_WIDTH, Camera_PHOTO_HEIGHT);
-    else if (curr_idx == 1) display_photo(x, y, Compass_map, Compass_PHOTO_WIDTH, Compass_PHOTO_HEIGHT);
-    else if (curr_idx == 2) display_photo(x, y, Weather_map, Weather_PHOTO_WIDTH, Weather_PHOTO_HEIGHT);
-    else if (curr_idx == 3) display_photo(x, y, Frogger_map, Frogger_PHOTO_WIDTH, Frogger_PHOTO_HEIGHT);
+            // The host's copy of the panel is stale after scaled frames, go back to full resolution with a key frame
+            cmd = VIDEO_CMD_KEY;
+        } else {
+
+            // After a lost frame the panel no longer matches the host's copy, start over from a key frame
+            cmd = ok ? VIDEO_CMD_DELTA : VIDEO_CMD_KEY;
+        }
+
+        // Release RTOS (a static scene answers with an empty frame right away)
+        sleep(1);
+    }
 }
 
 //*************************************Threads***************************************/
@@ -328,33 +479,61 @@ void UpdateHome_Cursor(uint8_t prev_idx, uint8_t curr_idx) {
 void Camera_App(void) {
     
     // Local variables
-    uint16_t x, y;               // X and Y location for each pixel
-    uint8_t high_byte, low_byte; // Individual bytes for pixel color for proper screen transmission
-    uint16_t pixel_color;        // Individual pixel colors (combined high and low byte)
+    photo_stats_t stats;                // Timings of the last photo
+    char stats_line[PHOTO_STATS_LINE];  // Timings as shown under the title area
+    bool held = false;                  // The last photo is on screen and the host still has it
+    uint8_t zoom = 1;                   // Scale of the view shown (1 is the whole photo)
+    uint8_t format = PHOTO_PROGRESSIVE; // Format BTN1 snaps, a long press picks the next one
+    int32_t view_x = 0;                 // Top left of the screen within the view, top row 0
+    int32_t view_y = 0;
 
     // Wait for semaphore
     RTOS_WaitSemaphore(&sem_Display);
 
     // Reset screen color
-    ST7789_DrawRectangle(0, 0, MAX_SCREEN_X, MAX_SCREEN_Y, COLOR_BG);
+    comp_rect(0, 0, MAX_SCREEN_X, MAX_SCREEN_Y, COLOR_BG);
 
     // Print instructions
-    display_setCursor(80, 150);
-    display_setTextColor(COLOR_TEXT);
-    char *msg1 = "CAMERA READY";
-    while(*msg1) display_print(*msg1++);
-    display_setCursor(60, 130);
-    char *msg2 = "Press BTN1 to Snap";
-    while(*msg2) display_print(*msg2++);
+    comp_text(80, 150, "CAMERA READY", 1, COLOR_TEXT);
+    comp_text(60, 130, "Press BTN1 to Snap", 1, COLOR_TEXT);
+    comp_text(48, 115, "Press BTN2 for Video", 1, COLOR_TEXT);
+    comp_text(30, 100, "BTN3 Zoom, Joystick Pan", 1, COLOR_TEXT);
+    comp_text(60, 85, "Hold BTN1 for Format", 1, COLOR_TEXT);
+    comp_text(0, 255, Camera_Format_Name(format), 1, COLOR_TEXT);
+    comp_flush();
 
     // Release semaphore
     RTOS_SignalSemaphore(&sem_Display);
 
-    // Reset flag
+    // Reset flags
     take_photo_flag = false;
+    video_flag = false;
+    zoom_flag = false;
+    photo_mode_flag = false;
 
     // Ensure that photo is not sent or recieved outside of the app
     while(current_app == APP_CAMERA) {
+        bool fetch = false;
+
+        // Video until BTN2 is pressed again, it draws over the photo
+        if (video_flag) {
+            Camera_Video();
+            held = false;
+        }
+
+        // Formats in turn: progressive, raw, packed
+        if (photo_mode_flag) {
+            photo_mode_flag = false;
+            format = format == PHOTO_PROGRESSIVE ? PHOTO_RAW : format == PHOTO_RAW ? PHOTO_PACKED : PHOTO_PROGRESSIVE;
+
+            // Wait on semaphore
+            RTOS_WaitSemaphore(&sem_Display);
+
+            DrawText_Line(0, 255, Camera_Format_Name(format), 1, COLOR_TEXT);
+
+            // Release semaphore
+            RTOS_SignalSemaphore(&sem_Display);
+        }
 
         // Wait for flag
         if (take_photo_flag) {
@@ -366,28 +545,93 @@ void Camera_App(void) {
             RTOS_WaitSemaphore(&sem_Display);
 
             // Display information for debugging and also for user
-            display_setCursor(80, 150);
-            display_setTextColor(COLOR_SELECT);
-            char *msg3 = "CAPTURING...";
-            while(*msg3) display_print(*msg3++);
+            DrawText_Line(80, 150, "CAPTURING...", 1, COLOR_SELECT);
 
             // Release semaphore
             RTOS_SignalSemaphore(&sem_Display);
 
-            // Signal photo
-            UARTCharPut(UART_BASE, 'P');
+            // Wait on semaphore
+            RTOS_WaitSemaphore(&sem_Display);
+
+            // Progressive by default, a coarse photo within a few hundred ms that refines in place.
+            // Whatever the format, the host keeps the frame at webcam resolution for zooming.
+            held = Camera_Snap(format, &stats);
+            zoom = 1;
+            view_x = 0;
+            view_y = 0;
+
+            // An unzoomed photo, the line the zoom label used shows the format again
+            DrawText_Line(0, 255, Camera_Format_Name(format), 1, COLOR_TEXT);
+            if (held) {
+                photo_stats_line(&stats, stats_line);
+                DrawText_Line(0, 270, stats_line, 1, COLOR_TEXT);
+            } else {
+
+                // Host went quiet, the rows that made it stay up
+                DrawText_Line(80, 150, "NO HOST REPLY", 1, COLOR_SELECT);
+            }
+
+            // Release semaphore
+            RTOS_SignalSemaphore(&sem_Display);
+        }
+
+        // Zoom steps 1, 2, 4 and back to 1 around the middle of the screen
+        if (zoom_flag) {
+            zoom_flag = false;
+            if (held) {
+                uint8_t next = zoom >= PHOTO_ZOOM_MAX ? 1 : (uint8_t)(zoom * 2);
+                view_x = (view_x + PHOTO_SIZE / 2) * next / zoom - PHOTO_SIZE / 2;
+                view_y = (view_y + PHOTO_SIZE / 2) * next / zoom - PHOTO_SIZE / 2;
+                zoom = next;
+                view_x = Camera_Clamp_View(view_x, zoom);
+                view_y = Camera_Clamp_View(view_y, zoom);
+                fetch = true;
+            }
+        }
+
+        // Pan a zoomed photo with the joystick
+        if (held && zoom > 1) {
+            uint32_t joy = JOYSTICK_GetXY();
+            int16_t jx = (int16_t)((joy >> 16) & 0xFFFF);
+            int16_t jy = (int16_t)(joy & 0xFFFF);
+            int32_t old_x = view_x;
+            int32_t old_y = view_y;
+
+            if (jx > CAMERA_JOY_CENTER + CAMERA_JOY_DEAD) {
+                view_y -= CAMERA_PAN_STEP;
+            } else if (jx < CAMERA_JOY_CENTER - CAMERA_JOY_DEAD) {
+                view_y += CAMERA_PAN_STEP;
+            }
+            if (jy > CAMERA_JOY_CENTER + CAMERA_JOY_DEAD) {
+                view_x -= CAMERA_PAN_STEP;
+            } else if (jy < CAMERA_JOY_CENTER - CAMERA_JOY_DEAD) {
+                view_x += CAMERA_PAN_STEP;
+            }
+
+            view_x = Camera_Clamp_View(view_x, zoom);
+            view_y = Camera_Clamp_View(view_y, zoom);
+            fetch |= view_x != old_x || view_y != old_y;
+        }
+
+        // Only the visible part of the view crosses the link, the host scales and crops it.
+        // Without a frame buffer a pan redraws the whole screen rather than scrolling it.
+        if (fetch) {
 
             // Wait on semaphore
             RTOS_WaitSemaphore(&sem_Display);
 
-            // Display photo
-            for (y = 0; y < 240; y++) {
-                for (x = 0; x < 240; x++) {
-                    high_byte = (uint8_t)UARTCharGet(UART_BASE);
-                    low_byte  = (uint8_t)UARTCharGet(UART_BASE);
-                    pixel_color = (uint16_t)((high_byte << 8) | low_byte);
-                    ST7789_DrawPixel(x, 240 - 1 - y, pixel_color);
-                }
+            held = photo_receive_tile(zoom, (uint16_t)view_x, (uint16_t)view_y, PHOTO_SIZE, PHOTO_SIZE, 0, 0,
+                                      HOST_REPLY_TIMEOUT_MS, PHOTO_ROW_TIMEOUT_MS, &stats);
+            if (held) {
+                char zoom_line[] = "ZOOM x1";
+                zoom_line[6] = (char)('0' + zoom);
+                photo_stats_line(&stats, stats_line);
+                DrawText_Line(0, 270, stats_line, 1, COLOR_TEXT);
+
+                // Back at x1 the whole photo is up, labelled with its format like a new snap
+                DrawText_Line(0, 255, zoom > 1 ? zoom_line : Camera_Format_Name(format), 1, COLOR_TEXT);
+            } else {
+                DrawText_Line(80, 150, "NO HOST REPLY", 1, COLOR_SELECT);
             }
 
             // Release semaphore
@@ -407,18 +651,23 @@ void Compass_App(void) {
     uint8_t raw[6];
     char location_header[LOCATION_BUF_SIZE];
     uint32_t location_timer = 0;
+    link_request_t location_req;        // Location request in flight while the needle keeps turning
+    bool location_pending = false;
 
     // Wait on semaphore
     RTOS_WaitSemaphore(&sem_Display);
 
     // Clear screen
-    ST7789_DrawRectangle(0, 0, MAX_SCREEN_X, MAX_SCREEN_Y, COLOR_BG);
+    comp_rect(0, 0, MAX_SCREEN_X, MAX_SCREEN_Y, COLOR_BG);
 
     // Display app title
-    display_setCursor(80, 260);
-    display_setTextColor(COLOR_TEXT);
-    char *title = "COMPASS";
-    while(*title) display_print(*title++);
+    comp_text(80, 260, "COMPASS", 1, COLOR_TEXT);
+    comp_flush();
+
+    // Dial and widgets for this visit
+    DrawCompass_Dial();
+    widget_needle_init(&compass_needle, COMPASS_CENTER_X, COMPASS_CENTER_Y, COLOR_NEEDLE, COLOR_BG);
+    widget_label_init(&compass_location, 10, 50, 1, 36, COLOR_TEXT, COLOR_BG);
     RTOS_SignalSemaphore(&sem_Display);
 
     // Draw initial compass (needle facing 0)
@@ -448,8 +697,8 @@ void Compass_App(void) {
     BMI160_MagManualWrite(active_addr, MAGNETOMETER_POWER_REGISTER, MAGNETOMETER_POWER_ENABLE);
     SysCtlDelay(100000);
 
-    // Set normal mode operation
-    BMI160_MagManualWrite(active_addr, MAGNETOMETER_OPERATIONAL_MODE, MAGNETOMETER_NORMAL_OPERATION);
+    // Set normal mode operation at the highest output data rate
+    BMI160_MagManualWrite(active_addr, MAGNETOMETER_OPERATIONAL_MODE, MAGNETOMETER_NORMAL_OPERATION | MAGNETOMETER_ODR_30HZ);
     SysCtlDelay(100000);
 
     // Set X and Y repetitions to 9
@@ -488,55 +737,58 @@ void Compass_App(void) {
             int16_t y = (int16_t)((raw[3] << 8) | raw[2]);
             // Z byte is ommitted and not needed
 
-            // As long as X and Y are nonzero, convert result to radians
+            // As long as X and Y are nonzero, convert result to a heading
             if (x != 0 || y != 0) {
 
-                // Convert result to radians
-                double heading_deg = atan2((double)y, (double)x) * (180.0 / M_PI);
-
-                // Convert negative headings to positive
-                if (heading_deg < 0.0) heading_deg += 360.0;
+                // CORDIC heading, integer shifts and adds instead of soft float atan2
+                uint16_t heading = heading_atan2(y, x);
 
                 // Draw compass
-                DrawCompass(heading_deg);
+                DrawCompass(heading);
             }
         }
 
         // Release Semaphore
         RTOS_SignalSemaphore(&sem_I2C);
 
-        // Update location every 20 cycles
-        if (location_timer++ > 20) {
+        // Update location every 2 seconds, the request is only queued so sampling goes on meanwhile
+        if (location_timer++ > COMPASS_LOCATION_SAMPLES && !location_pending) {
 
             // Reset timer
             location_timer = 0;
+            location_pending = link_submit(&location_req, 'C', NULL, 0, (uint8_t *)location_header,
+                                           LOCATION_BUF_SIZE - 1, HOST_REPLY_TIMEOUT_MS);
+        }
 
-            // Send character to recieve location
-            UARTCharPut(UART_BASE, 'C');
+        // Location reply, the last one stays up if the host does not answer in time
+        if (location_pending && link_poll(&location_req)) {
+            location_pending = false;
+            if (location_req.ok) {
+                location_header[location_req.reply_len] = '\0';
 
-            // Recieve location
-            for (int i = 0; i < LOCATION_BUF_SIZE; i++) {
-                location_header[i] = UARTCharGet(UART_BASE);
-            }
+                // Show how old the host's reading is after it once it is stale, if it fits
+                int32_t age = Host_Reply_Age(location_header);
+                size_t used = strlen(location_header);
+                Host_Stale_Text(age, LOCATION_STALE_S, " (%ldm old)", location_header + used, LOCATION_BUF_SIZE - used);
 
-            // Add null terminator for screen printing
-            location_header[LOCATION_BUF_SIZE - 1] = '\0';
+                // Wait for semaphore
+                RTOS_WaitSemaphore(&sem_Display);
 
-            // Wait for semaphore
-            RTOS_WaitSemaphore(&sem_Display);
-
-            // Display location
-            ST7789_DrawRectangle(10, 40, 220, 20, 0x0000);
-            display_setCursor(10, 50);
-            char *ptr = location_header;
-            while(*ptr) display_print(*ptr++);
+                // Display location (nothing is sent while the location and shown age stay the same)
+                widget_set_text(&compass_location, location_header);
 
-            // Release semaphore
-            RTOS_SignalSemaphore(&sem_Display);
+                // Release semaphore
+                RTOS_SignalSemaphore(&sem_Display);
+            }
         }
 
-        // Small delay for RTOS
-        sleep(100);
+        // Wait for the next magnetometer sample
+        sleep(COMPASS_SAMPLE_MS);
+    }
+
+    // The request and its buffer live on this stack
+    if (location_pending) {
+        link_wait(&location_req);
     }
 }
 
@@ -545,24 +797,31 @@ void Weather_App(void) {
     
     // Local variables
     char weather_buffer[LOCATION_BUF_SIZE];
+    char age_text[40];
     uint32_t weather_timer = 100;
 
     // Wait on semaphore
     RTOS_WaitSemaphore(&sem_Display);
 
     // Reset screen
-    ST7789_DrawRectangle(0, 0, MAX_SCREEN_X, MAX_SCREEN_Y, COLOR_BG);
+    comp_rect(0, 0, MAX_SCREEN_X, MAX_SCREEN_Y, COLOR_BG);
 
     // Display Weather app name
-    display_setCursor(80, 260);
-    display_setTextColor(COLOR_TEXT);
-    char *msg = "WEATHER";
-    while(*msg) display_print(*msg++);
+    comp_text(80, 260, "WEATHER", 1, COLOR_TEXT);
+
+    comp_flush();
+
+    // One widget per field, a refresh only repaints the characters that changed
+    widget_number_init(&weather_temp, 10, 240, 5, 7, COLOR_TEXT, COLOR_BG);
+    widget_label_init(&weather_cond, 10, 190, 2, 19, COLOR_YELLOW, COLOR_BG);
+    widget_label_init(&weather_city, 10, 160, 2, 19, COLOR_CYAN, COLOR_BG);
+    widget_label_init(&weather_country, 10, 140, 2, 19, COLOR_CYAN, COLOR_BG);
+    widget_label_init(&weather_detail, 10, 110, 1, 38, COLOR_TEXT, COLOR_BG);
+    widget_label_init(&weather_loading, 80, 100, 1, 10, COLOR_TEXT, COLOR_BG);
+    widget_label_init(&weather_age, 10, 85, 1, 23, COLOR_TEXT, COLOR_BG);
 
     // Add loading screen for weather app (and debug)
-    display_setCursor(80, 100);
-    char *load = "Loading...";
-    while(*load) display_print(*load++);
+    widget_set_text(&weather_loading, "Loading...");
     RTOS_SignalSemaphore(&sem_Display);
 
     // Ensure weather data is not being sent outside of the app
@@ -574,16 +833,15 @@ void Weather_App(void) {
             // Reset timer
             weather_timer = 0;
 
-            // Signal for weather transmission
-            UARTCharPut(UART_BASE, 'W');
-
-            // Recieve weather data
-            for(int i = 0; i < LOCATION_BUF_SIZE; i++) {
-                weather_buffer[i] = UARTCharGet(UART_BASE);
+            // Request weather, the last reading stays up if the host does not answer in time
+            // (the next pass only sleeps, the timer was just reset)
+            if (!Host_Request('W', weather_buffer, LOCATION_BUF_SIZE)) {
+                continue;
             }
 
-            // Add null terminator for proper C style character arrays
-            weather_buffer[LOCATION_BUF_SIZE - 1] = '\0';
+            // Age of the host's cached reading, cut off before parsing and only shown once stale
+            bool stale = Host_Stale_Text(Host_Reply_Age(weather_buffer), WEATHER_STALE_S, "updated %ld min ago",
+                                         age_text, sizeof(age_text));
 
             // Reset pointers
             char *city = weather_buffer;
@@ -642,57 +900,28 @@ void Weather_App(void) {
             // Wait on semaphore
             RTOS_WaitSemaphore(&sem_Display);
 
-            // Clear screen
-            ST7789_DrawRectangle(0, 20, 240, 220, COLOR_BG);
-
-            // Use Transparent Text
+            // Fields that did not change since the last reading send nothing
 
             // Output Temperature
-            display_setCursor(10, 240);
-            display_setTextSize(5);
-            display_setTextColor(COLOR_TEXT);
-            char *ptr = temp;
-            while(ptr && *ptr) {
-                display_print(*ptr++);
-            }
+            widget_set_text(&weather_temp, temp);
 
             // Output Condition
-            display_setCursor(10, 190);
-            display_setTextSize(2);
-            display_setTextColor(COLOR_YELLOW);
-            ptr = cond;
-            while(ptr && *ptr) {
-                display_print(*ptr++);
-            }
+            widget_set_text(&weather_cond, cond);
 
             // Output City
-            display_setCursor(10, 160);
-            display_setTextSize(2);
-            display_setTextColor(COLOR_CYAN);
-            ptr = city;
-            while(ptr && *ptr){ 
-                display_print(*ptr++);
-            }
+            widget_set_text(&weather_city, city);
 
-            // Output Country (if country provided)
-            if (country) {
-                display_setCursor(10, 140);
-                display_setTextSize(2);
-                display_setTextColor(COLOR_CYAN);
-                ptr = country;
-                while(ptr && *ptr) {
-                    display_print(*ptr++);
-                }
-            }
+            // Output Country (cleared if no country provided)
+            widget_set_text(&weather_country, country);
 
             // Output Details
-            display_setCursor(10, 110);
-            display_setTextSize(1);
-            display_setTextColor(COLOR_TEXT);
-            ptr = detail;
-            while(ptr && *ptr) {
-                display_print(*ptr++);
-            }
+            widget_set_text(&weather_detail, detail);
+
+            // Output data age (cleared while the reading is fresh)
+            widget_set_text(&weather_age, stale ? age_text : NULL);
+
+            // Clear loading message
+            widget_set_text(&weather_loading, NULL);
 
             // Release semaphore
             RTOS_SignalSemaphore(&sem_Display);
@@ -711,8 +940,6 @@ void Frogger_App(void) {
     // Calculate frog positions
     float frog_x = (GAME_WIDTH / 2) - (GRID_SIZE / 2);
     float frog_y = (NUM_LANES - 1) * GRID_SIZE;
-    float prev_frog_x = frog_x;
-    float prev_frog_y = frog_y;
     int move_cooldown = 0; // Reset timer
 
     // Loop through entities and set all of them as inactive
@@ -727,15 +954,16 @@ void Frogger_App(void) {
     RTOS_WaitSemaphore(&sem_Display);
 
     // Draw Grass
-    ST7789_DrawRectangle(0, GAME_HEIGHT, GAME_WIDTH, MAX_SCREEN_Y - GAME_HEIGHT, COLOR_GRASS);
+    comp_rect(0, GAME_HEIGHT, GAME_WIDTH, MAX_SCREEN_Y - GAME_HEIGHT, COLOR_GRASS);
+    comp_flush();
 
-    // Draw lanes according to specifications in defines
-    for(uint8_t i = 0; i < NUM_LANES; i++) {
-        ST7789_DrawRectangle(0, i * GRID_SIZE, GAME_WIDTH, GRID_SIZE, LANE_COLORS[i]);
-    }
+    // Draw lanes according to specifications in defines (lanes are composited one line buffer at a time)
+    sprite_init(LANE_COLORS, NUM_LANES, GRID_SIZE, GAME_WIDTH);
 
     // Draw frog
-    ST7789_DrawRectangle((int16_t)frog_x + FROG_OFFSET, (int16_t)frog_y + FROG_OFFSET, FROG_DRAW_SIZE, FROG_DRAW_SIZE, COLOR_GREEN);
+    sprite_begin_frame();
+    sprite_add(FROG_SPRITE_ID, (int16_t)frog_x + FROG_OFFSET, (int16_t)frog_y + FROG_OFFSET, FROG_DRAW_SIZE, FROG_DRAW_SIZE, COLOR_GREEN);
+    sprite_end_frame();
 
     // Release semaphore
     RTOS_SignalSemaphore(&sem_Display);
@@ -806,8 +1034,6 @@ void Frogger_App(void) {
                     e->x = - (float)e->width_pixels;
                 }
 
-                // Update positions
-                e->prev_x = e->x;
             }
         }
 
@@ -825,33 +1051,17 @@ void Frogger_App(void) {
                 continue;
             }
 
-            int16_t old_x = (int16_t)e->prev_x; // Read previous position
-            e->x += e->speed;                   // Update position based on speed
-            int16_t new_x = (int16_t)e->x;      // Set new position
+            // Update position based on speed
+            e->x += e->speed;
 
-            // If entity exits screen, set it to inactive
+            // If entity exits screen, set it to inactive (the sprite renderer erases it)
             if (e->speed > 0 && e->x > GAME_WIDTH) {
                 e->active = false;
             } else if (e->speed < 0 && (e->x + e->width_pixels) < 0) {
                 e->active = false;
             }
-
-            // Redraw objects, only the amount that they changed, not redrawing the entire object
-            if (e->active) {
-                if (abs(new_x - old_x) >= 1) {
-                    ST7789_DrawRectangle(old_x, e->y, e->width_pixels, GRID_SIZE, LANE_COLORS[e->y / GRID_SIZE]);
-                    ST7789_DrawRectangle(new_x, e->y, e->width_pixels, GRID_SIZE, e->color);
-                    e->prev_x = e->x;
-                }
-            } else {
-                ST7789_DrawRectangle(old_x, e->y, e->width_pixels, GRID_SIZE, LANE_COLORS[e->y / GRID_SIZE]);
-            }
         }
 
-        // Update position
-        prev_frog_x = frog_x;
-        prev_frog_y = frog_y;
-
         // Read joystick
         uint32_t joy = JOYSTICK_GetXY();
         int16_t jx = (int16_t)((joy >> 16) & 0xFFFF);
@@ -958,7 +1168,8 @@ void Frogger_App(void) {
         if (frog_died) {
 
             // Signal frog death
-            ST7789_DrawRectangle(0, 0, 240, 240, COLOR_RED);
+            comp_rect(0, 0, 240, 240, COLOR_RED);
+            comp_flush();
 
             // Release RTOS when game is over to check other conditions, user does not need to play again IMMEDIATLEY
             sleep(200);
@@ -967,17 +1178,16 @@ void Frogger_App(void) {
             frog_x = (GAME_WIDTH / 2) - (GRID_SIZE / 2);
             frog_y = (NUM_LANES - 1) * GRID_SIZE;
 
-            // Redraw lanes
-            for(uint8_t i = 0; i < NUM_LANES; i++) {
-                ST7789_DrawRectangle(0, i * GRID_SIZE, GAME_WIDTH, GRID_SIZE, LANE_COLORS[i]);
-            }
-
-            ST7789_DrawRectangle(0, GAME_HEIGHT, GAME_WIDTH, MAX_SCREEN_Y - GAME_HEIGHT, COLOR_GRASS);
+            // Redraw lanes (the flash covered every lane) and grass
+            sprite_invalidate();
+            comp_rect(0, GAME_HEIGHT, GAME_WIDTH, MAX_SCREEN_Y - GAME_HEIGHT, COLOR_GRASS);
+            comp_flush();
         }
         else if (frog_y == 0) {
 
             // Signal victory
-            ST7789_DrawRectangle(0, 0, 240, 240, COLOR_TEXT);
+            comp_rect(0, 0, 240, 240, COLOR_TEXT);
+            comp_flush();
 
             // Release RTOS when game is over to check other conditions, user does not need to play again IMMEDIATLEY
             sleep(200);
@@ -986,22 +1196,24 @@ void Frogger_App(void) {
             frog_x = (GAME_WIDTH / 2) - (GRID_SIZE / 2);
             frog_y = (NUM_LANES - 1) * GRID_SIZE;
 
-            // Redraw lanes
-            for(uint8_t i = 0; i < NUM_LANES; i++) {
-                ST7789_DrawRectangle(0, i * GRID_SIZE, GAME_WIDTH, GRID_SIZE, LANE_COLORS[i]);
-            }
-
-            ST7789_DrawRectangle(0, GAME_HEIGHT, GAME_WIDTH, MAX_SCREEN_Y - GAME_HEIGHT, COLOR_GRASS);
+            // Redraw lanes (the flash covered every lane) and grass
+            sprite_invalidate();
+            comp_rect(0, GAME_HEIGHT, GAME_WIDTH, MAX_SCREEN_Y - GAME_HEIGHT, COLOR_GRASS);
+            comp_flush();
         }
-        else {
 
-            // Redraw frog with change in position
-            if (abs((int)frog_x - (int)prev_frog_x) > 0 || abs((int)frog_y - (int)prev_frog_y) > 0) {
-                ST7789_DrawRectangle((int16_t)prev_frog_x, (int16_t)prev_frog_y, GRID_SIZE, GRID_SIZE, LANE_COLORS[(int)(prev_frog_y/GRID_SIZE)]);
+        // Build the frame, logs and cars first, then the frog on top
+        sprite_begin_frame();
+        for (int i = 0; i < MAX_ENTITIES; i++) {
+            volatile Entity_t *e = &frogger_entities[i];
+            if (e->active) {
+                sprite_add(i, (int16_t)e->x, e->y, e->width_pixels, GRID_SIZE, e->color);
             }
-
-            ST7789_DrawRectangle((int16_t)frog_x + FROG_OFFSET, (int16_t)frog_y + FROG_OFFSET, FROG_DRAW_SIZE, FROG_DRAW_SIZE, COLOR_GREEN);
         }
+        sprite_add(FROG_SPRITE_ID, (int16_t)frog_x + FROG_OFFSET, (int16_t)frog_y + FROG_OFFSET, FROG_DRAW_SIZE, FROG_DRAW_SIZE, COLOR_GREEN);
+
+        // Each lane is composited in a line buffer, only the columns that changed are sent
+        sprite_end_frame();
 
         // Release semaphore
         RTOS_SignalSemaphore(&sem_Display);
@@ -1024,11 +1236,18 @@ void Home_Thread(void) {
     char time_buffer[LOCATION_BUF_SIZE];
     uint32_t time_timer = 50;
 
+    // The unlock arrives on the transport thread, whatever this thread is waiting on
+    link_listen(Host_Frame);
+
     // Wait for semaphore
     RTOS_WaitSemaphore(&sem_Display);
 
     // Clear screen
-    ST7789_DrawRectangle(0, 0, MAX_SCREEN_X, MAX_SCREEN_Y, 0x0000);
+    comp_rect(0, 0, MAX_SCREEN_X, MAX_SCREEN_Y, COLOR_BG);
+    comp_flush();
+
+    // Time readout, right aligned so the minutes and AM/PM stay in the same cells
+    widget_number_init(&lock_time, 30, 100, 4, 8, COLOR_TEXT, COLOR_BG);
 
     // Release semaphore
     RTOS_SignalSemaphore(&sem_Display);
@@ -1042,33 +1261,17 @@ void Home_Thread(void) {
             // Reset timer
             time_timer = 0;
 
-            // Signal to recieve time
-            UARTCharPut(UART_BASE, 'T');
+            // Request time, the shown time stays if the host does not answer in time
+            if (Host_Request('T', time_buffer, LOCATION_BUF_SIZE)) {
 
-            // Recieve time
-            for(int i = 0; i < LOCATION_BUF_SIZE; i++) {
-                time_buffer[i] = UARTCharGet(UART_BASE);
-            }
-
-            // Add null terminator for proper C character array
-            time_buffer[LOCATION_BUF_SIZE - 1] = '\0';
+                // Wait for semaphore
+                RTOS_WaitSemaphore(&sem_Display);
 
-            // Wait for semaphore
-            RTOS_WaitSemaphore(&sem_Display);
-
-            // Clear area again (sanity check)
-            ST7789_DrawRectangle(0, 60, 240, 60, 0x0000);
-
-            // Draw Time (Y=100) -> Draws up to 72 (Size 4)
-            // Safe within 60-120
-
-            // Display time
-            display_setCursor(30, 100);
-            display_setTextColor(COLOR_TEXT); // Transparent Text
-            display_setTextSize(4);
-            char *t = time_buffer;
-            while(*t) display_print(*t++);
-            RTOS_SignalSemaphore(&sem_Display);
+                // Draw Time (Y=100) -> Draws down to 69 (Size 4)
+                // Only the digits that changed are sent, most refreshes send nothing
+                widget_set_text(&lock_time, time_buffer);
+                RTOS_SignalSemaphore(&sem_Display);
+            }
         }
 
         // Lock Screen Messages
@@ -1078,30 +1281,19 @@ void Home_Thread(void) {
             RTOS_WaitSemaphore(&sem_Display);
 
             // Clear Lower Area: Y=140 to 220
-            ST7789_DrawRectangle(0, 140, 240, 80, 0x0000);
+            comp_rect(0, 140, 240, 80, COLOR_BG);
 
             // Display Lockscreen Text
 
-            // Text Y=180 (Draws up to 164)
-            display_setCursor(40, 180);
-            display_setTextColor(COLOR_TEXT); // Transparent Text
-            display_setTextSize(2);
-            char *l1 = "PHONE LOCKED!";
-            while(*l1) display_print(*l1++);
+            // Text Y=180 (Draws down to 165)
+            comp_text(40, 180, "PHONE LOCKED!", 2, COLOR_TEXT);
 
             // Text Y=210
-            display_setCursor(20, 210);
-            display_setTextSize(1);
-            char *l2 = "Show face to camera to unlock";
-            while(*l2) display_print(*l2++);
+            comp_text(20, 210, "Show face to camera to unlock", 1, COLOR_TEXT);
+            comp_flush();
             RTOS_SignalSemaphore(&sem_Display);
         }
 
-        // Recieve unlocked status
-        if (UARTCharsAvail(UART_BASE)) {
-            char c = UARTCharGet(UART_BASE);
-            if (c == 'U') is_unlocked = true;
-        }
 
         // Release RTOS
         sleep(50);
@@ -1190,7 +1382,9 @@ void Read_Buttons(void) {
     // Local variable for button state
     uint8_t buttons;
     uint8_t prev_buttons = 0;
+    uint32_t snap_pressed = 0;      // perf_now when BTN1 went down in the camera app
 
+    perf_init();
     while(1) {
 
         // Wait for aperiodic signal
@@ -1216,10 +1410,31 @@ void Read_Buttons(void) {
 
             }
 
-            // Button 1 also used for camera
+            // Button 1 also used for camera, it acts on release once the hold time is known
             else if (current_app == APP_CAMERA) {
+                snap_pressed = perf_now();
+            }
+        }
+
+        // A short press snaps a photo, a long one picks the next photo format
+        if (!(buttons & BUTTON_SELECT_MASK) && (prev_buttons & BUTTON_SELECT_MASK) && current_app == APP_CAMERA &&
+            snap_pressed != 0) {
+            if ((uint32_t)(perf_now() - snap_pressed) >= CAMERA_LONG_PRESS_MS * PERF_TICKS_PER_MS) {
+                photo_mode_flag = true;
+            } else {
                 take_photo_flag = true;
             }
+            snap_pressed = 0;
+        }
+
+        // Button 3 zooms into the last photo in the camera app
+        if ((buttons & BUTTON_ZOOM_MASK) && !(prev_buttons & BUTTON_ZOOM_MASK) && current_app == APP_CAMERA) {
+            zoom_flag = true;
+        }
+
+        // Button 2 toggles video in the camera app
+        if ((buttons & BUTTON_VIDEO_MASK) && !(prev_buttons & BUTTON_VIDEO_MASK) && current_app == APP_CAMERA) {
+            video_flag = !video_flag;
         }
 
         // Button 4 for returning home
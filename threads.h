@@ -49,6 +49,7 @@ semaphore_t sem_Camera;
 void Idle_Thread(void);
 
 void DrawHomeScreen(void);
+void Camera_Video(void);
 void Camera_App(void);
 void Compass_App(void);
 void Weather_App(void);
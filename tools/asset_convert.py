@@ -0,0 +1,275 @@
+# File: asset_convert.py
+# Author: Davis Lester
+# Last Edited: 10/16/2026
+# Description: Converts icons into asset headers that are already in ST7789 byte order and row direction
+
+# Usage:
+#   python tools/asset_convert.py Camera.h Compass.h Weather.h Frogger.h
+#   python tools/asset_convert.py --encoding rle --name Camera camera.png
+#   python tools/asset_convert.py --placeholder --out-dir build Camera Compass
+#
+# Inputs can be images (anything OpenCV reads) or the old little endian bitmap headers.
+# Each input produces <Name>_asset.h next to it (or in --out-dir), see asset.h for the format.
+
+# ***************** Includes *****************
+
+import argparse
+import os
+import re
+import sys
+
+# ***************** CONFIGURATION *****************
+
+# Encodings (must match asset.h)
+ASSET_RAW = 0
+ASSET_RLE = 1
+ASSET_PAL_RLE = 2
+
+ENCODING_NAMES = {ASSET_RAW: "ASSET_RAW", ASSET_RLE: "ASSET_RLE", ASSET_PAL_RLE: "ASSET_PAL_RLE"}
+
+# Placeholder icons (host builds without the bitmap sources)
+PLACEHOLDER_SIZE = 80
+PLACEHOLDER_FILL = 0x31A6
+PLACEHOLDER_FRAME = 0xFFFF
+PLACEHOLDER_BORDER = 3
+
+# Packet header bits (must match asset.h)
+PACKET_RUN = 0x80
+PACKET_MAX = 128       # Pixels per packet
+PALETTE_MAX = 256      # Palette indices are one byte
+
+BYTES_PER_LINE = 16    # Formatting of the generated array
+
+# ********************************** LOADERS **********************************
+
+def load_legacy_header(path):
+    """Reads an old bitmap header (little endian byte pairs, top row first) into a list of rows"""
+    with open(path, "r") as f:
+        text = f.read()
+
+    # Width and height defines, e.g. '#define Camera_PHOTO_WIDTH 80'
+    width = re.search(r"#define\s+(\w+)_PHOTO_WIDTH\s+(\d+)", text)
+    height = re.search(r"#define\s+\w+_PHOTO_HEIGHT\s+(\d+)", text)
+    if not width or not height:
+        raise ValueError(f"{path}: missing _PHOTO_WIDTH/_PHOTO_HEIGHT defines")
+    name, w, h = width.group(1), int(width.group(2)), int(height.group(1))
+
+    # Array contents
+    body = text[text.index("{") + 1:text.rindex("}")]
+    values = [int(v, 0) for v in re.findall(r"0[xX][0-9a-fA-F]+|\d+", body)]
+    if len(values) < w * h * 2:
+        raise ValueError(f"{path}: expected {w * h * 2} bytes, found {len(values)}")
+
+    # Combine little endian pairs
+    pixels = [values[i] | (values[i + 1] << 8) for i in range(0, w * h * 2, 2)]
+    rows = [pixels[r * w:(r + 1) * w] for r in range(h)]
+    return name, w, h, rows
+
+def load_image(path, width=None, height=None):
+    """Reads an image (top row first) into a list of RGB565 rows"""
+    import cv2  # Only needed for image inputs
+
+    frame = cv2.imread(path, cv2.IMREAD_COLOR)
+    if frame is None:
+        raise ValueError(f"{path}: could not read image")
+    if width and height:
+        frame = cv2.resize(frame, (width, height), interpolation=cv2.INTER_AREA)
+
+    h, w = frame.shape[:2]
+    rows = []
+    for y in range(h):
+        row = []
+        for x in range(w):
+            b, g, r = (int(c) for c in frame[y, x])
+            row.append(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3))
+        rows.append(row)
+    return w, h, rows
+
+def load_placeholder(width=None, height=None):
+    """Builds a framed icon so the host simulator can run without the bitmap sources"""
+    w = width or PLACEHOLDER_SIZE
+    h = height or PLACEHOLDER_SIZE
+    rows = []
+    for y in range(h):
+        edge_y = y < PLACEHOLDER_BORDER or y >= h - PLACEHOLDER_BORDER
+        rows.append([PLACEHOLDER_FRAME if edge_y or x < PLACEHOLDER_BORDER or x >= w - PLACEHOLDER_BORDER
+                     else PLACEHOLDER_FILL for x in range(w)])
+    return w, h, rows
+
+# ********************************** ENCODERS **********************************
+
+def panel_order(rows):
+    """Sources are top row first, the panel window fills from the lowest Y so the rows are reversed"""
+    return [p for row in reversed(rows) for p in row]
+
+def encode_packets(symbols, write_symbol):
+    """Packs symbols into run / literal packets (see asset.h)"""
+    out = bytearray()
+    i = 0
+    n = len(symbols)
+    while i < n:
+
+        # Measure the run starting here
+        run = 1
+        while i + run < n and run < PACKET_MAX and symbols[i + run] == symbols[i]:
+            run += 1
+
+        # Runs of 2 or more are always at least as small as literals
+        if run >= 2:
+            out.append(PACKET_RUN | (run - 1))
+            write_symbol(out, symbols[i])
+            i += run
+            continue
+
+        # Collect literals until the next run of 2 starts
+        start = i
+        i += 1
+        while i < n and i - start < PACKET_MAX and not (i + 1 < n and symbols[i] == symbols[i + 1]):
+            i += 1
+        out.append(i - start - 1)
+        for s in symbols[start:i]:
+            write_symbol(out, s)
+    return out
+
+def write_pixel(out, pixel):
+    """Big endian pixel (panel order)"""
+    out.append(pixel >> 8)
+    out.append(pixel & 0xFF)
+
+def write_index(out, index):
+    """One byte palette index"""
+    out.append(index)
+
+def encode(pixels, encoding):
+    """Returns (data, palette) for the requested encoding, palette is None unless paletted"""
+    if encoding == ASSET_RAW:
+        out = bytearray()
+        for p in pixels:
+            write_pixel(out, p)
+        return out, None
+
+    if encoding == ASSET_RLE:
+        return encode_packets(pixels, write_pixel), None
+
+    # Palette, most common colors first
+    counts = {}
+    for p in pixels:
+        counts[p] = counts.get(p, 0) + 1
+    if len(counts) > PALETTE_MAX:
+        return None, None
+    palette = sorted(counts, key=lambda c: -counts[c])
+    lookup = {c: i for i, c in enumerate(palette)}
+    return encode_packets([lookup[p] for p in pixels], write_index), palette
+
+def encoded_size(data, palette):
+    """Flash footprint of an encoding"""
+    return len(data) + (2 * len(palette) if palette else 0)
+
+# ********************************** OUTPUT **********************************
+
+def format_array(values, fmt):
+    """Formats array contents for the generated header"""
+    lines = []
+    for i in range(0, len(values), BYTES_PER_LINE):
+        lines.append("    " + ", ".join(fmt.format(v) for v in values[i:i + BYTES_PER_LINE]) + ",")
+    return "\n".join(lines)
+
+def write_header(path, name, source, w, h, encoding, data, palette):
+    """Writes <Name>_asset.h"""
+    guard = f"{name.upper()}_ASSET_H_"
+    out = []
+    out.append(f"// File: {os.path.basename(path)}")
+    out.append(f"// Generated by tools/asset_convert.py from {os.path.basename(source)}, do not edit")
+    out.append(f"// {w}x{h}, {ENCODING_NAMES[encoding]}, {encoded_size(data, palette)} bytes (raw: {w * h * 2})")
+    out.append("")
+    out.append(f"#ifndef {guard}")
+    out.append(f"#define {guard}")
+    out.append("")
+    out.append('#include "asset.h"')
+    out.append("")
+    out.append(f"#define {name}_ASSET_WIDTH {w}")
+    out.append(f"#define {name}_ASSET_HEIGHT {h}")
+    out.append("")
+    if palette:
+        out.append(f"static const uint16_t {name}_palette[{len(palette)}] = {{")
+        out.append(format_array(palette, "0x{:04X}"))
+        out.append("};")
+        out.append("")
+    out.append(f"static const uint8_t {name}_data[{len(data)}] = {{")
+    out.append(format_array(list(data), "0x{:02X}"))
+    out.append("};")
+    out.append("")
+    out.append(f"static const asset_t {name}_asset = {{")
+    out.append(f"    {w}, {h}, {ENCODING_NAMES[encoding]},")
+    out.append(f"    {name + '_palette' if palette else 'NULL'},")
+    out.append(f"    {name}_data, sizeof({name}_data)")
+    out.append("};")
+    out.append("")
+    out.append(f"#endif /* {guard} */")
+    out.append("")
+    with open(path, "w") as f:
+        f.write("\n".join(out))
+
+# ********************************** MAIN **********************************
+
+def convert(source, name, encoding, out_dir, width=None, height=None, placeholder=False):
+    """Converts one input and returns (name, raw size, encoded size, encoding)"""
+    if placeholder:
+        w, h, rows = load_placeholder(width, height)
+        name = name or source
+    elif source.endswith(".h"):
+        legacy_name, w, h, rows = load_legacy_header(source)
+        name = name or legacy_name
+    else:
+        w, h, rows = load_image(source, width, height)
+        name = name or os.path.splitext(os.path.basename(source))[0].capitalize()
+
+    pixels = panel_order(rows)
+
+    # Pick the smallest encoding unless one was requested
+    candidates = [encoding] if encoding is not None else [ASSET_RAW, ASSET_RLE, ASSET_PAL_RLE]
+    best = None
+    for enc in candidates:
+        data, palette = encode(pixels, enc)
+        if data is None:
+            continue
+        if best is None or encoded_size(data, palette) < encoded_size(best[1], best[2]):
+            best = (enc, data, palette)
+    if best is None:
+        raise ValueError(f"{source}: too many colors for a palette, use --encoding rle")
+
+    enc, data, palette = best
+    path = os.path.join(out_dir or os.path.dirname(source) or ".", f"{name}_asset.h")
+    write_header(path, name, source, w, h, enc, data, palette)
+    return name, w * h * 2, encoded_size(data, palette), enc
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert icons into ST7789 asset headers")
+    parser.add_argument("inputs", nargs="+", help="images or old bitmap headers")
+    parser.add_argument("--encoding", choices=["auto", "raw", "rle", "palette"], default="auto")
+    parser.add_argument("--name", help="asset name (single input only)")
+    parser.add_argument("--size", help="resize images to WxH, e.g. 80x80")
+    parser.add_argument("--out-dir", help="directory for the generated headers")
+    parser.add_argument("--placeholder", action="store_true",
+                        help="inputs are asset names, write framed placeholder icons instead")
+    args = parser.parse_args()
+
+    if args.name and len(args.inputs) > 1:
+        parser.error("--name only works with a single input")
+
+    encoding = {"auto": None, "raw": ASSET_RAW, "rle": ASSET_RLE, "palette": ASSET_PAL_RLE}[args.encoding]
+    width = height = None
+    if args.size:
+        width, height = (int(v) for v in args.size.lower().split("x"))
+
+    for source in args.inputs:
+        try:
+            name, raw, size, enc = convert(source, args.name, encoding, args.out_dir, width, height,
+                                             args.placeholder)
+        except (OSError, ValueError) as e:
+            print(f"Error: {e}")
+            sys.exit(1)
+        print(f"{name}: {ENCODING_NAMES[enc]}, {size} bytes ({100.0 * size / raw:.1f}% of raw {raw})")
+
+if __name__ == "__main__":
+    main()
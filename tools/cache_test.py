@@ -0,0 +1,181 @@
+# File: cache_test.py
+# Author: Davis Lester
+# Last Edited: 10/16/2026
+# Description: Offline check of tools/host_cache.py, a local HTTP server stands in for wttr.in and
+#              ip-api.com (keep alive, a set delay per reply, and modes that fail or stall) while the cache
+#              refreshes against it, checks the replies, their age, connection reuse and stale serving
+
+# Usage:
+#   python tools/cache_test.py [--delay-ms 80] [--ttl 1.0]
+#
+# Prints the time a request took with a fetch per request (the old Camera.py) and from the cache, then one
+# line per check. Exits 1 if a check fails.
+
+# ***************** Includes *****************
+
+import argparse
+import json
+import sys
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+import requests
+
+import host_cache
+
+# ***************** CONFIGURATION *****************
+
+WEATHER_REPLY = "Austin, Texas, United States|Sunny|+75°F|40%|↑5mph"
+WEATHER_TEXT = "Austin, TX, United States\n75F\nSunny\nHum:40% Wind:5mph"
+LOCATION_REPLY = {"status": "success", "lat": 30.27, "lon": -97.74}
+LOCATION_TEXT = "Lat: 30.27, Lon: -97.74"
+FALLBACK = "Offline"
+GETS = 1000             # Cache reads timed per check
+
+# ********************************** STUB SERVER **********************************
+
+class Stub:
+    """What the stub server answers and what it has seen"""
+    def __init__(self, delay):
+        self.delay = delay
+        self.mode = 'ok'        # 'ok', 'fail' (HTTP 500) or 'stall' (longer than host_cache.HTTP_TIMEOUT_S)
+        self.requests = 0
+        self.connections = 0
+        self.lock = threading.Lock()
+
+def handler(stub):
+    class Handler(BaseHTTPRequestHandler):
+        protocol_version = 'HTTP/1.1'     # Keep alive, as wttr.in and ip-api.com do
+
+        def setup(self):
+            super().setup()
+            with stub.lock:
+                stub.connections += 1
+
+        def do_GET(self):
+            with stub.lock:
+                stub.requests += 1
+            time.sleep(stub.delay)
+            if stub.mode == 'stall':
+                time.sleep(host_cache.HTTP_TIMEOUT_S + 1)
+            if stub.mode == 'fail':
+                body, status, kind = b"Internal Server Error", 500, 'text/plain'
+            elif self.path.startswith('/json'):
+                body, status, kind = json.dumps(LOCATION_REPLY).encode(), 200, 'application/json'
+            else:
+                body, status, kind = WEATHER_REPLY.encode('utf-8'), 200, 'text/plain; charset=utf-8'
+            self.send_response(status)
+            self.send_header('Content-Type', kind)
+            self.send_header('Content-Length', str(len(body)))
+            self.end_headers()
+            self.wfile.write(body)
+
+        def log_message(self, *args):
+            pass
+    return Handler
+
+# ********************************** HELPERS **********************************
+
+def get_ms(cache, key):
+    """Slowest of GETS cache reads in ms"""
+    worst = 0.0
+    for _ in range(GETS):
+        start = time.perf_counter()
+        cache.get(key)
+        worst = max(worst, time.perf_counter() - start)
+    return worst * 1000
+
+def uncached_ms(fetch):
+    """One request the way Camera.py served it before the cache, a new connection and a fetch"""
+    start = time.perf_counter()
+    with requests.Session() as session:
+        fetch(session)
+    return (time.perf_counter() - start) * 1000
+
+def wait_for(condition, timeout):
+    end = time.monotonic() + timeout
+    while time.monotonic() < end:
+        if condition():
+            return True
+        time.sleep(0.01)
+    return False
+
+# ********************************** MAIN **********************************
+
+def main():
+    parser = argparse.ArgumentParser(description="Response cache against a local stub of the web APIs")
+    parser.add_argument("--delay-ms", type=float, default=80, help="stub server delay per reply")
+    parser.add_argument("--ttl", type=float, default=1.0, help="cache TTL in seconds for the test")
+    args = parser.parse_args()
+
+    stub = Stub(args.delay_ms / 1000)
+    server = ThreadingHTTPServer(('127.0.0.1', 0), handler(stub))
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    base = "http://127.0.0.1:%d" % server.server_address[1]
+    host_cache.WEATHER_URL = base + "/?format=%l|%C|%t|%h|%w"
+    host_cache.LOCATION_URL = base + "/json/"
+    host_cache.RETRY_S = args.ttl / 2
+
+    checks = []
+    def check(name, ok, detail=""):
+        checks.append(ok)
+        print("%-36s %-6s %s" % (name, "ok" if ok else "FAIL", detail))
+
+    cache = host_cache.ResponseCache()
+    cache.add('W', host_cache.fetch_weather, args.ttl, FALLBACK)
+    cache.add('C', host_cache.fetch_location, args.ttl * 4, FALLBACK)
+    check("fallback before the first fetch", cache.get('W') == (FALLBACK, None))
+
+    # Cold start, both entries fetched once
+    cache.start()
+    wait_for(lambda: cache.get('W')[1] is not None and cache.get('C')[1] is not None, 5)
+    check("weather reply", cache.get('W')[0] == WEATHER_TEXT, repr(cache.get('W')[0]))
+    check("location reply", cache.get('C')[0] == LOCATION_TEXT, repr(cache.get('C')[0]))
+
+    # Request latency, fetch per request against the cache
+    before = uncached_ms(host_cache.fetch_weather)
+    after = get_ms(cache, 'W')
+    print("request latency  fetch per request %.1f ms  cache worst of %d %.3f ms" % (before, GETS, after))
+    check("cache read under 1 ms", after < 1.0, "%.3f ms" % after)
+
+    # Refreshes ahead of the TTL over kept alive connections
+    requests_at, connections_at = stub.requests, stub.connections
+    ages = []
+    end = time.monotonic() + args.ttl * 4
+    while time.monotonic() < end:
+        ages.append(cache.get('W')[1])
+        time.sleep(0.05)
+    refreshes = stub.requests - requests_at
+    opened = stub.connections - connections_at
+    check("refreshed ahead of the TTL", max(ages) < args.ttl, "max age %d s, %d fetches" % (max(ages), refreshes))
+    check("connections reused", refreshes >= 3 and opened == 0, "%d fetches, %d new connections" % (refreshes, opened))
+
+    # Web API failing: the last good reply is served with a growing age
+    stub.mode = 'fail'
+    time.sleep(args.ttl * 3)
+    text, age = cache.get('W')
+    fetches, failures, _ = cache.stats('W')
+    check("stale reply while failing", text == WEATHER_TEXT and age >= 2 * args.ttl,
+          "age %s s, %d of %d fetches failed" % (age, failures, fetches))
+
+    # Web API stalling: the refresher waits on it, reads do not
+    stub.mode = 'stall'
+    time.sleep(0.2)
+    stalled = get_ms(cache, 'W')
+    check("cache read under 1 ms while stalled", stalled < 1.0 and cache.get('W')[0] == WEATHER_TEXT,
+          "%.3f ms" % stalled)
+
+    # Recovery, a fresh reply within a retry period once the API answers
+    stub.mode = 'ok'
+    recovered = wait_for(lambda: cache.get('W')[1] is not None and cache.get('W')[1] < 1,
+                         2 * host_cache.HTTP_TIMEOUT_S + host_cache.RETRY_S + 1)
+    check("fresh reply after recovery", recovered, "age %s s" % cache.get('W')[1])
+
+    cache.stop()
+    server.shutdown()
+    print("stub server  %d requests  %d connections" % (stub.requests, stub.connections))
+    sys.exit(0 if all(checks) else 1)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,117 @@
+# File: codec.py
+# Author: Davis Lester
+# Last Edited: 10/16/2026
+# Description: Vectorized encoder for the packed photo format decoded by codec.c, a QOI style mix of runs,
+#              a recently seen color index and small deltas on RGB565 (see codec.h for the byte layout)
+
+# Usage:
+#   import codec
+#   data = codec.encode(rgb565, quant=1)   (rgb565: uint16 array, top row first)
+#
+# quant drops that many low bits of each channel (rounded) before encoding, 0 is lossless.
+# Each op only depends on the previous pixel and on the last pixel with the same hash, both of which
+# are known up front, so ops are chosen for the whole image at once instead of pixel by pixel.
+
+# ***************** Includes *****************
+
+import struct
+
+import numpy as np
+
+# ***************** CONFIGURATION *****************
+
+# Ops (must match codec.h)
+OP_INDEX = 0x00
+OP_DIFF = 0x40
+OP_LUMA = 0x80
+OP_RUN = 0xC0
+OP_RGB = 0xFE
+INDEX_SIZE = 64
+MAX_RUN = 62
+
+# ********************************** HELPER FUNCTIONS **********************************
+
+def split_channels(pixels):
+    """5, 6 and 5 bit channels of RGB565 pixels as signed integers"""
+    p = pixels.astype(np.int32)
+    return p >> 11, (p >> 5) & 0x3F, p & 0x1F
+
+def quantize(pixels, quant):
+    """Rounds away the low quant bits of each channel, clamped so a channel never overflows"""
+    if quant <= 0:
+        return pixels
+    r, g, b = split_channels(pixels)
+    half = 1 << (quant - 1)
+    keep = ~((1 << quant) - 1)
+    r = np.minimum((r + half) & keep, 0x1F & keep)
+    g = np.minimum((g + half) & keep, 0x3F & keep)
+    b = np.minimum((b + half) & keep, 0x1F & keep)
+    return ((r << 11) | (g << 5) | b).astype(np.uint16)
+
+def wrap(delta, bits):
+    """Channel difference wrapped into the signed range of a bits wide channel"""
+    span = 1 << bits
+    return ((delta + span // 2) & (span - 1)) - span // 2
+
+def index_before(pixels, hashes):
+    """Index entry each pixel sees: the last earlier pixel with the same hash, 0 if there is none"""
+    order = np.argsort(hashes, kind='stable')
+    sorted_hash = hashes[order]
+    sorted_px = pixels[order]
+    seen = np.zeros(len(pixels), dtype=np.uint16)
+    same = np.zeros(len(pixels), dtype=bool)
+    same[1:] = sorted_hash[1:] == sorted_hash[:-1]
+    seen[order[1:]] = np.where(same[1:], sorted_px[:-1], 0)
+    return seen
+
+# ********************************** ENCODER **********************************
+
+def encode(rgb565, quant=0):
+    """Encodes an image, returns the length header followed by the ops"""
+    pixels = quantize(np.asarray(rgb565, dtype=np.uint16).ravel(), quant)
+    prev = np.empty_like(pixels)
+    prev[0] = 0
+    prev[1:] = pixels[:-1]
+
+    r, g, b = split_channels(pixels)
+    pr, pg, pb = split_channels(prev)
+    dr = wrap(r - pr, 5)
+    dg = wrap(g - pg, 6)
+    db = wrap(b - pb, 5)
+    half = dg >> 1
+    hashes = (r * 3 + g * 5 + b * 7) & (INDEX_SIZE - 1)
+
+    # Op of each pixel, cheapest first
+    in_run = pixels == prev
+    hit = ~in_run & (index_before(pixels, hashes) == pixels)
+    diff = ~in_run & ~hit & (dr >= -2) & (dr <= 1) & (dg >= -2) & (dg <= 1) & (db >= -2) & (db <= 1)
+    luma = ~in_run & ~hit & ~diff & (dr - half >= -8) & (dr - half <= 7) & (db - half >= -8) & (db - half <= 7)
+    rgb = ~in_run & ~hit & ~diff & ~luma
+
+    # First byte and size of each single pixel op
+    b0 = np.where(hit, OP_INDEX | hashes,
+         np.where(diff, OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2),
+         np.where(luma, OP_LUMA | (dg + 32), OP_RGB)))
+    b1 = np.where(luma, ((dr - half + 8) << 4) | (db - half + 8), pixels >> 8)
+    b2 = pixels & 0xFF
+    size = np.where(luma, 2, np.where(rgb, 3, 1))
+
+    # Runs: the first pixel of each run carries ceil(length / 62) run bytes, the rest carry none
+    edges = np.diff(np.concatenate(([0], in_run.astype(np.int8), [0])))
+    starts = np.flatnonzero(edges == 1)
+    lengths = np.flatnonzero(edges == -1) - starts
+    run_bytes = (lengths + MAX_RUN - 1) // MAX_RUN
+    size[in_run] = 0
+    size[starts] = run_bytes
+
+    # Run bytes are full runs unless overwritten below
+    offset = np.cumsum(size) - size
+    out = np.full(int(size.sum()), OP_RUN | (MAX_RUN - 1), dtype=np.uint8)
+    single = ~in_run
+    out[offset[single]] = b0[single]
+    two = luma | rgb
+    out[offset[two] + 1] = b1[two]
+    out[offset[rgb] + 2] = b2[rgb]
+    out[offset[starts] + run_bytes - 1] = OP_RUN | ((lengths - 1) % MAX_RUN)
+
+    return struct.pack('>I', out.size) + out.tobytes()
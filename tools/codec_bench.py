@@ -0,0 +1,144 @@
+# File: codec_bench.py
+# Author: Davis Lester
+# Last Edited: 10/16/2026
+# Description: Corpus benchmark of the packed photo codec, compression ratio and encode time per image
+#              and quantization level, with the decode time per pixel from host/build/codec_bench
+
+# Usage:
+#   make -C host build/codec_bench
+#   python tools/codec_bench.py [--decoder host/build/codec_bench] [--corpus DIR] [--quant 0 1 2]
+#
+# The built in corpus is synthetic (gradients, a noisy camera like scene, a flat UI screen, noise).
+# --corpus adds real frames: 240x240 raw big endian RGB565 (.565) or uint16 numpy arrays (.npy).
+# Decode times are PERF_UNIT per pixel of the decoder build (ns on the host, cycles on target; the target
+# shows its own cycles per pixel under each photo in the camera app).
+
+# ***************** Includes *****************
+
+import argparse
+import os
+import subprocess
+import sys
+import time
+
+import numpy as np
+
+import codec
+
+# ***************** CONFIGURATION *****************
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+DEFAULT_DECODER = os.path.join(ROOT, "host", "build", "codec_bench")
+DEFAULT_OUT = os.path.join(ROOT, "host", "build", "corpus")
+
+SIZE = 240          # Must match PHOTO_SIZE
+SEED = 565
+
+# ********************************** CORPUS **********************************
+
+def rgb888_to_565(rgb):
+    """Same packing as frame_to_rgb565 in Camera.py, from an (h, w, 3) RGB array"""
+    rgb = np.clip(rgb, 0, 255).astype(np.uint16)
+    return ((rgb[..., 0] & 0xF8) << 8) | ((rgb[..., 1] & 0xFC) << 3) | (rgb[..., 2] >> 3)
+
+def corpus_gradient():
+    y, x = np.mgrid[0:SIZE, 0:SIZE].astype(np.float64)
+    return rgb888_to_565(np.dstack((x * 255 / SIZE, y * 255 / SIZE, np.full_like(x, 128))))
+
+def corpus_scene(rng):
+    """Soft regions of color with fine texture and sensor noise, a synthetic stand in for a webcam frame"""
+    y, x = np.mgrid[0:SIZE, 0:SIZE].astype(np.float64)
+    total = np.full((SIZE, SIZE, 3), 1e-6)
+    weights = np.full((SIZE, SIZE), 1e-6)
+    for _ in range(12):
+        cx, cy = rng.uniform(0, SIZE, 2)
+        radius = rng.uniform(20, 90)
+        weight = np.exp(-((x - cx) ** 2 + (y - cy) ** 2) / (2 * radius ** 2))
+        total += weight[..., None] * rng.uniform(30, 220, 3)
+        weights += weight
+    img = total / weights[..., None]
+    img += 12 * np.sin(x / 3.0 + np.sin(y / 7.0) * 4)[..., None]
+    img += rng.normal(0, 3, img.shape)
+    return rgb888_to_565(img)
+
+def corpus_ui():
+    """Flat background with panels and bars, like the phone's own screens"""
+    img = np.full((SIZE, SIZE), 0x0000, dtype=np.uint16)
+    img[20:100, 20:100] = 0x31A6
+    img[20:100, 140:220] = 0x31A6
+    img[140:220, 20:100] = 0xFFFF
+    img[150:160, 30:210] = 0xF800
+    img[::8, :] = img[::8, :] ^ 0x0841
+    return img
+
+def corpus_noise(rng):
+    return rng.integers(0, 1 << 16, (SIZE, SIZE)).astype(np.uint16)
+
+def load_corpus(directory):
+    """User frames, raw big endian .565 or .npy of uint16"""
+    images = []
+    for name in sorted(os.listdir(directory)):
+        path = os.path.join(directory, name)
+        if name.endswith(".565"):
+            images.append((os.path.splitext(name)[0], np.fromfile(path, dtype=">u2").reshape(-1, SIZE)))
+        elif name.endswith(".npy"):
+            images.append((os.path.splitext(name)[0], np.load(path).astype(np.uint16).reshape(-1, SIZE)))
+    return images
+
+# ********************************** MAIN **********************************
+
+def main():
+    parser = argparse.ArgumentParser(description="Packed photo codec corpus benchmark")
+    parser.add_argument("--decoder", default=DEFAULT_DECODER, help="host/build/codec_bench binary")
+    parser.add_argument("--corpus", help="directory of extra .565 / .npy frames")
+    parser.add_argument("--out", default=DEFAULT_OUT, help="where the encoded corpus is written")
+    parser.add_argument("--quant", type=int, nargs="+", default=[0, 1, 2], help="quantization levels")
+    args = parser.parse_args()
+
+    rng = np.random.default_rng(SEED)
+    images = [("gradient", corpus_gradient()), ("scene", corpus_scene(rng)), ("ui", corpus_ui()),
+              ("noise", corpus_noise(rng))]
+    if args.corpus:
+        images += load_corpus(args.corpus)
+    os.makedirs(args.out, exist_ok=True)
+
+    # Encode everything, the decoder checks against the quantized pixels
+    rows = []
+    files = []
+    for name, img in images:
+        for quant in args.quant:
+            start = time.perf_counter()
+            data = codec.encode(img, quant)
+            encode_ms = (time.perf_counter() - start) * 1000
+            expected = codec.quantize(img.ravel(), quant)
+
+            base = os.path.join(args.out, "%s_q%d" % (name, quant))
+            expected.astype(">u2").tofile(base + ".565")
+            with open(base + ".qz", "wb") as f:
+                f.write(data)
+
+            # Largest change of any channel, in 8 bit steps
+            r0, g0, b0 = codec.split_channels(img.ravel())
+            r1, g1, b1 = codec.split_channels(expected)
+            error = max(np.abs(r1 - r0).max() * 8, np.abs(g1 - g0).max() * 4, np.abs(b1 - b0).max() * 8)
+
+            rows.append([name, quant, img.size * 2, len(data), encode_ms, int(error)])
+            files += [base + ".565", base + ".qz"]
+
+    result = subprocess.run([args.decoder] + files, capture_output=True, text=True)
+    decoded = result.stdout.split("\n")
+    unit = decoded.pop(0).split()[-1] if decoded and decoded[0].startswith("unit") else "ticks"
+
+    print("%-12s %5s %8s %8s %6s %10s %12s %7s  %s" % ("image", "quant", "raw", "packed", "ratio",
+          "encode ms", "decode %s/px" % unit, "max err", "check"))
+    for row, line in zip(rows, decoded):
+        fields = line.split()
+        name, quant, raw, packed, encode_ms, error = row
+        print("%-12s %5d %8d %8d %6.2f %10.1f %12s %7d  %s" % (name, quant, raw, packed, raw / packed,
+              encode_ms, fields[3] if len(fields) > 4 else "-", error, fields[4] if len(fields) > 4 else "-"))
+    if result.returncode != 0:
+        sys.stderr.write(result.stderr)
+        sys.exit(1)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,72 @@
+# File: glyph_atlas.py
+# Author: Davis Lester
+# Last Edited: 10/16/2026
+# Description: Generates glyph_atlas.c, the 5x7 font pre-scaled horizontally for text sizes 1, 2, 4 and 5
+
+# Usage:
+#   python tools/glyph_atlas.py            (reads font5x7.c, writes glyph_atlas.c in the repo root)
+#
+# Each glyph row is stored as one integer holding the whole scaled cell (spacing column included),
+# bit 0 is the leftmost pixel. Vertical scaling is done by sending each row 'size' times.
+
+# ***************** Includes *****************
+
+import os
+import re
+
+# ***************** CONFIGURATION *****************
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+FONT_SOURCE = os.path.join(ROOT, "font5x7.c")
+ATLAS_OUTPUT = os.path.join(ROOT, "glyph_atlas.c")
+
+SIZES = {1: "uint8_t", 2: "uint16_t", 4: "uint32_t", 5: "uint32_t"}
+CELL_WIDTH = 6
+CELL_HEIGHT = 8
+
+# ********************************** HELPER FUNCTIONS **********************************
+
+def load_font():
+    """Reads the glyph columns from font5x7.c"""
+    with open(FONT_SOURCE, "r") as f:
+        text = f.read()
+    glyphs = []
+    for match in re.finditer(r"\{\s*(0x[0-9A-Fa-f]{2}(?:\s*,\s*0x[0-9A-Fa-f]{2}){4})\s*\},\s*//\s*'(.)'", text):
+        glyphs.append(([int(v, 16) for v in match.group(1).split(",")], match.group(2)))
+    if len(glyphs) != 95:
+        raise ValueError(f"expected 95 glyphs in {FONT_SOURCE}, found {len(glyphs)}")
+    return glyphs
+
+def scale_row(columns, row, size):
+    """Returns one scaled glyph row, bit 0 is the leftmost pixel"""
+    bits = 0
+    for col, byte in enumerate(columns):
+        if byte & (1 << row):
+            bits |= ((1 << size) - 1) << (col * size)
+    return bits
+
+# ********************************** MAIN **********************************
+
+def main():
+    glyphs = load_font()
+    out = []
+    out.append("// File: glyph_atlas.c")
+    out.append("// Generated by tools/glyph_atlas.py from font5x7.c, do not edit")
+    out.append("// Description: 5x7 font pre-scaled horizontally for text sizes 1, 2, 4 and 5")
+    out.append("")
+    out.append('#include "./glyph_atlas.h"')
+    for size, ctype in SIZES.items():
+        digits = (CELL_WIDTH * size + 3) // 4
+        out.append("")
+        out.append(f"const {ctype} glyph_atlas_{size}[GLYPH_ATLAS_GLYPHS][GLYPH_ATLAS_ROWS] = {{")
+        for columns, char in glyphs:
+            rows = ", ".join(f"0x{scale_row(columns, r, size):0{digits}X}" for r in range(CELL_HEIGHT))
+            out.append(f"    {{{rows}}}, // '{char}'")
+        out.append("};")
+    out.append("")
+    with open(ATLAS_OUTPUT, "w") as f:
+        f.write("\n".join(out))
+    print(f"Wrote {ATLAS_OUTPUT}")
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,67 @@
+# File: heading_table.py
+# Author: Davis Lester
+# Last Edited: 10/16/2026
+# Description: Generates heading_table.c, the CORDIC arctangent table and the quarter wave sine table
+
+# Usage:
+#   python tools/heading_table.py          (writes heading_table.c in the repo root)
+#
+# Angles are binary angle units, 65536 units per turn (0x4000 = 90 degrees).
+# Sines are Q15, 32767 = 1.0.
+
+# ***************** Includes *****************
+
+import math
+import os
+
+# ***************** CONFIGURATION *****************
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+TABLE_OUTPUT = os.path.join(ROOT, "heading_table.c")
+
+CORDIC_ITERATIONS = 15  # Must match HEADING_CORDIC_ITERATIONS
+QUARTER_STEPS = 256     # Must match HEADING_QUARTER_STEPS
+PER_LINE = 8
+
+# ********************************** HELPER FUNCTIONS **********************************
+
+def atan_table():
+    """atan(2^-i) in binary angle units"""
+    return [round(math.atan(2.0 ** -i) * 65536 / (2 * math.pi)) for i in range(CORDIC_ITERATIONS)]
+
+def sin_table():
+    """sin over the first quarter turn in Q15, both ends included"""
+    return [min(32767, round(math.sin(i * math.pi / 2 / QUARTER_STEPS) * 32768)) for i in range(QUARTER_STEPS + 1)]
+
+def format_values(values):
+    lines = []
+    for i in range(0, len(values), PER_LINE):
+        lines.append("    " + ", ".join(f"{v:5d}" for v in values[i:i + PER_LINE]) + ",")
+    return lines
+
+# ********************************** MAIN **********************************
+
+def main():
+    out = []
+    out.append("// File: heading_table.c")
+    out.append("// Generated by tools/heading_table.py, do not edit")
+    out.append("// Description: CORDIC arctangent table and quarter wave sine table for heading.c")
+    out.append("")
+    out.append('#include "./heading.h"')
+    out.append("")
+    out.append("// atan(2^-i) in binary angle units")
+    out.append("const uint16_t heading_atan_table[HEADING_CORDIC_ITERATIONS] = {")
+    out.extend(format_values(atan_table()))
+    out.append("};")
+    out.append("")
+    out.append("// sin(i * 90 / HEADING_QUARTER_STEPS degrees) in Q15")
+    out.append("const int16_t heading_sin_table[HEADING_QUARTER_STEPS + 1] = {")
+    out.extend(format_values(sin_table()))
+    out.append("};")
+    out.append("")
+    with open(TABLE_OUTPUT, "w") as f:
+        f.write("\n".join(out))
+    print(f"Wrote {TABLE_OUTPUT}")
+
+if __name__ == "__main__":
+    main()
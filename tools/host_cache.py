@@ -0,0 +1,167 @@
+# File: host_cache.py
+# Author: Davis Lester
+# Last Edited: 10/16/2026
+# Description: Response cache for the web data Camera.py sends the phone (weather, location). A background
+#              thread refreshes each entry over one pooled HTTP session before its TTL runs out, so
+#              requests are answered from memory with the age of the data instead of waiting on the web
+
+# Usage:
+#   import host_cache
+#   cache = host_cache.ResponseCache()
+#   cache.add('W', host_cache.fetch_weather, ttl=600, fallback="Offline\n--\nNo Conn\n--")
+#   cache.start()
+#   text, age = cache.get('W')      # age in seconds, None while only the fallback is known
+#
+# WEATHER_URL and LOCATION_URL can be pointed at a local server (tools/cache_test.py runs one offline).
+
+# ***************** Includes *****************
+
+import os
+import threading
+import time
+
+import requests
+from requests.adapters import HTTPAdapter
+
+# ***************** CONFIGURATION *****************
+
+WEATHER_URL = os.environ.get('PHONE_WEATHER_URL', 'http://wttr.in?format=%l|%C|%t|%h|%w')
+LOCATION_URL = os.environ.get('PHONE_LOCATION_URL', 'http://ip-api.com/json/')
+
+HTTP_TIMEOUT_S = 2      # Per fetch, only the refresher ever waits on it
+REFRESH_AT = 0.8        # Share of the TTL after which an entry is refreshed, so it never expires when asked for
+RETRY_S = 30            # Wait after a failed fetch (the last good value keeps being served)
+POOL_SIZE = 4           # Keep alive connections per host
+
+# US State Abbreviations Map
+# States abbreviated for conscise printing on screen
+STATE_MAP = {
+    "Alabama": "AL", "Alaska": "AK", "Arizona": "AZ", "Arkansas": "AR", "California": "CA",
+    "Colorado": "CO", "Connecticut": "CT", "Delaware": "DE", "Florida": "FL", "Georgia": "GA",
+    "Hawaii": "HI", "Idaho": "ID", "Illinois": "IL", "Indiana": "IN", "Iowa": "IA",
+    "Kansas": "KS", "Kentucky": "KY", "Louisiana": "LA", "Maine": "ME", "Maryland": "MD",
+    "Massachusetts": "MA", "Michigan": "MI", "Minnesota": "MN", "Mississippi": "MS", "Missouri": "MO",
+    "Montana": "MT", "Nebraska": "NE", "Nevada": "NV", "New Hampshire": "NH", "New Jersey": "NJ",
+    "New Mexico": "NM", "New York": "NY", "North Carolina": "NC", "North Dakota": "ND", "Ohio": "OH",
+    "Oklahoma": "OK", "Oregon": "OR", "Pennsylvania": "PA", "Rhode Island": "RI", "South Carolina": "SC",
+    "South Dakota": "SD", "Tennessee": "TN", "Texas": "TX", "Utah": "UT", "Vermont": "VT",
+    "Virginia": "VA", "Washington": "WA", "West Virginia": "WV", "Wisconsin": "WI", "Wyoming": "WY"
+}
+
+# ********************************** FETCHERS **********************************
+
+# Each takes the pooled session and returns the reply text, or raises so the last good value stays
+
+def fetch_location(session):
+    """Coordinates from the IP geolocation API"""
+    data = session.get(LOCATION_URL, timeout=HTTP_TIMEOUT_S).json()
+    if data['status'] != 'success':
+        return "Loc: Unknown Region"
+    return f"Lat: {data['lat']}, Lon: {data['lon']}"
+
+def fetch_weather(session):
+    """Weather of the current location as "City\\nTemp\\nCondition\\nHum/Wind" """
+    response = session.get(WEATHER_URL, timeout=HTTP_TIMEOUT_S)
+    response.raise_for_status()
+
+    # Remove degree symbol since it cannot be printed with the library
+    clean = response.text.replace('°', '').replace('+', '')
+    clean = clean.encode('ascii', 'ignore').decode('ascii')
+
+    # Split data into parts to be formatted in thread post-transmission
+    parts = clean.split('|')
+    if len(parts) < 5:
+        raise ValueError(f"unexpected weather reply {clean!r}")
+    city_raw, cond, temp, hum, wind = (part.strip() for part in parts[:5])
+
+    # Abbreviate State
+    for state, abbr in STATE_MAP.items():
+        if state in city_raw:
+            city_raw = city_raw.replace(state, abbr)
+            break
+    return f"{city_raw}\n{temp}\n{cond}\nHum:{hum} Wind:{wind}"
+
+# ********************************** CACHE **********************************
+
+class Entry:
+    def __init__(self, fetch, ttl, fallback):
+        self.fetch = fetch
+        self.ttl = ttl
+        self.value = fallback
+        self.fetched = None         # Monotonic time of the value, None for the fallback
+        self.due = 0.0              # Next refresh
+        self.fetches = 0
+        self.failures = 0
+        self.fetch_ms = 0.0         # Duration of the last fetch
+
+class ResponseCache:
+    """Named entries refreshed by one background thread. get() never blocks on the network: it returns the
+    newest value (or the fallback before the first fetch) and its age."""
+
+    def __init__(self, session=None):
+        if session is None:
+            session = requests.Session()
+            adapter = HTTPAdapter(pool_connections=POOL_SIZE, pool_maxsize=POOL_SIZE)
+            session.mount('http://', adapter)
+            session.mount('https://', adapter)
+        self.session = session
+        self.entries = {}
+        self.lock = threading.Lock()
+        self.wake = threading.Event()
+        self.running = False
+
+    def add(self, key, fetch, ttl, fallback):
+        with self.lock:
+            self.entries[key] = Entry(fetch, ttl, fallback)
+        self.wake.set()
+
+    def get(self, key):
+        """(value, age in whole seconds) of an entry, the age is None while only the fallback is known"""
+        with self.lock:
+            entry = self.entries[key]
+            if entry.fetched is None:
+                return entry.value, None
+            return entry.value, int(time.monotonic() - entry.fetched)
+
+    def stats(self, key):
+        """(fetches, failures, duration of the last fetch in ms) of an entry"""
+        with self.lock:
+            entry = self.entries[key]
+            return entry.fetches, entry.failures, entry.fetch_ms
+
+    def start(self):
+        self.running = True
+        threading.Thread(target=self.refresh_loop, daemon=True).start()
+
+    def stop(self):
+        self.running = False
+        self.wake.set()
+
+    def refresh_loop(self):
+        """Refreshes each entry when it comes due and sleeps until the next one does"""
+        while self.running:
+            now = time.monotonic()
+            with self.lock:
+                due = [entry for entry in self.entries.values() if entry.due <= now]
+            for entry in due:
+                start = time.monotonic()
+                try:
+                    value = entry.fetch(self.session)
+                    ok = True
+                except Exception:
+                    ok = False
+                with self.lock:
+                    entry.fetches += 1
+                    entry.fetch_ms = (time.monotonic() - start) * 1000
+                    if ok:
+                        entry.value = value
+                        entry.fetched = time.monotonic()
+                        entry.due = entry.fetched + entry.ttl * REFRESH_AT
+                    else:
+                        entry.failures += 1
+                        entry.due = time.monotonic() + min(RETRY_S, entry.ttl * REFRESH_AT)
+
+            with self.lock:
+                wait = min((entry.due for entry in self.entries.values()), default=now + RETRY_S) - time.monotonic()
+            self.wake.wait(max(wait, 0.01))
+            self.wake.clear()
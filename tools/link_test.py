@@ -0,0 +1,145 @@
+# File: link_test.py
+# Author: Davis Lester
+# Last Edited: 10/16/2026
+# Description: Line rate negotiation against host/phone_sim, answers the phone like Camera.py does (time
+#              requests and the negotiation frames) over a simulated cable that only carries rates up to
+#              a limit, lowers the limit halfway and checks where the link settles each time. A second run
+#              has a clean cable but a phone that reads the UART too slowly for the fastest rates
+
+# Usage:
+#   make -C host build/phone_sim
+#   python tools/link_test.py [--sim host/build/phone_sim] [--limit 2000000] [--degrade 921600] [--slow-ms 8]
+#
+# The phone should settle on the fastest rate of proto.BAUD_RATES at or below --limit, then fall back and
+# settle at or below --degrade once its requests stop getting through. With every phone sleep lasting
+# --slow-ms, the receive ring overruns above the rates whose bytes per sleep fit in it, and the probe burst
+# must refuse those rates (with overruns counted on the phone and no bad frames at the host). Exits 1 if a
+# check fails.
+
+# ***************** Includes *****************
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+import serial
+
+import proto
+
+# ***************** CONFIGURATION *****************
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+DEFAULT_SIM = os.path.join(ROOT, "host", "build", "phone_sim")
+
+SETTLE_MS = 4000        # Boot negotiation is over well before this
+FALLBACK_MS = 40000     # Lock screen time requests come every few seconds, LINK_FALLBACK_ERRORS of them must fail
+RX_RING = 1024          # UART_RX_RING_SIZE in uart_rx.h
+RX_FIFO = 16            # Receive FIFO of the UART
+
+# ********************************** HELPERS **********************************
+
+def expected_rate(limit):
+    """Fastest negotiated rate the cable carries, the base rate if none"""
+    rates = [r for r in proto.BAUD_RATES if not limit or r <= limit]
+    return max(rates) if rates else proto.BAUD_BASE
+
+def readable_rate(slow_ms):
+    """Fastest rate whose bytes over one late wake up fit in the receive ring and FIFO"""
+    rates = [r for r in proto.BAUD_RATES if r // 10 * slow_ms // 1000 < RX_RING + RX_FIFO]
+    return max(rates) if rates else proto.BAUD_BASE
+
+def write_script(lines):
+    """Sim script of (time ms, command) lines"""
+    script = tempfile.NamedTemporaryFile("w", suffix=".txt", delete=False)
+    for at, command in lines:
+        script.write("%d %s\n" % (at, command))
+    script.close()
+    return script.name
+
+def read_sim(proc, lines):
+    for line in proc.stdout:
+        lines.append(line.rstrip())
+        print("sim  " + line.rstrip())
+
+def reported(lines, label, name):
+    """Counter the phone printed on one of its rxstats lines with this label"""
+    for line in lines:
+        fields = line.split()
+        if label in fields and name in fields:
+            return int(fields[fields.index(name) + 1])
+    return None
+
+def run(sim, script_lines):
+    """Runs the sim on a script and stands in for Camera.py until it quits, returns its output lines and the
+    host's frame reader"""
+    script = write_script(script_lines)
+    proc = subprocess.Popen([sim, "--script", script], stdout=subprocess.PIPE, text=True)
+    tty = proc.stdout.readline().split()[-1]
+    ser = serial.Serial(tty, proto.BAUD_BASE, timeout=0)
+
+    lines = []
+    threading.Thread(target=read_sim, args=(proc, lines), daemon=True).start()
+
+    # Stand in for Camera.py: time requests and the negotiation frames
+    reader = proto.Reader()
+    rate = proto.LineRate(reader)
+    baud = rate.baud
+    start = time.monotonic()
+    while proc.poll() is None:
+        for ftype, seq, payload in reader.feed(ser.read(ser.in_waiting or 1)):
+            if not rate.handle(ser, ftype, seq, payload) and ftype == 'T':
+                ser.write(proto.frame('T', seq, b"9:41 PM"))
+        rate.check(ser)
+        if rate.baud != baud:
+            baud = rate.baud
+            print("host %6d ms  %d baud" % ((time.monotonic() - start) * 1000, baud))
+        time.sleep(0.001)
+    os.unlink(script)
+
+    print("host commits %d  fallbacks %d  frames %d  crc errors %d  skipped %d" % (rate.commits, rate.fallbacks,
+          reader.frames, reader.crc_errors, reader.skipped))
+    return lines, reader
+
+# ********************************** MAIN **********************************
+
+def main():
+    parser = argparse.ArgumentParser(description="Line rate negotiation against the phone simulator")
+    parser.add_argument("--sim", default=DEFAULT_SIM, help="host/build/phone_sim binary")
+    parser.add_argument("--limit", type=int, default=2000000, help="fastest rate the cable carries at first")
+    parser.add_argument("--degrade", type=int, default=921600, help="fastest rate it carries after the halfway mark")
+    parser.add_argument("--slow-ms", type=int, default=8, help="shortest phone sleep of the slow reader run")
+    args = parser.parse_args()
+
+    # Cable that gets worse halfway
+    lines, _ = run(args.sim, [(0, "link-limit %d" % args.limit), (SETTLE_MS, "rxstats settled"),
+                           (SETTLE_MS + 100, "link-limit %d" % args.degrade),
+                           (SETTLE_MS + FALLBACK_MS, "rxstats degraded"), (SETTLE_MS + FALLBACK_MS + 100, "quit")])
+
+    # Clean cable, but the phone wakes too late to empty its receive ring at the fastest rates
+    slow, host = run(args.sim, [(0, "sleep-min %d" % args.slow_ms), (SETTLE_MS, "rxstats slow"),
+                          (SETTLE_MS + 100, "quit")])
+
+    checks = []
+    def check(name, ok, detail):
+        checks.append(ok)
+        print("%-9s %-40s %s" % (name, detail, "ok" if ok else "MISMATCH"))
+
+    for label, limit in (("settled", args.limit), ("degraded", args.degrade)):
+        got = reported(lines, label, "baud")
+        want = expected_rate(limit)
+        check(label, got == want, "%s baud, expected %d" % (got, want))
+    got = reported(slow, "slow", "baud")
+    want = readable_rate(args.slow_ms)
+    check("slow", got == want, "%s baud, expected %d" % (got, want))
+    # The cable is clean both ways, so the refused rates are down to bytes the phone lost
+    overruns = reported(slow, "slow", "overruns")
+    check("slow", bool(overruns) and host.crc_errors == 0,
+          "%s overruns, %d crc errors at the host" % (overruns, host.crc_errors))
+    sys.exit(0 if all(checks) else 1)
+
+if __name__ == "__main__":
+    main()
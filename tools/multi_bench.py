@@ -0,0 +1,196 @@
+# File: multi_bench.py
+# Author: Davis Lester
+# Last Edited: 10/16/2026
+# Description: Scaling benchmark of the Camera.py server driving several phones, each phone a pseudo
+#              terminal pair whose far end a thread drives like a board (unlock, then camera requests back
+#              to back), with a synthetic camera, for a growing number of links with and without the shared
+#              per frame encodings
+
+# Usage:
+#   python tools/multi_bench.py [--links 1,2,4,8] [--seconds 5] [--mix P,Z,L2,V]
+#
+# Each run is its own process (the server threads live as long as it does). Prints requests and bytes per
+# second over all links, the request latency a board sees, the encodes made and handed out again, and the
+# CPU use of the process (server and boards). Exits 1 if a board got a reply it could not parse.
+
+# ***************** Includes *****************
+
+import argparse
+import json
+import os
+import struct
+import subprocess
+import sys
+import threading
+import time
+
+import numpy as np
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+sys.path.insert(0, ROOT)
+
+# ***************** CONFIGURATION *****************
+
+CAMERA_SIZE = (480, 640)    # Synthetic webcam frame, rows and columns
+CAMERA_FPS = 30
+CONNECT_S = 5.0             # Longest wait for the links to open and unlock
+READ_CHUNK = 65536
+
+# Reply sizes of the raw requests, the others carry a length header (Camera.py, README protocol table)
+RAW_BYTES = {'P': 240 * 240 * 2, 'R': 240 * 240 * 2, 'L2': 120 * 120 * 2, 'L3': 80 * 80 * 2}
+
+# ********************************** BOARDS **********************************
+
+class SyntheticCamera:
+    """cv2.VideoCapture stand in, a gradient that pans a few pixels per frame at CAMERA_FPS"""
+    def __init__(self):
+        y, x = np.mgrid[0:CAMERA_SIZE[0], 0:CAMERA_SIZE[1]]
+        self.base = np.dstack((x * 255 // CAMERA_SIZE[1], y * 255 // CAMERA_SIZE[0],
+                               (x + y) * 255 // sum(CAMERA_SIZE))).astype(np.uint8)
+        self.n = 0
+        self.next = time.monotonic()
+
+    def read(self):
+        self.next += 1 / CAMERA_FPS
+        time.sleep(max(0.0, self.next - time.monotonic()))
+        self.n += 4
+        return True, np.roll(self.base, self.n, axis=1)
+
+class NoFaces:
+    """Cascade stand in, the boards unlock with their own 'U'"""
+    def detectMultiScale(self, gray, scale, neighbours):
+        return []
+
+class Board:
+    """Far end of one pseudo terminal, sends the mix of requests in turn and reads each whole reply"""
+    def __init__(self, fd, mix):
+        self.fd = fd
+        self.mix = mix
+        self.buf = bytearray()
+        self.latencies = []
+        self.bytes = 0
+        self.errors = 0
+
+    def read_exact(self, n):
+        while len(self.buf) < n:
+            self.buf += os.read(self.fd, READ_CHUNK)
+        data = bytes(self.buf[:n])
+        del self.buf[:n]
+        return data
+
+    def reply(self, request):
+        """Reads the reply of one request, returns its size"""
+        if request in RAW_BYTES:
+            return len(self.read_exact(RAW_BYTES[request]))
+        if request == 'Z':
+            length = struct.unpack('>I', self.read_exact(4))[0]
+            return 4 + len(self.read_exact(length))
+        count = struct.unpack('>H', self.read_exact(2))[0]
+        return 2 + len(self.read_exact(count * (2 + 16 * 16 * 2)))
+
+    def run(self, proto, until):
+        seq = 0
+        while time.monotonic() < until:
+            request = self.mix[seq % len(self.mix)]
+            args = bytes([int(request[1:])]) if request[0] == 'L' else b''
+            start = time.perf_counter()
+            os.write(self.fd, proto.frame(request[0], seq, args))
+            try:
+                self.bytes += self.reply(request)
+            except struct.error:
+                self.errors += 1
+                return
+            self.latencies.append((time.perf_counter() - start) * 1000)
+            seq += 1
+
+# ********************************** RUNS **********************************
+
+def child(links, seconds, mix, share):
+    """One run in this process: the server on links pseudo terminals, prints its results as JSON"""
+    import Camera
+    import host_cache
+    import proto
+
+    # No web requests, and quiet
+    host_cache.WEATHER_URL = host_cache.LOCATION_URL = "http://127.0.0.1:9/"
+    Camera.LOG_REQUESTS = False
+    Camera.SHARE_ENCODINGS = share
+
+    masters, ports = [], []
+    for _ in range(links):
+        master, slave = os.openpty()
+        masters.append(master)
+        ports.append(os.ttyname(slave))
+    server_links, _ = Camera.start_server(ports, SyntheticCamera(), NoFaces())
+
+    # Unlock every phone like a board whose user pressed through the lock screen
+    deadline = time.monotonic() + CONNECT_S
+    while any(link.state == Camera.STATE_OFFLINE for link in server_links) and time.monotonic() < deadline:
+        time.sleep(0.01)
+    for master in masters:
+        os.write(master, proto.frame('U', 0))
+    while any(link.state != Camera.STATE_UNLOCKED for link in server_links) and time.monotonic() < deadline:
+        time.sleep(0.01)
+
+    boards = [Board(master, mix) for master in masters]
+    until = time.monotonic() + seconds
+    threads = [threading.Thread(target=board.run, args=(proto, until), daemon=True) for board in boards]
+    wall, cpu = time.monotonic(), time.process_time()
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join(seconds + 5)
+    wall, cpu = time.monotonic() - wall, time.process_time() - cpu
+
+    latencies = sorted(ms for board in boards for ms in board.latencies)
+    counts = Camera.encoder.counts
+    print(json.dumps({
+        'requests': len(latencies),
+        'bytes': sum(board.bytes for board in boards),
+        'errors': sum(board.errors for board in boards),
+        'wall': wall,
+        'cpu': cpu,
+        'p50': latencies[len(latencies) // 2] if latencies else 0,
+        'p95': latencies[len(latencies) * 95 // 100] if latencies else 0,
+        'made': sum(made for made, _ in counts.values()),
+        'shared': sum(shared for _, shared in counts.values()),
+    }))
+    sys.stdout.flush()
+    os._exit(0)
+
+# ********************************** MAIN **********************************
+
+def main():
+    parser = argparse.ArgumentParser(description="Camera.py server scaling over pseudo terminal boards")
+    parser.add_argument("--links", default="1,2,4,8", help="comma separated numbers of phones to run")
+    parser.add_argument("--seconds", type=float, default=5, help="length of each run")
+    parser.add_argument("--mix", default="P,Z,L2,V", help="requests each board sends in turn (P R Z L2 L3 K V)")
+    parser.add_argument("--child", type=int, help=argparse.SUPPRESS)
+    parser.add_argument("--no-share", action="store_true", help=argparse.SUPPRESS)
+    args = parser.parse_args()
+    mix = args.mix.split(',')
+
+    if args.child:
+        child(args.child, args.seconds, mix, not args.no_share)
+
+    print("%-6s %-8s %9s %9s %9s %9s %8s %8s %7s" % ("links", "encoding", "req/s", "MB/s", "p50 ms", "p95 ms",
+          "encodes", "shared", "cpu"))
+    failed = False
+    for links in (int(n) for n in args.links.split(',')):
+        for share in (False, True):
+            command = [sys.executable, os.path.abspath(__file__), "--child", str(links), "--seconds",
+                       str(args.seconds), "--mix", args.mix] + ([] if share else ["--no-share"])
+            out = subprocess.run(command, capture_output=True, text=True)
+            lines = [line for line in out.stdout.splitlines() if line.startswith('{')]
+            if not lines:
+                print(out.stdout + out.stderr)
+                sys.exit(1)
+            r = json.loads(lines[-1])
+            failed |= r['errors'] > 0
+            print("%-6d %-8s %9.1f %9.2f %9.1f %9.1f %8d %8d %6.0f%%" % (links, "shared" if share else "per req",
+                  r['requests'] / r['wall'], r['bytes'] / r['wall'] / 1e6, r['p50'], r['p95'], r['made'],
+                  r['shared'], r['cpu'] * 100 / r['wall']))
+    sys.exit(1 if failed else 0)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,113 @@
+# File: needle_table.py
+# Author: Davis Lester
+# Last Edited: 10/16/2026
+# Description: Generates needle_table.c, the anti-aliased compass needle as row spans for each angle
+#              of the first quarter turn
+
+# Usage:
+#   python tools/needle_table.py          (writes needle_table.c in the repo root)
+#
+# Each angle is stored as: dy0 (int8), rows (uint8), then for each row from dy0 upwards:
+#   x0 (int8), len (uint8), ceil(len / 4) coverage bytes (2 bits per pixel, first pixel in the low bits).
+# Coverage 0 is background and 3 is the full needle color. The other quadrants are mirrors of this one.
+
+# ***************** Includes *****************
+
+import math
+import os
+
+# ***************** CONFIGURATION *****************
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+TABLE_OUTPUT = os.path.join(ROOT, "needle_table.c")
+
+QUARTER_ANGLES = 64     # Must match NEEDLE_ANGLES / 4
+LENGTH = 42             # Must match NEEDLE_TABLE_LENGTH
+WIDTH = 1.5             # Needle width in pixels
+SUBSAMPLES = 4          # Coverage samples per pixel along each axis
+PER_LINE = 16
+
+# ********************************** HELPER FUNCTIONS **********************************
+
+def segment_distance(px, py, ex, ey):
+    """Distance from a point to the segment (0, 0) - (ex, ey)"""
+    t = max(0.0, min(1.0, (px * ex + py * ey) / (ex * ex + ey * ey)))
+    return math.hypot(px - t * ex, py - t * ey)
+
+def coverage(x, y, ex, ey):
+    """2 bit coverage of pixel (x, y), pixel centers are on integer coordinates"""
+    hits = 0
+    for sy in range(SUBSAMPLES):
+        for sx in range(SUBSAMPLES):
+            px = x - 0.5 + (sx + 0.5) / SUBSAMPLES
+            py = y - 0.5 + (sy + 0.5) / SUBSAMPLES
+            if segment_distance(px, py, ex, ey) <= WIDTH / 2:
+                hits += 1
+    return round(3 * hits / (SUBSAMPLES * SUBSAMPLES))
+
+def encode_angle(index):
+    """Row spans of the needle at index * 90 / QUARTER_ANGLES degrees"""
+    theta = index * (math.pi / 2) / QUARTER_ANGLES
+    ex, ey = LENGTH * math.cos(theta), LENGTH * math.sin(theta)
+    reach = LENGTH + 2
+
+    rows = []
+    for y in range(-2, reach):
+        covered = [(x, coverage(x, y, ex, ey)) for x in range(-2, reach)]
+        covered = [(x, c) for x, c in covered if c]
+        if covered:
+            x0 = covered[0][0]
+            cov = [0] * (covered[-1][0] - x0 + 1)
+            for x, c in covered:
+                cov[x - x0] = c
+            rows.append((y, x0, cov))
+
+    dy0 = rows[0][0]
+    data = [dy0 & 0xFF, len(rows)]
+    expected = dy0
+    for y, x0, cov in rows:
+        if y != expected:
+            raise ValueError(f"needle rows are not contiguous at angle {index}")
+        expected += 1
+        data += [x0 & 0xFF, len(cov)]
+        for i in range(0, len(cov), 4):
+            byte = 0
+            for k, c in enumerate(cov[i:i + 4]):
+                byte |= c << (2 * k)
+            data.append(byte)
+    return data
+
+# ********************************** MAIN **********************************
+
+def main():
+    offsets = []
+    data = []
+    for index in range(QUARTER_ANGLES + 1):
+        offsets.append(len(data))
+        data += encode_angle(index)
+
+    out = []
+    out.append("// File: needle_table.c")
+    out.append("// Generated by tools/needle_table.py, do not edit")
+    out.append("// Description: Anti-aliased compass needle as row spans for each angle of the first quarter turn")
+    out.append("")
+    out.append('#include "./needle.h"')
+    out.append("")
+    out.append("// Start of each angle in needle_spans")
+    out.append("const uint16_t needle_offsets[NEEDLE_ANGLES / 4 + 1] = {")
+    for i in range(0, len(offsets), PER_LINE // 2):
+        out.append("    " + ", ".join(f"{v:4d}" for v in offsets[i:i + PER_LINE // 2]) + ",")
+    out.append("};")
+    out.append("")
+    out.append(f"// {len(data)} bytes")
+    out.append(f"const uint8_t needle_spans[{len(data)}] = {{")
+    for i in range(0, len(data), PER_LINE):
+        out.append("    " + ", ".join(f"0x{v:02X}" for v in data[i:i + PER_LINE]) + ",")
+    out.append("};")
+    out.append("")
+    with open(TABLE_OUTPUT, "w") as f:
+        f.write("\n".join(out))
+    print(f"Wrote {TABLE_OUTPUT} ({len(data)} bytes of spans)")
+
+if __name__ == "__main__":
+    main()
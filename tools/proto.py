@@ -0,0 +1,195 @@
+# File: proto.py
+# Author: Davis Lester
+# Last Edited: 10/16/2026
+# Description: Host side of the framed command protocol of proto.h, frames with a sync word, type,
+#              sequence number, length and CRC, the same resync state machine as the phone, and the host
+#              half of the line rate negotiation of link.c
+
+# Usage:
+#   import proto
+#   reader = proto.Reader()
+#   for ftype, seq, payload in reader.feed(ser.read(ser.in_waiting or 1)): ...
+#   ser.write(proto.frame(ftype, seq, payload))
+#   rate = proto.LineRate(reader)
+#   rate.handle(ser, ftype, seq, payload)   # True for the negotiation frames, answered here
+#   rate.check(ser)                         # Every loop, ends trials and falls back on garbage
+
+# ***************** Includes *****************
+
+import binascii
+import struct
+import time
+
+# ***************** CONFIGURATION *****************
+
+# Must match proto.h
+SYNC = b'\xa5\x5a'
+HEADER = 6
+CRC_BYTES = 2
+MAX_PAYLOAD = 256
+IDLE_S = 0.02           # A partial frame is dropped once the line has been quiet this long
+AGE_SEP = b'\x1e'       # Ends a cached text reply, the age of its data in decimal seconds follows
+
+# Line rate negotiation, must match link.h
+BAUD_BASE = 460800
+BAUD_RATES = (921600, 1500000, 2000000, 3000000)
+TRIAL_S = 1.0           # LINK_TRIAL_MS, an uncommitted rate is dropped for the previous one after this
+SWITCH_S = 0.002        # Switch delay after echoing a proposal, well inside LINK_SWITCH_MS
+FALLBACK_ERRORS = 2     # Bad frames since the last good one before dropping back to BAUD_BASE
+FALLBACK_SKIPPED = 16   # Or bytes skipped since the last good one
+BURST_MAX = 16          # Most frames of one S burst (the phone asks for LINK_BURST_FRAMES)
+PATTERN_HEAD = SYNC + b'\x00\xff\x55\xaa'
+
+# ********************************** FRAMES **********************************
+
+def crc(data):
+    """CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF)"""
+    return binascii.crc_hqx(data, 0xFFFF)
+
+def frame(ftype, seq, payload=b''):
+    """One frame, ftype is the request letter (str) or byte value, payloads past MAX_PAYLOAD are cut"""
+    if isinstance(ftype, str):
+        ftype = ord(ftype)
+    body = struct.pack('>BBH', ftype, seq & 0xFF, min(len(payload), MAX_PAYLOAD)) + payload[:MAX_PAYLOAD]
+    return SYNC + body + struct.pack('>H', crc(body))
+
+def pattern(seed, length=MAX_PAYLOAD):
+    """Test pattern of link_pattern in link.c: the sync word, all zeros, all ones and alternating bits, then
+    a counter from seed"""
+    return bytes(PATTERN_HEAD[i] if i < len(PATTERN_HEAD) else (seed + i * 37) & 0xFF for i in range(length))
+
+class Reader:
+    """Resync state machine: a window of the bytes that may still start a frame. A bad frame only gives up
+    its first byte, so a sync word inside it (the start of the next good frame) is still found."""
+
+    def __init__(self):
+        self.buf = bytearray()
+        self.frames = 0
+        self.crc_errors = 0
+        self.skipped = 0
+
+    def feed(self, data):
+        """Adds received bytes, returns the good frames they completed as (type letter, seq, payload)"""
+        self.buf += data
+        return self.scan()
+
+    def idle(self):
+        """The line went quiet, a partial frame will not complete: drops it and returns any good frames
+        that were waiting behind it"""
+        frames = []
+        while self.buf:
+            self.crc_errors += 1
+            self.skipped += 1
+            del self.buf[:1]
+            frames += self.scan()
+        return frames
+
+    def scan(self):
+        """Good frames at the start of the window, stops when more bytes are needed"""
+        frames = []
+        while self.buf:
+            start = self.buf.find(SYNC)
+            if start != 0:
+
+                # Keep a trailing first sync byte, the second may still be on the wire
+                if start < 0:
+                    start = len(self.buf) - 1 if self.buf[-1] == SYNC[0] else len(self.buf)
+                self.skipped += start
+                del self.buf[:start]
+                if start == 0 or not self.buf:
+                    break
+                continue
+            if len(self.buf) < HEADER:
+                break
+
+            length = struct.unpack_from('>H', self.buf, 4)[0]
+            size = HEADER + length + CRC_BYTES
+            if length <= MAX_PAYLOAD and len(self.buf) < size:
+                break
+            if length <= MAX_PAYLOAD and crc(bytes(self.buf[2:HEADER + length])) == \
+                    struct.unpack_from('>H', self.buf, HEADER + length)[0]:
+                frames.append((chr(self.buf[2]), self.buf[3], bytes(self.buf[HEADER:HEADER + length])))
+                self.frames += 1
+                del self.buf[:size]
+                continue
+
+            # Corrupted length or CRC, look for the next sync word after this one
+            self.crc_errors += 1
+            self.skipped += 1
+            del self.buf[:1]
+        return frames
+
+# ********************************** LINE RATE **********************************
+
+class LineRate:
+    """Host half of the rate negotiation of link.c. The phone proposes a faster rate with a B frame (u32 big
+    endian), both ends switch once it is echoed, the phone checks Q probes echoed at the new rate and an S
+    burst of full frames longer than its receive ring, and commits it with a second B frame. A rate not committed within TRIAL_S is dropped for the previous one, and a run
+    of bad frames drops the line back to BAUD_BASE (the phone does the same when its requests go unanswered)."""
+
+    def __init__(self, reader, rates=BAUD_RATES):
+        self.reader = reader
+        self.rates = rates
+        self.baud = BAUD_BASE
+        self.previous = BAUD_BASE
+        self.trial_end = None
+        self.good = (reader.frames, reader.crc_errors, reader.skipped)
+        self.commits = 0
+        self.fallbacks = 0
+
+    def switch(self, ser, baud):
+        """Moves the port to a new rate, bytes still buffered at the old one are garbage"""
+        ser.baudrate = baud
+        self.baud = baud
+        self.reader.buf.clear()
+        self.good = (self.reader.frames, self.reader.crc_errors, self.reader.skipped)
+
+    def handle(self, ser, ftype, seq, payload):
+        """Answers a negotiation frame, False for any other frame"""
+        if ftype == 'Q':
+            ser.write(frame('Q', seq, payload))
+            return True
+        if ftype == 'S':
+            count = min(payload[0], BURST_MAX) if len(payload) == 1 else 0
+            ser.write(b''.join(frame('S', seq, pattern(k)) for k in range(count)))
+            return True
+        if ftype != 'B':
+            return False
+
+        rate = struct.unpack('>I', payload)[0] if len(payload) == 4 else None
+
+        # The second B of a trial commits it
+        if self.trial_end is not None and rate == self.baud:
+            ser.write(frame('B', seq, payload))
+            self.trial_end = None
+            self.commits += 1
+            return True
+
+        # Echo, then switch once the echo is out, an empty reply refuses the rate
+        if rate not in self.rates:
+            ser.write(frame('B', seq))
+            return True
+        ser.write(frame('B', seq, payload))
+        ser.flush()
+        time.sleep(SWITCH_S)
+        if self.trial_end is None:
+            self.previous = self.baud
+        self.switch(ser, rate)
+        self.trial_end = time.monotonic() + TRIAL_S
+        return True
+
+    def check(self, ser):
+        """Drops a trial that was not committed in time, and a rate that only brings garbage"""
+        if self.trial_end is not None:
+            if time.monotonic() > self.trial_end:
+                self.trial_end = None
+                self.switch(ser, self.previous)
+            return
+
+        frames, crc_errors, skipped = self.good
+        if self.reader.frames != frames:
+            self.good = (self.reader.frames, self.reader.crc_errors, self.reader.skipped)
+        elif self.baud != BAUD_BASE and (self.reader.crc_errors - crc_errors >= FALLBACK_ERRORS or
+                                         self.reader.skipped - skipped >= FALLBACK_SKIPPED):
+            self.fallbacks += 1
+            self.switch(ser, BAUD_BASE)
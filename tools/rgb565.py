@@ -0,0 +1,81 @@
+# File: rgb565.py
+# Author: Davis Lester
+# Last Edited: 10/16/2026
+# Description: Camera frame to RGB565 kernel, resize, mirror and 565 pack fused into a chain of numpy
+#              ufuncs writing into buffers kept between frames, and the wire bytes handed out as a
+#              memoryview of them instead of a fresh bytes object per frame
+
+# Usage:
+#   import rgb565
+#   packer = rgb565.Packer()
+#   ser.write(packer.wire(frame, 240, 240))        # Big endian RGB565 as the MCU reads it
+#   shared = packer.wire(frame, 240, 240, out=np.empty(240 * 240, np.uint16))
+#   pixels = packer.pack(frame, 240, 240, out=np.empty((240, 240), np.uint16))
+#
+# The wire view and the default pack output live in the packer and are overwritten by its next frame. With
+# out, the view is of the caller's array and stays valid as long as no one writes it.
+
+# ***************** Includes *****************
+
+import sys
+
+import cv2
+import numpy as np
+
+# ***************** CONFIGURATION *****************
+
+SWAP = sys.byteorder == 'little'    # The MCU reads big endian pixels
+
+# ********************************** KERNEL **********************************
+
+class Packer:
+    """Buffers per output size: the resized frame, the packed pixels and one scratch plane. The mirror is a
+    negative stride view of the resized frame, so there is no flipped copy, and each channel goes through
+    mask, shift and or in place (5 ufunc passes, no temporaries)."""
+
+    def __init__(self):
+        self.buffers = {}
+
+    def _buffers(self, w, h):
+        if (w, h) not in self.buffers:
+            self.buffers[(w, h)] = (np.empty((h, w, 3), dtype=np.uint8), np.empty((h, w), dtype=np.uint16),
+                                    np.empty((h, w), dtype=np.uint16))
+        return self.buffers[(w, h)]
+
+    def pack(self, frame, w, h, interpolation=cv2.INTER_LINEAR, out=None):
+        """Resizes a BGR frame to w x h, mirrors it and packs it to native RGB565 (into out if given)"""
+        small, pixels, scratch = self._buffers(w, h)
+        if out is None:
+            out = pixels
+        if frame.shape[:2] == (h, w):
+            small = frame
+        else:
+            cv2.resize(frame, (w, h), dst=small, interpolation=interpolation)
+        mirror = small[:, ::-1]
+
+        # Red to bits 15..11, green to 10..5, blue to 4..0
+        np.bitwise_and(mirror[..., 2], 0xF8, out=out, dtype=np.uint16)
+        np.left_shift(out, 8, out=out)
+        np.bitwise_and(mirror[..., 1], 0xFC, out=scratch, dtype=np.uint16)
+        np.left_shift(scratch, 3, out=scratch)
+        np.bitwise_or(out, scratch, out=out)
+        np.right_shift(mirror[..., 0], 3, out=scratch, dtype=np.uint16)
+        np.bitwise_or(out, scratch, out=out)
+        return out
+
+    def wire(self, frame, w, h, interpolation=cv2.INTER_LINEAR, order=None, out=None):
+        """Packed frame as big endian bytes, a memoryview into the packer's buffer (valid until the next frame)
+        or into out, a flat uint16 array of w * h pixels owned by the caller. order is an optional flat pixel
+        order (progressive photos), taken into a second buffer or into out."""
+        if order is None:
+            pixels = self.pack(frame, w, h, interpolation, out=None if out is None else out.reshape(h, w))
+        else:
+            key = ('order', len(order))
+            if out is None:
+                if key not in self.buffers:
+                    self.buffers[key] = np.empty(len(order), dtype=np.uint16)
+                out = self.buffers[key]
+            pixels = np.take(self.pack(frame, w, h, interpolation).reshape(-1), order, out=out)
+        if SWAP:
+            pixels.byteswap(inplace=True)
+        return memoryview(pixels).cast('B')
@@ -0,0 +1,88 @@
+# File: rgb565_bench.py
+# Author: Davis Lester
+# Last Edited: 10/16/2026
+# Description: Microbenchmark of the camera frame to RGB565 wire bytes step, the old split / astype /
+#              tobytes path of Camera.py against the fused kernel of tools/rgb565.py, with the time and
+#              the bytes allocated per frame and a check that both send the same bytes
+
+# Usage:
+#   python tools/rgb565_bench.py [--width 640 --height 480] [--repeats 200]
+#
+# Frames are synthetic webcam sized BGR images. Allocations are the peak traced by tracemalloc during one
+# frame (numpy reports its buffers to it), after a warm up frame so the kernel's own buffers exist.
+
+# ***************** Includes *****************
+
+import argparse
+import sys
+import time
+import tracemalloc
+
+import cv2
+import numpy as np
+
+import rgb565
+
+# ***************** CONFIGURATION *****************
+
+SIZE = 240          # Must match IMG_WIDTH / IMG_HEIGHT in Camera.py
+SEED = 565
+
+# ********************************** PATHS **********************************
+
+def reference(frame, scale=1):
+    """Camera.py before the kernel: resize, flip, split, three astype copies, pack, byte swap, tobytes"""
+    frame = cv2.resize(frame, (SIZE // scale, SIZE // scale),
+                       interpolation=cv2.INTER_AREA if scale > 1 else cv2.INTER_LINEAR)
+    frame = cv2.flip(frame, 1)
+    b, g, r = cv2.split(frame)
+    r = r.astype(np.uint16)
+    g = g.astype(np.uint16)
+    b = b.astype(np.uint16)
+    return (((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)).astype(np.dtype('>u2')).tobytes()
+
+def kernel(packer, frame, scale=1):
+    return packer.wire(frame, SIZE // scale, SIZE // scale, cv2.INTER_AREA if scale > 1 else cv2.INTER_LINEAR)
+
+def measure(fn, frames, repeats):
+    """Best time per frame in us over the repeats, and the bytes allocated by one frame"""
+    fn(frames[0])
+    tracemalloc.start()
+    fn(frames[1])
+    allocated = tracemalloc.get_traced_memory()[1]
+    tracemalloc.stop()
+
+    best = float("inf")
+    for r in range(repeats):
+        start = time.perf_counter()
+        fn(frames[r % len(frames)])
+        best = min(best, time.perf_counter() - start)
+    return best * 1e6, allocated
+
+# ********************************** MAIN **********************************
+
+def main():
+    parser = argparse.ArgumentParser(description="RGB565 packing microbenchmark")
+    parser.add_argument("--width", type=int, default=640, help="camera frame width")
+    parser.add_argument("--height", type=int, default=480, help="camera frame height")
+    parser.add_argument("--repeats", type=int, default=200, help="frames timed per path, best of")
+    args = parser.parse_args()
+
+    rng = np.random.default_rng(SEED)
+    frames = [rng.integers(0, 256, (args.height, args.width, 3), dtype=np.uint8) for _ in range(4)]
+    packer = rgb565.Packer()
+
+    print("%-8s %12s %12s %8s %14s %14s  %s" % ("output", "old us", "kernel us", "speedup", "old alloc",
+          "kernel alloc", "check"))
+    failed = False
+    for scale in (1, 2, 3):
+        old_us, old_alloc = measure(lambda f: reference(f, scale), frames, args.repeats)
+        new_us, new_alloc = measure(lambda f: kernel(packer, f, scale), frames, args.repeats)
+        match = all(reference(f, scale) == kernel(packer, f, scale) for f in frames)
+        failed |= not match
+        print("%-8s %12.1f %12.1f %7.2fx %14d %14d  %s" % ("%dx%d" % (SIZE // scale, SIZE // scale), old_us,
+              new_us, old_us / new_us, old_alloc, new_alloc, "ok" if match else "MISMATCH"))
+    sys.exit(1 if failed else 0)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,220 @@
+// File: uart_rx.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Interrupt fed UART0 receive ring with blocking reads that sleep until a deadline,
+//              and a line mode that receives bulk data straight into caller line buffers
+
+//************************************Includes***************************************/
+
+// Local Files
+#include "./uart_rx.h"
+#include "./RTOS/RTOS.h"
+
+#include <stddef.h>
+
+// Driverlib
+#include "driverlib/uart.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
+
+//*************************************Variables***************************************/
+
+// Single producer (ISR) and single consumer (reader), the indices run free and are masked on use
+static uint8_t ring[UART_RX_RING_SIZE];
+static volatile uint32_t rx_head = 0;
+static volatile uint32_t rx_tail = 0;
+
+// Line mode, the ISR writes straight into caller line buffers instead of the ring
+static uint8_t *lines = NULL;
+static uint8_t line_count = 0;
+static uint16_t line_len = 0;
+static uint16_t line_pos = 0;                   // Bytes in the line being filled
+static volatile uint32_t lines_filled = 0;      // Completed lines (runs free)
+static volatile uint32_t lines_released = 0;    // Lines handed back by the reader (runs free)
+
+// Set by the ISR when the ring (or every line) filled and the receive interrupts were masked
+static volatile bool held_off = false;
+
+static volatile uart_rx_stats_t stats;
+
+//*************************************Helper Functions***************************************/
+
+/// @brief Masks the receive interrupts until a reader makes room, the rest waits in the FIFO
+static void uart_rx_hold_off(void) {
+    UARTIntDisable(UART0_BASE, UART_INT_RX | UART_INT_RT);
+    held_off = true;
+    stats.stalls++;
+}
+
+/// @brief Drains the hardware FIFO into the ring
+static void uart_rx_fill_ring(void) {
+    uint32_t head = rx_head;
+    while (UARTCharsAvail(UART0_BASE)) {
+        if (head - rx_tail == UART_RX_RING_SIZE) {
+            uart_rx_hold_off();
+            break;
+        }
+        ring[head & UART_RX_RING_MASK] = (uint8_t)UARTCharGetNonBlocking(UART0_BASE);
+        head++;
+    }
+
+    stats.bytes += head - rx_head;
+    if (head - rx_tail > stats.high_water) {
+        stats.high_water = head - rx_tail;
+    }
+    rx_head = head;
+}
+
+/// @brief Drains the hardware FIFO into the free line buffers
+static void uart_rx_fill_lines(void) {
+    uint32_t filled = lines_filled;
+    uint8_t *line = &lines[(filled % line_count) * line_len];
+    while (UARTCharsAvail(UART0_BASE)) {
+        if (filled - lines_released == line_count) {
+            uart_rx_hold_off();
+            break;
+        }
+        line[line_pos++] = (uint8_t)UARTCharGetNonBlocking(UART0_BASE);
+        stats.bytes++;
+        if (line_pos == line_len) {
+            line_pos = 0;
+            filled++;
+            lines_filled = filled;
+            line = &lines[(filled % line_count) * line_len];
+        }
+    }
+}
+
+/// @brief Receive and receive timeout interrupt
+static void uart_rx_isr(void) {
+    uint32_t status = UARTIntStatus(UART0_BASE, true);
+    UARTIntClear(UART0_BASE, status);
+    if (!status) {
+        return;
+    }
+
+    if (UARTRxErrorGet(UART0_BASE) & UART_RXERROR_OVERRUN) {
+        stats.overruns++;
+        UARTRxErrorClear(UART0_BASE);
+    }
+
+    if (lines) {
+        uart_rx_fill_lines();
+    } else {
+        uart_rx_fill_ring();
+    }
+}
+
+/// @brief Unmasks the receive interrupts once a reader made room
+static void uart_rx_resume(void) {
+    bool room = lines ? lines_filled - lines_released < line_count
+                      : rx_head - rx_tail < UART_RX_RING_SIZE;
+    if (held_off && room) {
+        held_off = false;
+        UARTIntEnable(UART0_BASE, UART_INT_RX | UART_INT_RT);
+    }
+}
+
+//*************************************Public Functions***************************************/
+
+void uart_rx_init(void) {
+
+    // Interrupt at half a FIFO, the receive timeout catches the tail of each reply
+    UARTFIFOLevelSet(UART0_BASE, UART_FIFO_TX4_8, UART_FIFO_RX4_8);
+    UARTIntClear(UART0_BASE, UART_INT_RX | UART_INT_RT);
+    UARTIntEnable(UART0_BASE, UART_INT_RX | UART_INT_RT);
+
+    RTOS_Add_APeriodicEvent(uart_rx_isr, UART_RX_PRIORITY, INT_UART0);
+}
+
+uint32_t uart_rx_read(uint8_t *buf, uint32_t len, uint32_t timeout_ms) {
+    uint32_t got = 0;
+    uint32_t waited = 0;
+
+    while (1) {
+
+        // Copy out whatever is waiting
+        uint32_t head = rx_head;
+        uint32_t tail = rx_tail;
+        while (got < len && tail != head) {
+            buf[got++] = ring[tail & UART_RX_RING_MASK];
+            tail++;
+        }
+        rx_tail = tail;
+        uart_rx_resume();
+
+        if (got == len) {
+            return got;
+        }
+        if (timeout_ms != UART_RX_FOREVER && waited >= timeout_ms) {
+            if (timeout_ms) {
+                stats.timeouts++;
+            }
+            return got;
+        }
+
+        // Let every other thread run while the bytes are on the wire
+        sleep(UART_RX_POLL_MS);
+        waited += UART_RX_POLL_MS;
+    }
+}
+
+int16_t uart_rx_getc(uint32_t timeout_ms) {
+    uint8_t c;
+    return uart_rx_read(&c, 1, timeout_ms) ? c : -1;
+}
+
+uint32_t uart_rx_available(void) {
+    return rx_head - rx_tail;
+}
+
+void uart_rx_flush(void) {
+    rx_tail = rx_head;
+    uart_rx_resume();
+}
+
+void uart_rx_lines_begin(uint8_t *buf, uint8_t count, uint16_t len) {
+
+    // The ISR is masked while its target changes, stale ring bytes would start the first line
+    UARTIntDisable(UART0_BASE, UART_INT_RX | UART_INT_RT);
+    rx_tail = rx_head;
+    lines = buf;
+    line_count = count;
+    line_len = len;
+    line_pos = 0;
+    lines_filled = 0;
+    lines_released = 0;
+    held_off = false;
+    UARTIntEnable(UART0_BASE, UART_INT_RX | UART_INT_RT);
+}
+
+const uint8_t *uart_rx_line_wait(uint32_t timeout_ms) {
+    uint32_t waited = 0;
+    while (lines_filled == lines_released) {
+        if (timeout_ms != UART_RX_FOREVER && waited >= timeout_ms) {
+            stats.timeouts++;
+            return NULL;
+        }
+        sleep(UART_RX_POLL_MS);
+        waited += UART_RX_POLL_MS;
+    }
+    return &lines[(lines_released % line_count) * line_len];
+}
+
+void uart_rx_line_release(void) {
+    lines_released++;
+    uart_rx_resume();
+}
+
+void uart_rx_lines_end(void) {
+
+    // A partly received line is dropped with the line buffers
+    UARTIntDisable(UART0_BASE, UART_INT_RX | UART_INT_RT);
+    lines = NULL;
+    held_off = false;
+    UARTIntEnable(UART0_BASE, UART_INT_RX | UART_INT_RT);
+}
+
+uart_rx_stats_t uart_rx_stats(void) {
+    return stats;
+}
@@ -0,0 +1,98 @@
+// File: uart_rx.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Interrupt fed UART0 receive ring with blocking reads that sleep until a deadline,
+//              and a line mode that receives bulk data straight into caller line buffers
+
+#ifndef UART_RX_H_
+#define UART_RX_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Ring size (power of two), holds about 20 ms of traffic at 460800 baud but only 3.4 ms at 3000000.
+// The line has no flow control, so link.c only keeps a rate whose probe burst (twice the ring) is read
+// as it arrives without an overrun
+#define UART_RX_RING_SIZE       1024
+#define UART_RX_RING_MASK       (UART_RX_RING_SIZE - 1)
+
+// Interrupt priority, above the buttons so the 16 byte hardware FIFO never overflows
+#define UART_RX_PRIORITY        1
+
+// Readers sleep this long between checks of an empty ring
+#define UART_RX_POLL_MS         1
+
+// Timeout for reads that may wait forever
+#define UART_RX_FOREVER         0xFFFFFFFF
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    uint32_t bytes;         // Bytes moved into the ring
+    uint32_t overruns;      // Hardware FIFO overruns (bytes were lost)
+    uint32_t stalls;        // Times the ring filled and the interrupt was held off until a read
+    uint32_t timeouts;      // Reads that hit their deadline
+    uint32_t high_water;    // Most bytes waiting in the ring at once
+} uart_rx_stats_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+/// @brief Enables the UART0 receive interrupts and registers the ring ISR (before RTOS_Launch)
+void uart_rx_init(void);
+
+/// @brief Reads bytes, sleeping while the ring is empty instead of spinning on the UART
+/// @param buf Destination
+/// @param len Bytes wanted
+/// @param timeout_ms Total time to wait (at least, in sleeps of UART_RX_POLL_MS), 0 never waits
+/// @return Bytes read, fewer than len if the deadline passed
+uint32_t uart_rx_read(uint8_t *buf, uint32_t len, uint32_t timeout_ms);
+
+/// @brief Reads one byte
+/// @param timeout_ms Time to wait, 0 never waits
+/// @return The byte, or -1 if none arrived in time
+int16_t uart_rx_getc(uint32_t timeout_ms);
+
+/// @brief Bytes waiting in the ring
+uint32_t uart_rx_available(void);
+
+/// @brief Drops every waiting byte (after a timeout, so late bytes do not start the next reply)
+void uart_rx_flush(void);
+
+// Line mode usage (photo.c): the ISR fills line N + 1 while the reader blits line N
+//   uart_rx_lines_begin(buf, 2, 480); send the request;
+//   while ((line = uart_rx_line_wait(timeout))) { use line; uart_rx_line_release(); }
+//   uart_rx_lines_end();
+
+/// @brief Switches the ISR to line mode, waiting ring bytes are dropped
+/// @param buf count * len bytes of line buffers, owned by the ISR until uart_rx_lines_end
+/// @param count Number of line buffers (2 for double buffering)
+/// @param len Bytes per line
+void uart_rx_lines_begin(uint8_t *buf, uint8_t count, uint16_t len);
+
+/// @brief Waits for the oldest completed line, sleeping while it is on the wire
+/// @param timeout_ms Time to wait (at least, in sleeps of UART_RX_POLL_MS)
+/// @return The line, or NULL if it did not complete in time
+const uint8_t *uart_rx_line_wait(uint32_t timeout_ms);
+
+/// @brief Hands the line returned by uart_rx_line_wait back to the ISR
+void uart_rx_line_release(void);
+
+/// @brief Returns the ISR to the ring, a partial line is dropped
+void uart_rx_lines_end(void);
+
+/// @brief Copy of the counters since boot
+uart_rx_stats_t uart_rx_stats(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* UART_RX_H_ */
@@ -0,0 +1,198 @@
+// File: video.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Block delta video decoder, Camera.py sends only the blocks that changed since the
+//              last frame and each one is blitted in place with one address window. Slow links fall
+//              back to 120x120 or 80x80 frames that are pixel doubled (or tripled) while blitting
+
+//************************************Includes***************************************/
+
+// Local Files
+#include "./video.h"
+#include "./uart_rx.h"
+#include "./display.h"
+#include "./perf.h"
+#include "./link.h"
+
+#include <stdio.h>
+
+//*************************************Variables***************************************/
+
+// One block record, the UART ISR keeps filling the ring while it is blitted
+static uint8_t record[VIDEO_RECORD_BYTES];
+
+// Scaled frames: source rows filled by the UART ISR, and the upscaled row sent to the panel
+static uint8_t src_rows[PHOTO_LINES][PHOTO_ROW_BYTES / 2];
+static uint8_t wide_row[PHOTO_ROW_BYTES];
+
+//*************************************Helper Functions***************************************/
+
+/// @brief Requests a block delta frame and blits its blocks (the link is held for the stream)
+static bool video_blocks(char cmd, int16_t x, int16_t y, uint32_t timeout_ms, video_stats_t *stats) {
+    uint8_t header[VIDEO_HEADER_BYTES];
+    uint32_t start = perf_now();
+
+    link_stream_send((uint8_t)cmd, NULL, 0);
+    if (uart_rx_read(header, sizeof(header), timeout_ms) < sizeof(header)) {
+        uart_rx_flush();
+        return false;
+    }
+
+    uint16_t count = (uint16_t)((header[0] << 8) | header[1]);
+    for (uint16_t i = 0; i < count; i++) {
+        if (uart_rx_read(record, sizeof(record), timeout_ms) < sizeof(record)) {
+            uart_rx_flush();
+            return false;
+        }
+
+        // Blocks outside the frame mean the stream is out of step, resync on the next request
+        uint8_t bx = record[0];
+        uint8_t by = record[1];
+        if (bx >= VIDEO_BLOCKS || by >= VIDEO_BLOCKS) {
+            uart_rx_flush();
+            return false;
+        }
+
+        // Rows come lowest Y first, so the block is one window
+        int16_t px = (int16_t)(x + bx * VIDEO_BLOCK);
+        int16_t py = (int16_t)(y + (VIDEO_BLOCKS - 1 - by) * VIDEO_BLOCK);
+        if (display_stream_begin(px, py, VIDEO_BLOCK, VIDEO_BLOCK)) {
+            display_stream_write(&record[2], VIDEO_BLOCK_BYTES);
+            display_stream_end();
+        }
+    }
+
+    if (stats) {
+        stats->frames++;
+        stats->blocks += count;
+        stats->bytes += VIDEO_HEADER_BYTES + (uint32_t)count * VIDEO_RECORD_BYTES;
+        stats->last_ms = (perf_now() - start) / PERF_TICKS_PER_MS;
+        stats->scale = 1;
+    }
+    return true;
+}
+
+//*************************************Public Functions***************************************/
+
+bool video_frame(char cmd, int16_t x, int16_t y, uint32_t timeout_ms, video_stats_t *stats) {
+    link_stream_begin();
+    bool ok = video_blocks(cmd, x, y, timeout_ms, stats);
+    link_stream_end(ok);
+    return ok;
+}
+
+bool video_frame_scaled(uint8_t scale, int16_t x, int16_t y, uint32_t timeout_ms, video_stats_t *stats) {
+    if (scale < 2 || scale > VIDEO_SCALE_MAX) {
+        return false;
+    }
+    uint16_t n = PHOTO_SIZE / scale;
+    uint16_t row;
+
+    // Row buffers first, so the first bytes of the reply already land in them
+    link_stream_begin();
+    uart_rx_lines_begin(&src_rows[0][0], PHOTO_LINES, (uint16_t)(n * 2));
+    uint32_t start = perf_now();
+    link_stream_send(VIDEO_CMD_SCALED, &scale, 1);
+
+    for (row = 0; row < n; row++) {
+        const uint8_t *src = uart_rx_line_wait(timeout_ms);
+        if (!src) {
+            break;
+        }
+
+        // Repeat each pixel across, then hand the source row back so the next one is received meanwhile
+        uint8_t *out = wide_row;
+        for (uint16_t i = 0; i < n; i++) {
+            uint8_t hi = src[2 * i];
+            uint8_t lo = src[2 * i + 1];
+            for (uint8_t k = 0; k < scale; k++) {
+                *out++ = hi;
+                *out++ = lo;
+            }
+        }
+        uart_rx_line_release();
+
+        // Repeat the row down, the scale rows of one source row are one window
+        if (display_stream_begin(x, (int16_t)(y + (n - 1 - row) * scale), PHOTO_SIZE, scale)) {
+            for (uint8_t k = 0; k < scale; k++) {
+                display_stream_write(wide_row, PHOTO_ROW_BYTES);
+            }
+            display_stream_end();
+        }
+    }
+    uart_rx_lines_end();
+    link_stream_end(row == n);
+
+    if (row < n) {
+        return false;
+    }
+    if (stats) {
+        stats->frames++;
+        stats->bytes += (uint32_t)n * n * 2;
+        stats->last_ms = (perf_now() - start) / PERF_TICKS_PER_MS;
+        stats->scale = scale;
+    }
+    return true;
+}
+
+void video_adapt_init(video_adapt_t *adapt, uint8_t scale) {
+    adapt->scale = scale;
+    adapt->frames = 0;
+    adapt->avg_ms = VIDEO_BUDGET_MS;
+}
+
+bool video_adapt(video_adapt_t *adapt, uint32_t frame_ms) {
+    uint8_t s = adapt->scale;
+
+    // Smoothed over about four frames, the first frame at a scale replaces the prediction
+    adapt->avg_ms = adapt->frames ? (adapt->avg_ms * 3 + frame_ms) / 4 : frame_ms;
+    if (adapt->frames < UINT8_MAX) {
+        adapt->frames++;
+    }
+
+    // Too slow, coarser frames take (s / (s + 1))^2 of the bytes (two frames are enough to tell)
+    if (adapt->avg_ms > VIDEO_BUDGET_MS && s < VIDEO_SCALE_MAX && adapt->frames >= 2) {
+        adapt->scale = (uint8_t)(s + 1);
+    }
+
+    // Finer frames take (s / (s - 1))^2 of the bytes, a quarter of the budget is kept as headroom
+    else if (s > 1 && adapt->frames >= VIDEO_ADAPT_FRAMES &&
+             adapt->avg_ms * s * s / ((s - 1) * (s - 1)) < VIDEO_BUDGET_MS * 3 / 4) {
+        adapt->scale = (uint8_t)(s - 1);
+    } else {
+        return false;
+    }
+    adapt->frames = 0;
+    return true;
+}
+
+void video_stats_reset(video_stats_t *stats) {
+    perf_init();
+    stats->frames = 0;
+    stats->blocks = 0;
+    stats->bytes = 0;
+    stats->start = perf_now();
+}
+
+uint32_t video_stats_ms(const video_stats_t *stats) {
+    return (perf_now() - stats->start) / PERF_TICKS_PER_MS;
+}
+
+void video_stats_line(const video_stats_t *stats, char *buf) {
+    uint32_t ms = video_stats_ms(stats);
+    uint32_t fps10 = ms ? stats->frames * 10000u / ms : 0;
+    uint32_t blocks = stats->frames ? stats->blocks / stats->frames : 0;
+
+    // Scaled frames show the source resolution instead of the blocks
+    if (stats->scale > 1) {
+        snprintf(buf, VIDEO_STATS_LINE, "%lu.%lu fps %ux%u x%u %lu B/s",
+                 (unsigned long)(fps10 / 10), (unsigned long)(fps10 % 10), (unsigned)(PHOTO_SIZE / stats->scale),
+                 (unsigned)(PHOTO_SIZE / stats->scale), (unsigned)stats->scale,
+                 (unsigned long)(ms ? (uint64_t)stats->bytes * 1000u / ms : 0));
+        return;
+    }
+
+    snprintf(buf, VIDEO_STATS_LINE, "%lu.%lu fps %lu blk/frame %lu B/s",
+             (unsigned long)(fps10 / 10), (unsigned long)(fps10 % 10), (unsigned long)blocks,
+             (unsigned long)(ms ? (uint64_t)stats->bytes * 1000u / ms : 0));
+}
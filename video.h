@@ -0,0 +1,111 @@
+// File: video.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Block delta video decoder, Camera.py sends only the blocks that changed since the
+//              last frame and each one is blitted in place with one address window. Slow links fall
+//              back to 120x120 or 80x80 frames that are pixel doubled (or tripled) while blitting
+
+#ifndef VIDEO_H_
+#define VIDEO_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./photo.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Frame layout (must match VIDEO_BLOCK in Camera.py)
+#define VIDEO_BLOCK         16
+#define VIDEO_BLOCKS        (PHOTO_SIZE / VIDEO_BLOCK)      // Blocks per side
+#define VIDEO_BLOCK_BYTES   (VIDEO_BLOCK * VIDEO_BLOCK * 2)
+
+// Requests
+#define VIDEO_CMD_KEY       'K' // Every block, the host forgets its previous frame
+#define VIDEO_CMD_DELTA     'V' // Blocks that changed since the last frame sent
+#define VIDEO_CMD_SCALED    'L' // Followed by the scale byte, a whole frame at 1 / scale resolution
+
+// Scaled frames: (PHOTO_SIZE / scale)^2 big endian pixels, top row first
+#define VIDEO_SCALE_MAX     3
+
+// Resolution control, the scale is raised while frames take longer than the budget and lowered again
+// once the finer resolution is predicted to fit (the link bytes grow with the square of the resolution)
+#define VIDEO_TARGET_FPS    3
+#define VIDEO_BUDGET_MS     (1000 / VIDEO_TARGET_FPS)
+#define VIDEO_ADAPT_FRAMES  4       // Frames at a scale before it may get finer again
+
+// Frame: block count (u16 big endian), then per block: column, row (from the top),
+// and the block pixels big endian with the lowest screen row first
+#define VIDEO_HEADER_BYTES  2
+#define VIDEO_RECORD_BYTES  (2 + VIDEO_BLOCK_BYTES)
+
+#define VIDEO_STATS_LINE    80
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    uint32_t frames;        // Frames decoded since the counters were reset
+    uint32_t blocks;        // Blocks blitted
+    uint32_t bytes;         // Bytes received
+    uint32_t start;         // perf_now at the reset
+    uint32_t last_ms;       // Request to last pixel of the latest frame
+    uint8_t scale;          // Scale of the latest frame (1 = full resolution)
+} video_stats_t;
+
+typedef struct {
+    uint8_t scale;          // Current scale, 1 is block delta video at full resolution
+    uint8_t frames;         // Frames since the scale last changed
+    uint32_t avg_ms;        // Smoothed frame time at the current scale
+} video_adapt_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+/// @brief Requests one frame and blits its blocks as they arrive (hold sem_Display)
+/// @param cmd VIDEO_CMD_KEY or VIDEO_CMD_DELTA
+/// @param x X position of the frame
+/// @param y Y position of the bottom row of the frame
+/// @param timeout_ms Deadline for the header and for each block
+/// @param stats Counters to update (may be NULL)
+/// @return True if the whole frame arrived in time
+bool video_frame(char cmd, int16_t x, int16_t y, uint32_t timeout_ms, video_stats_t *stats);
+
+/// @brief Requests one low resolution frame and upscales it by repeating pixels (hold sem_Display)
+/// @param scale 2 (120x120) or 3 (80x80)
+/// @param x X position of the frame
+/// @param y Y position of the bottom row of the frame
+/// @param timeout_ms Deadline for each source row
+/// @param stats Counters to update (may be NULL)
+/// @return True if the whole frame arrived in time
+bool video_frame_scaled(uint8_t scale, int16_t x, int16_t y, uint32_t timeout_ms, video_stats_t *stats);
+
+/// @brief Starts resolution control at a scale
+void video_adapt_init(video_adapt_t *adapt, uint8_t scale);
+
+/// @brief Feeds the time of a frame and picks the scale of the next one
+/// @param adapt Controller state
+/// @param frame_ms Request to last pixel of the frame
+/// @return True if the scale changed
+bool video_adapt(video_adapt_t *adapt, uint32_t frame_ms);
+
+/// @brief Clears the counters and starts a new measuring window (last_ms and scale are kept)
+void video_stats_reset(video_stats_t *stats);
+
+/// @brief Formats frame rate and average delta size since the last reset
+/// @param stats Counters
+/// @param buf Output of at least VIDEO_STATS_LINE bytes
+void video_stats_line(const video_stats_t *stats, char *buf);
+
+/// @brief Milliseconds since the last reset
+uint32_t video_stats_ms(const video_stats_t *stats);
+
+/********************************Public Functions***********************************/
+
+#endif /* VIDEO_H_ */
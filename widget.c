@@ -0,0 +1,123 @@
+// File: widget.c
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Retained widgets that remember what they last put on the panel and only repaint
+//              the parts whose content changed
+
+//************************************Includes***************************************/
+
+// Local Files
+#include "./widget.h"
+#include "./text.h"
+#include "./needle.h"
+
+#include <string.h>
+
+//*************************************Helper Functions***************************************/
+
+/// @brief Shared setup of the text widgets
+static void widget_text_init(widget_t *w, uint8_t type, int16_t x, int16_t y, uint8_t size, uint8_t cells, uint16_t fg, uint16_t bg) {
+    memset(w, 0, sizeof(*w));
+    w->type = type;
+    w->x = x;
+    w->y = y;
+    w->size = size > TEXT_MAX_SIZE ? TEXT_MAX_SIZE : size;
+    w->cells = cells > WIDGET_MAX_CELLS ? WIDGET_MAX_CELLS : cells;
+    w->fg = fg;
+    w->bg = bg;
+}
+
+/// @brief Lays a string out in the glyph cells of a text widget, unused cells are spaces
+static void widget_layout(const widget_t *w, const char *str, char *cells) {
+    uint8_t len = 0;
+    while (str && str[len] && str[len] != '\n' && len < 255) {
+        len++;
+    }
+
+    memset(cells, ' ', w->cells);
+
+    if (w->type == WIDGET_NUMBER) {
+
+        // Keep the last characters (the units) when the text is too long
+        if (len > w->cells) {
+            str += len - w->cells;
+            len = w->cells;
+        }
+        memcpy(&cells[w->cells - len], str, len);
+    } else {
+        memcpy(cells, str, len > w->cells ? w->cells : len);
+    }
+}
+
+//*************************************Public Functions***************************************/
+
+void widget_label_init(widget_t *w, int16_t x, int16_t y, uint8_t size, uint8_t cells, uint16_t fg, uint16_t bg) {
+    widget_text_init(w, WIDGET_LABEL, x, y, size, cells, fg, bg);
+}
+
+void widget_number_init(widget_t *w, int16_t x, int16_t y, uint8_t size, uint8_t cells, uint16_t fg, uint16_t bg) {
+    widget_text_init(w, WIDGET_NUMBER, x, y, size, cells, fg, bg);
+}
+
+void widget_needle_init(widget_t *w, int16_t cx, int16_t cy, uint16_t color, uint16_t bg) {
+    memset(w, 0, sizeof(*w));
+    w->type = WIDGET_NEEDLE;
+    w->x = cx;
+    w->y = cy;
+    w->fg = color;
+    w->bg = bg;
+    w->step = NEEDLE_NONE;
+}
+
+void widget_invalidate(widget_t *w) {
+    w->valid = false;
+}
+
+uint8_t widget_set_text(widget_t *w, const char *str) {
+    char cells[WIDGET_MAX_CELLS];
+    char run[WIDGET_MAX_CELLS + 1];
+    uint8_t sent = 0;
+    int16_t cell_w = (int16_t)(TEXT_CELL_WIDTH * w->size);
+
+    widget_layout(w, str, cells);
+
+    // Each run of changed cells goes out as one text run
+    uint8_t i = 0;
+    while (i < w->cells) {
+        if (w->valid && cells[i] == w->shown[i]) {
+            i++;
+            continue;
+        }
+        uint8_t start = i;
+        while (i < w->cells && (!w->valid || cells[i] != w->shown[i])) {
+            i++;
+        }
+
+        memcpy(run, &cells[start], i - start);
+        run[i - start] = '\0';
+        text_draw((int16_t)(w->x + start * cell_w), w->y, run, w->size, w->fg, w->bg, 0);
+        sent += i - start;
+    }
+
+    memcpy(w->shown, cells, w->cells);
+    w->valid = true;
+    return sent;
+}
+
+bool widget_needle_moved(const widget_t *w, uint16_t angle) {
+    return !w->valid || NEEDLE_STEP(angle) != w->step;
+}
+
+bool widget_set_needle(widget_t *w, uint16_t angle) {
+    if (!widget_needle_moved(w, angle)) {
+        return false;
+    }
+
+    // Pixel delta between the old and the new needle, a full draw if the panel does not hold one
+    int16_t step = NEEDLE_STEP(angle);
+    needle_draw(w->x, w->y, w->valid ? w->step : NEEDLE_NONE, step, w->fg, w->bg);
+
+    w->step = step;
+    w->valid = true;
+    return true;
+}
@@ -0,0 +1,96 @@
+// File: widget.h
+// Author: Davis Lester
+// Last Edited: 10/16/2026
+// Description: Retained widgets that remember what they last put on the panel and only repaint
+//              the parts whose content changed
+
+#ifndef WIDGET_H_
+#define WIDGET_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Widget types
+#define WIDGET_LABEL        0 // Left aligned text
+#define WIDGET_NUMBER       1 // Right aligned text, for big numeric readouts that keep their units column still
+#define WIDGET_NEEDLE       2 // Anti-aliased needle around a fixed center
+
+// Glyph cells per text widget (a full line of size 1 text)
+#define WIDGET_MAX_CELLS    40
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    uint8_t type;
+    bool valid;                         // False until the first draw or after widget_invalidate
+    int16_t x, y;                       // Text cursor or needle center
+    uint8_t size;                       // Text size
+    uint8_t cells;                      // Text width in glyph cells
+    uint16_t fg, bg;
+    char shown[WIDGET_MAX_CELLS];       // Glyph cells currently on the panel
+    int16_t step;                       // Needle step currently on the panel
+} widget_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+// Usage (widgets are static, hold sem_Display around every set call):
+//   static widget_t temp_label;
+//   widget_label_init(&temp_label, 10, 240, 5, 7, COLOR_TEXT, COLOR_BG);
+//   every refresh: widget_set_text(&temp_label, temp);
+// A refresh with the same content sends nothing to the panel.
+
+/// @brief Sets up a left aligned text widget, placed like display_setCursor
+/// @param w Widget
+/// @param x Cursor X position
+/// @param y Cursor Y position (glyphs extend towards lower Y)
+/// @param size Text size
+/// @param cells Width in glyph cells (at most WIDGET_MAX_CELLS), unused cells are background
+/// @param fg RGB565 text color
+/// @param bg RGB565 background color
+void widget_label_init(widget_t *w, int16_t x, int16_t y, uint8_t size, uint8_t cells, uint16_t fg, uint16_t bg);
+
+/// @brief Sets up a right aligned text widget, same parameters as widget_label_init
+void widget_number_init(widget_t *w, int16_t x, int16_t y, uint8_t size, uint8_t cells, uint16_t fg, uint16_t bg);
+
+/// @brief Sets up a needle widget (see needle.h, the needle stays within NEEDLE_REACH of its center)
+/// @param w Widget
+/// @param cx Center X position
+/// @param cy Center Y position
+/// @param color RGB565 needle color
+/// @param bg RGB565 background color, used for erasing and for the anti-aliased edges
+void widget_needle_init(widget_t *w, int16_t cx, int16_t cy, uint16_t color, uint16_t bg);
+
+/// @brief Forces a full repaint on the next set call (after something else drew over the widget)
+void widget_invalidate(widget_t *w);
+
+/// @brief Updates a text widget, only the glyph cells that changed are repainted
+/// @param w Label or number widget
+/// @param str New text (stops at a newline), NULL clears the widget
+/// @return Number of glyph cells sent to the panel
+uint8_t widget_set_text(widget_t *w, const char *str);
+
+/// @brief Checks if a needle widget would change, so callers can skip taking the display
+/// @param w Needle widget
+/// @param angle Needle angle in binary angle units (0 points towards +X, a quarter turn towards +Y)
+/// @return True if the angle lands on a different needle step than the one on the panel
+bool widget_needle_moved(const widget_t *w, uint16_t angle);
+
+/// @brief Updates a needle widget, only the pixels that differ from the needle on the panel are sent
+/// @param w Needle widget
+/// @param angle Needle angle in binary angle units
+/// @return True if the needle was redrawn
+bool widget_set_needle(widget_t *w, uint16_t angle);
+
+/********************************Public Functions***********************************/
+
+#endif /* WIDGET_H_ */